@@ -28,6 +28,7 @@ group "Dependencies"
 group ""
 
 include "sculpto"
+include "sculpto/tests"
 include "samples/sandbox"
 include "samples/editor"
 include "samples/raytracing"
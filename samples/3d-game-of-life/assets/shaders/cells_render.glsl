@@ -0,0 +1,48 @@
+#version 460
+
+#include "lib/binding_points.include.glsl"
+
+#define BINDING_POINT_CELLS BINDING_POINT_FREE
+
+#shader-begin vert
+    #include "lib/default_vertex_layout.include.glsl"
+
+    /* Cells states (not zero for alive cells), one per drawn instance. Cell position is restored from its index. */
+    layout(std430, binding = BINDING_POINT_CELLS) readonly buffer ssbo_Cells {
+        uint Cells[];
+    };
+    uniform mat4 u_MatrVP;
+    uniform int u_GridSize;
+
+    out vec3 vert_out_Normal;
+    out vec3 vert_out_Color;
+
+    void main()
+    {
+        int index = gl_InstanceID;
+        ivec3 cell = ivec3(index % u_GridSize, index / u_GridSize % u_GridSize, index / (u_GridSize * u_GridSize));
+
+        // Dead cells are collapsed to degenerate triangles, so all cells are drawn by single call.
+        float scale = Cells[index] != 0 ? 0.9 : 0.0;
+        vec3 position = v_Pos * scale + vec3(cell) - vec3(u_GridSize / 2.0);
+
+        vert_out_Normal = v_Normal;
+        vert_out_Color = mix(vec3(0.3, 0.8, 0.5), vec3(0.8, 0.4, 0.3), float(cell.y) / float(u_GridSize));
+        gl_Position = u_MatrVP * vec4(position, 1.0);
+    }
+#shader-end
+
+#shader-begin frag
+    in vec3 vert_out_Normal;
+    in vec3 vert_out_Color;
+
+    /* Shader output data. */
+    layout(location = 0) out vec4 OutColor;
+
+    void main()
+    {
+        const vec3 light_direction = normalize(vec3(0.3, 1.0, 0.5));
+        float diffuse = abs(dot(normalize(vert_out_Normal), light_direction));
+        OutColor = vec4(vert_out_Color * (0.25 + 0.75 * diffuse), 1);
+    }
+#shader-end
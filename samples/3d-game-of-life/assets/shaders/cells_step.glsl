@@ -0,0 +1,62 @@
+#version 460
+
+#include "lib/binding_points.include.glsl"
+
+#define BINDING_POINT_CELLS      BINDING_POINT_FREE
+#define BINDING_POINT_NEXT_CELLS (BINDING_POINT_FREE + 1)
+#define CELLS_GROUP_SIZE         4
+
+#shader-begin compute
+    layout(local_size_x = CELLS_GROUP_SIZE, local_size_y = CELLS_GROUP_SIZE, local_size_z = CELLS_GROUP_SIZE) in;
+
+    /* Current and next generation cells states (not zero for alive cells). */
+    layout(std430, binding = BINDING_POINT_CELLS) readonly buffer ssbo_Cells {
+        uint Cells[];
+    };
+    layout(std430, binding = BINDING_POINT_NEXT_CELLS) writeonly buffer ssbo_NextCells {
+        uint NextCells[];
+    };
+    uniform int u_GridSize;
+    uniform int u_Seed;      /* Random first generation seed (0 to compute next generation). */
+
+    /* Integer hash (PCG) function. */
+    uint Hash(uint X)
+    {
+        X = X * 747796405u + 2891336453u;
+        uint w = ((X >> ((X >> 28u) + 4u)) ^ X) * 277803737u;
+        return (w >> 22u) ^ w;
+    }
+
+    /* Cell state getter function (cells outside of grid are dead). */
+    uint GetCell(ivec3 Cell)
+    {
+        if (any(lessThan(Cell, ivec3(0))) || any(greaterThanEqual(Cell, ivec3(u_GridSize)))) return 0;
+        return Cells[(Cell.z * u_GridSize + Cell.y) * u_GridSize + Cell.x] != 0 ? 1 : 0;
+    }
+
+    /* Next generation (rule 4555: alive cell survives with 4 or 5 neighbours, dead cell is born with 5). */
+    void main()
+    {
+        ivec3 cell = ivec3(gl_GlobalInvocationID);
+        if (any(greaterThanEqual(cell, ivec3(u_GridSize)))) return;
+        uint index = uint((cell.z * u_GridSize + cell.y) * u_GridSize + cell.x);
+
+        // Each fourth cell of random generation is alive on average.
+        if (u_Seed != 0)
+        {
+            NextCells[index] = uint(Hash(index ^ Hash(uint(u_Seed))) % 4u == 0u);
+            return;
+        }
+
+        uint neighbours = 0;
+        for (int dz = -1; dz <= 1; dz++)
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dx = -1; dx <= 1; dx++)
+                    neighbours += GetCell(cell + ivec3(dx, dy, dz));
+        uint is_alive = GetCell(cell);
+        neighbours -= is_alive;
+
+        NextCells[index] =
+            is_alive != 0 ? uint(neighbours == 4 || neighbours == 5) : uint(neighbours == 5);
+    }
+#shader-end
@@ -1,6 +1,6 @@
 /*****************************************************************//**
- * \file   raytracing.cpp
- * \brief  GPU raytracing based on sculpto library main module.
+ * \file   3d-game-of-life.cpp
+ * \brief  3D game of life based on sculpto library main module.
  *
  * \author Sabitov Kirill
  * \date   15 July 2022
@@ -10,81 +10,94 @@
 #include <core/application/entry_point.h>
 using namespace scl;
 
-class raytracing_app: public application
+class game_of_life_app: public application
 {
-    struct scene_data
-    {
-        vec3 CameraPosition;
-        float CameraProjectionDistance;
-        vec3 CameraDirection;
-        float ViewportWidth;
-        vec3 CameraRightDirection;
-        float ViewportHeight;
-        vec3 CameraUpDirection;
-        float ViewportProjectionWidth;
-        float ViewportProjectionHeight;
-        float Time;
-        u32 Samples;
-    };
-
 private:
-    camera Camera { camera_projection_type::PERSPECTIVE };
-    vec3 PrevFrameCameraPosition {};
-    vec3 PrevFrameCameraDirection {};
-    vec3 PrevFrameCameraUpDirection {};
-    vec3 PrevFrameCameraRightDirection {};
-    u32 AccumulatedFramesCount;
+    static constexpr int GridSize = 16;        /*! Cells grid size along each axis. */
+    static constexpr float StepPeriod = 0.5f;  /*! Time between generations in seconds. */
+    static constexpr u32 CellsGroupSize = 4;   /*! Cells step compute shader work group size along each axis (CELLS_GROUP_SIZE in shader). */
 
+    camera Camera { camera_projection_type::PERSPECTIVE };
+    shared<frame_buffer>    CellsFrameBuffer {};
     shared<viewport_window> MainViewportWindow {};
-    shared<shader_program>  RayTracingShader {};
-    shared<shader_program>  RayTracingFrameDrawShader {};
-    shared<constant_buffer> SceneDataBuffer {};
-    scene_data SceneData {};
-    bool IsImageStatic { true };
-
-    void UpdateSceneData()
+    shared<shader_program>  CellsRenderShader {};
+    shared<shader_program>  CellsStepShader {};
+    shared<vertex_array>    CellVertexArray {};
+
+    // Cells states are stored in storage buffers (std430 layout), so grid size is not limited by uniform block size.
+    // Generations are computed by compute shader from first buffer to second one.
+    shared<storage_buffer>  CellsBuffers[2] {};
+    // Step work groups count is read from buffer, so it could be written by shaders (e.g. to skip empty grid regions).
+    shared<storage_buffer>  StepArguments {};
+    float StepTime { StepPeriod };  /*! Time since last generation (first, random one is computed on first update). */
+    bool IsSeeded {};
+
+    /*!*
+     * Compute next generation on GPU (cells buffers are swapped, so current generation is always in first one).
+     * First generation is random one.
+     */
+    void Step()
     {
-        SceneData.CameraDirection = Camera.GetDirection();
-        SceneData.CameraPosition = Camera.GetPosition();
-        SceneData.CameraProjectionDistance = Camera.GetProjectionDistance();
-        SceneData.CameraRightDirection = Camera.GetRightDirection();
-        SceneData.CameraUpDirection = Camera.GetUpDirection();
-        SceneData.ViewportWidth = Camera.GetViewportWidth();
-        SceneData.ViewportHeight = Camera.GetViewportHeight();
-        SceneData.ViewportProjectionWidth = Camera.GetViewportProjectionWidth();
-        SceneData.ViewportProjectionHeight = Camera.GetViewportProjectionHeight();
-        SceneData.Time = timer::GetTime();
-        SceneData.Samples = IsImageStatic ? 16 : 4;
-        SceneDataBuffer->Update(&SceneData, sizeof(scene_data));
+        if (!CellsStepShader->IsReady()) return;
+
+        CellsBuffers[0]->Bind(render_context::BINDING_POINT_FREE);
+        CellsBuffers[1]->Bind(render_context::BINDING_POINT_FREE + 1);
+        CellsStepShader->Bind();
+        CellsStepShader->SetInt("u_GridSize", GridSize);
+        if (!IsSeeded)
+        {
+            u32 groups_count = render_bridge::GetGroupsCount(GridSize, CellsGroupSize);
+            CellsStepShader->SetInt("u_Seed", rand() % 1024 + 1);
+            render_bridge::Dispatch(groups_count, groups_count, groups_count);
+            IsSeeded = true;
+        }
+        else
+        {
+            CellsStepShader->SetInt("u_Seed", 0);
+            render_bridge::DispatchIndirect(StepArguments);
+        }
+
+        // Next generation is read by following step and cells draw.
+        render_bridge::Barrier(render_context::BARRIER_STORAGE_BUFFER);
+        std::swap(CellsBuffers[0], CellsBuffers[1]);
     }
 
 public:
-    raytracing_app() : application("Editor") {}
-    ~raytracing_app() override {}
+    game_of_life_app() : application("3D Game Of Life") {}
+    ~game_of_life_app() override {}
 
     void OnInit() override
     {
         application::Get().GuiEnabled = true;
 
-        RayTracingShader = assets_manager::LoadShader("assets/shaders/raytracing_main.glsl");
-        RayTracingFrameDrawShader = assets_manager::LoadShader("assets/shaders/raytracing_frame_draw.glsl");
-        SceneDataBuffer = constant_buffer::Create(sizeof(scene_data));
-        MainViewportWindow = CreateShared<viewport_window>(Camera.GetMainFrameBuffer());
+        CellsRenderShader = assets_manager::LoadShader("assets/shaders/cells_render.glsl");
+        CellsStepShader = assets_manager::LoadShader("assets/shaders/cells_step.glsl");
+        CellsFrameBuffer = frame_buffer::Create(frame_buffer_props { 16, 16, 1, false, 1, 1 });
+        MainViewportWindow = CreateShared<viewport_window>(CellsFrameBuffer);
+
+        // All cells are instances of single cube.
+        topology::cube cube(vec3 { 0 }, vec3 { 1 });
+        CellVertexArray = vertex_array::Create(mesh_type::TRIANGLES);
+        CellVertexArray->SetVertexBuffer(vertex_buffer::Create(cube.GetVertices().data(), (u32)cube.GetVertices().size(), vertex::GetVertexLayout()));
+        CellVertexArray->SetIndexBuffer(index_buffer::Create((u32 *)cube.GetIndices().data(), (u32)cube.GetIndices().size()));
 
-        Camera.SetRenderToSwapChain(false);
-        Camera.SetView(vec3 { -2, 2, 5 }, vec3 { 0, 0, 0 }, vec3 { 0, 1, 0 });
+        const u32 cells_size = GridSize * GridSize * GridSize * sizeof(u32);
+        CellsBuffers[0] = storage_buffer::Create(cells_size);
+        CellsBuffers[1] = storage_buffer::Create(cells_size);
+
+        u32 groups_count = render_bridge::GetGroupsCount(GridSize, CellsGroupSize);
+        u32 step_arguments[3] { groups_count, groups_count, groups_count };
+        StepArguments = storage_buffer::Create(step_arguments, sizeof(step_arguments));
+
+        Camera.SetView(vec3 { GridSize, GridSize, -GridSize }, vec3 { 0 }, vec3 { 0, 1, 0 });
         Camera.Resize(application::GetWindow().GetWindowData().Width, application::GetWindow().GetWindowData().Height);
         event_dispatcher::AddEventListner<viewport_resize_event>([&](viewport_resize_event &Event)
         {
             if (Event.GetViewportId() == 30)
+            {
                 Camera.Resize(Event.GetWidth(), Event.GetHeight());
-            return false;
-        });
-
-        event_dispatcher::AddEventListner<keyboard_event>([&](keyboard_event &Event)
-        {
-            if (Event.GetKeyCode() == keycode::R && Event.GetClicked())
-                assets_manager::UpdateShader(RayTracingShader);
+                CellsFrameBuffer->Resize(Event.GetWidth(), Event.GetHeight());
+            }
             return false;
         });
 
@@ -94,19 +107,19 @@ public:
             {
                 Camera.Rotate(scl::vec3(0, 1, 0),
                               scl::input_system::GetMousePosDeltaX() *
-                              scl::timer::GetDeltaTime() * 2);
+                              scl::timer::GetDeltaTime() * 10);
                 Camera.Rotate(Camera.GetRightDirection(),
                               scl::input_system::GetMousePosDeltaY() *
-                              scl::timer::GetDeltaTime() * 2);
+                              scl::timer::GetDeltaTime() * 10);
             }
             if (scl::input_system::GetKey(scl::keycode::RBUTTON))
             {
                 Camera.Move(Camera.GetRightDirection() *
                             -scl::input_system::GetMousePosDeltaX() *
-                            scl::timer::GetDeltaTime() * 2);
+                            scl::timer::GetDeltaTime() * 3);
                 Camera.Move(Camera.GetUpDirection() *
                             scl::input_system::GetMousePosDeltaY() *
-                            scl::timer::GetDeltaTime() * 2);
+                            scl::timer::GetDeltaTime() * 3);
             }
             return true;
         });
@@ -117,7 +130,7 @@ public:
             {
                 Camera.Move(Camera.GetDirection() *
                             scl::input_system::GetMousePosDeltaZ() *
-                            scl::timer::GetDeltaTime() / 2);
+                            scl::timer::GetDeltaTime() * 5);
             }
             return true;
         });
@@ -127,49 +140,25 @@ public:
 
     void OnUpdate(float DeltaTime) override
     {
-#if 1
-        static float delta = 0;
-        if (delta > 1)
+        StepTime += DeltaTime;
+        if (StepTime > StepPeriod)
         {
-            SCL_INFO("FPS: {}", timer::GetFps());
-            delta = 0;
+            Step();
+            StepTime = 0;
         }
-        delta += timer::GetDeltaTime();
-#endif
-
-        IsImageStatic = PrevFrameCameraPosition == Camera.GetPosition() &&
-            PrevFrameCameraDirection == Camera.GetDirection() &&
-            PrevFrameCameraUpDirection == Camera.GetUpDirection() &&
-            PrevFrameCameraRightDirection == Camera.GetRightDirection();
-        UpdateSceneData();
-
-        // Render frame to hdr frame buffer (with static samples count).
-        if (!IsImageStatic) Camera.GetHDRFrameBuffer()->Clear();
-        Camera.GetHDRFrameBuffer()->Bind();
-
-        SceneDataBuffer->Bind(0);
-        RayTracingShader->Bind();
-        Camera.GetHDRFrameBuffer()->GetColorAttachment()->Bind(0);
-        renderer::DrawFullscreenQuad();
-
-        Camera.GetHDRFrameBuffer()->Unbind();
-
-        PrevFrameCameraPosition = Camera.GetPosition();
-        PrevFrameCameraDirection = Camera.GetDirection();
-        PrevFrameCameraUpDirection = Camera.GetUpDirection();
-        PrevFrameCameraRightDirection = Camera.GetRightDirection();
-
-        // Draw accumulated frames
-        Camera.GetMainFrameBuffer()->Clear();
-        Camera.GetMainFrameBuffer()->Bind();
-
-        AccumulatedFramesCount = IsImageStatic ? AccumulatedFramesCount + 1 : 1;
-        RayTracingFrameDrawShader->Bind();
-        RayTracingFrameDrawShader->SetUInt("u_AccumulatedFramesCount", AccumulatedFramesCount);
-        Camera.GetHDRFrameBuffer()->GetColorAttachment()->Bind(0);
-        renderer::DrawFullscreenQuad();
-
-        Camera.GetMainFrameBuffer()->Unbind();
+
+        // All cells (alive and dead) are drawn with single instanced draw call.
+        CellsFrameBuffer->Clear();
+        CellsFrameBuffer->Bind();
+        render_bridge::SetDepthTestMode(true);
+
+        CellsBuffers[0]->Bind(render_context::BINDING_POINT_FREE);
+        CellsRenderShader->Bind();
+        CellsRenderShader->SetMatr4("u_MatrVP", Camera.GetViewProjection());
+        CellsRenderShader->SetInt("u_GridSize", GridSize);
+        render_bridge::DrawIndicesInstanced(CellVertexArray, GridSize * GridSize * GridSize);
+
+        CellsFrameBuffer->Unbind();
     }
 
     void OnGuiUpdate() override
@@ -180,5 +169,5 @@ public:
 
 scl::application *scl::CreateApplication()
 {
-    return new raytracing_app();
+    return new game_of_life_app();
 }
@@ -1,35 +0,0 @@
-#define BINDING_POINT_SCENE_DATA              0
-#define BINDING_POINT_MATERIAL_DATA           5
-#define BINDING_POINT_LIGHTS_STORAGE          10
-#define BINDING_POINT_SHADOW_CASTERS_STORAGE  11
-#define BINDING_POINT_FREE                    20
-
-#define TEXTURE_SLOT_MATERIAL_DIFFUSE         0
-#define TEXTURE_SLOT_MATERIAL_SPECULAR        1
-#define TEXTURE_SLOT_MATERIAL_EMISSION_MAP    2
-#define TEXTURE_SLOT_MATERIAL_NORMAL_MAP      3
-#define TEXTURE_SLOT_SHADOW_MAP               5
-#define TEXTURE_SLOT_HDR_BUFFER               6
-#define TEXTURE_SLOT_BLUR_BUFFER              7
-#define TEXTURE_SLOT_APPLY_SOURCE             9
-#define TEXTURE_SLOT_APPLY_TEXTURE_ADD        10
-#define TEXTURE_SLOT_GEOM_PASS_OUT_POSITION             11
-#define TEXTURE_SLOT_GEOM_PASS_OUT_NORMAL               12
-#define TEXTURE_SLOT_GEOM_PASS_OUT_COLOR                13
-#define TEXTURE_SLOT_GEOM_PASS_OUT_PHONG_DIFFUSE        14
-#define TEXTURE_SLOT_GEOM_PASS_OUT_PHONG_SPECULAR       15
-#define TEXTURE_SLOT_GEOM_PASS_OUT_PHONG_SHININESS      16
-#define TEXTURE_SLOT_LIGHTING_PASS_OUT_COLOR            17
-#define TEXTURE_SLOT_LIGHTING_PASS_OUT_BRIGHT_COLOR     18
-
-#define LIGHTS_MAX_POINT                      50
-#define LIGHTS_MAX_SPOT                       50
-
-#define COLOR_ATTACHMENT_GEOM_PASS_OUT_POSITION             0
-#define COLOR_ATTACHMENT_GEOM_PASS_OUT_NORMAL               1
-#define COLOR_ATTACHMENT_GEOM_PASS_OUT_COLOR                2
-#define COLOR_ATTACHMENT_GEOM_PASS_OUT_PHONG_DIFFUSE        3
-#define COLOR_ATTACHMENT_GEOM_PASS_OUT_PHONG_SPECULAR       4
-#define COLOR_ATTACHMENT_GEOM_PASS_OUT_PHONG_SHININESS      5
-#define COLOR_ATTACHMENT_LIGHTING_PASS_OUT_COLOR            0
-#define COLOR_ATTACHMENT_LIGHTING_PASS_OUT_BRIGHT_COLOR     1
\ No newline at end of file
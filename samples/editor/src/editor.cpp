@@ -48,7 +48,7 @@ class cube_behaviour: public scl::scene_object_behaviour
     void OnUpdate() override
     {
         auto &transform = GetComponent<scl::transform_component>();
-        transform.Transform = scl::matr4::Rotate(scl::vec3 { 0.5, 0.3, 0.7 }, scl::timer::GetTime() * 15);
+        transform.SetTransform(scl::matr4::Rotate(scl::vec3 { 0.5, 0.3, 0.7 }, scl::timer::GetTime() * 15));
     }
 };
 
@@ -63,6 +63,27 @@ private:
     shared<scene_config_window> SceneConfigWindow {};
     shared<scene_hierarchy_window> SceneHierarchyWindow {};
     shared<scene_object_config_window> SceneObjectConfigWindow {};
+    scene_snapshot_history SnapshotsHistory { 32 };
+    shared<scene_loader> SceneLoader {};
+    char SceneFileName[256] { "assets/scenes/test.scl" };
+
+    /*! Editor main camera scene object getter function (returns not valid object if there is no camera). */
+    scene_object GetMainCamera()
+    {
+        scene_object camera = EditorScene->GetSceneObject(EditorScene->GetNameIndex().Find("Main Camera"));
+        return camera.IsOk() && camera.HasComponent<camera_component>() ? camera : scene_object {};
+    }
+
+    /*! Attach editor camera controls and viewport to main camera of loaded scene. */
+    void OnSceneLoad()
+    {
+        scene_object camera = GetMainCamera();
+        if (!camera.IsOk()) return;
+
+        if (!camera.HasComponent<native_script_component>())
+            camera.AddComponent<native_script_component>().Bind<camera_behaviour>();
+        MainViewportWindow->SetViewportBuffer(camera.GetComponent<camera_component>().Camera.GetMainFrameBuffer());
+    }
 
 public:
     editor_app() : application("Editor") {}
@@ -125,15 +146,18 @@ public:
         topology::sphere sphere_topo = topology::sphere(vec3 { 0 }, 1, 20);
 
         col = vec3 { 1 };
-        auto light_bulb_1 = EditorScene->CreateObject("Point Light 1");
-        light_bulb_1.AddComponent<mesh_component>(mesh::Create(sphere_topo, material_single_color::Create(col)));
-        light_bulb_1.AddComponent<transform_component>(vec3 { 0.1 }, vec3 { 0 }, vec3 { 2, 4, 2 });
-        light_bulb_1.AddComponent<point_light_component>(col, 1.0f, 0.022f, 0.0019f);
+        auto light_bulb = prefab::Create("Point Light");
+        light_bulb->AddComponent<mesh_component>(mesh::Create(sphere_topo, material_single_color::Create(col)));
+        light_bulb->AddComponent<point_light_component>(col, 1.0f, 0.022f, 0.0019f);
+        EditorScene->Instantiate(*light_bulb, 1, { transform_component(vec3 { 0.1 }, vec3 { 0 }, vec3 { 2, 4, 2 }) });
 
 
         auto model = EditorScene->CreateObject("Model, loaded from file");
-        model.AddComponent<mesh_component>(assets_manager::LoadMeshes("assets\\models\\sponza\\sponza.gltf"));
         model.AddComponent<transform_component>(vec3 { 0.02 }, vec3 { 0, 0, 0 }, vec3 {});
+        assets_manager::LoadMeshesAsync("assets\\models\\sponza\\sponza.gltf").OnLoad([model](const shared<mesh> &Mesh) mutable
+        {
+            if (Mesh != nullptr && model.IsOk()) model.AddComponent<mesh_component>(Mesh);
+        });
         // model.AddComponent<native_script_component>().Bind<cube_behaviour>();
 
         camera render_camera { camera_projection_type::PERSPECTIVE, camera_effects { true, 0.7, true, 8 } };
@@ -156,6 +180,15 @@ public:
         {
             SceneObjectConfigWindow->SetConfiguringObject(SelectedObject);
         });
+        MainViewportWindow->SetOnClick([this](float X, float Y)
+        {
+            scene_object camera = GetMainCamera();
+            if (!camera.IsOk()) return;
+
+            const scl::camera &view_camera = camera.GetComponent<camera_component>().Camera;
+            scene_object picked_object = EditorScene->PickObject(view_camera.GetRay(X, Y), view_camera.GetFarClip());
+            if (picked_object.IsOk()) SceneObjectConfigWindow->SetConfiguringObject(picked_object);
+        });
 
         application::Get().GuiEnabled = true;
     }
@@ -177,6 +210,13 @@ public:
         delta += timer::GetDeltaTime();
 #endif
 
+        // Opened scene is loaded incrementally, so editor stays responsive.
+        if (SceneLoader != nullptr && SceneLoader->Update(AssetsUploadBudget))
+        {
+            OnSceneLoad();
+            SceneLoader.reset();
+        }
+
         EditorScene->Update();
         EditorScene->Render();
     }
@@ -189,9 +229,58 @@ public:
         SceneConfigWindow->Draw();
         SceneHierarchyWindow->Draw();
         SceneObjectConfigWindow->Draw();
+        DrawSnapshotsWindow();
+        DrawSceneFileWindow();
 
         ImGui::ShowDemoWindow();
     }
+
+    void DrawSnapshotsWindow()
+    {
+        ImGui::Begin("Scene Snapshots");
+        ImGui::Text("Stored snapshots: %zu/%zu", SnapshotsHistory.GetCount(), SnapshotsHistory.GetCapacity());
+        if (ImGui::Button("Capture"))
+            SnapshotsHistory.Push(EditorScene->Snapshot());
+        ImGui::SameLine();
+        if (ImGui::Button("Restore") && SnapshotsHistory.GetCount() > 0)
+            EditorScene->Restore(*SnapshotsHistory.Get());
+        ImGui::SameLine();
+        if (ImGui::Button("Rewind") && SnapshotsHistory.GetCount() > 1)
+        {
+            SnapshotsHistory.Pop();
+            EditorScene->Restore(*SnapshotsHistory.Get());
+        }
+        ImGui::End();
+    }
+
+    void DrawSceneFileWindow()
+    {
+        ImGui::Begin("Scene File");
+        ImGui::InputText("##scene_file_name", SceneFileName, sizeof(SceneFileName));
+        if (SceneLoader != nullptr)
+        {
+            ImGui::ProgressBar(SceneLoader->GetProgress());
+            ImGui::End();
+            return;
+        }
+
+        if (ImGui::Button("Save"))
+        {
+            std::error_code error {};
+            std::filesystem::create_directories(std::filesystem::path(SceneFileName).parent_path(), error);
+            scene_serializer::Serialize(EditorScene, SceneFileName);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Open") && std::filesystem::exists(SceneFileName))
+        {
+            // Objects of previous scene (and their snapshots) are dropped before loading.
+            SceneObjectConfigWindow->SetConfiguringObject({});
+            SnapshotsHistory.Clear();
+            EditorScene->Clear();
+            SceneLoader = scene_loader::Create(EditorScene, SceneFileName);
+        }
+        ImGui::End();
+    }
 };
 
 scl::application *scl::CreateApplication()
@@ -1,5 +0,0 @@
-layout (location = 0) in vec3 v_Pos;
-layout (location = 1) in vec3 v_Normal;
-layout (location = 2) in vec3 v_Tangent;
-layout (location = 3) in vec3 v_Bitangent;
-layout (location = 4) in vec2 v_TexCoords;
\ No newline at end of file
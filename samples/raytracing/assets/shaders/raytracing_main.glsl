@@ -16,9 +16,6 @@
 
 #shader-begin frag
     #define PI 3.1415926535
-    #define MAX_SPHERE_COUNT 100
-    #define MAX_BOX_COUNT    100
-    #define MAX_PLANES_COUNT 100
 
     #include "raytracing_ray.glsl"
     #include "raytracing_objects.glsl"
@@ -38,16 +35,13 @@
         float   u_ViewportProjectionHeight;
         float   u_Time;
         uint    u_Samples;
-    };
-    layout(std140, binding = 1) uniform ubo_SceneObjects
-    {
-        sphere  u_Spheres[MAX_SPHERE_COUNT];
-        box     u_Boxes  [MAX_BOX_COUNT];
-        plane   u_Planes [MAX_PLANES_COUNT];
         uint    u_SpheresCount;
         uint    u_BoxesCount;
         uint    u_PlanesCount;
     };
+    layout(std430, binding = 1) readonly buffer ssbo_Spheres { sphere u_Spheres[]; };
+    layout(std430, binding = 2) readonly buffer ssbo_Boxes   { box    u_Boxes[];   };
+    layout(std430, binding = 3) readonly buffer ssbo_Planes  { plane  u_Planes[];  };
     in vec2 TexCoords;
 
     /* Shader output data. */
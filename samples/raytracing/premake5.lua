@@ -29,6 +29,12 @@ project "raytracing"
         "sculpto",
     }
 
+    -- Engine shaders library is shared by all samples and copied to sample assets on build.
+    postbuildcommands
+    {
+        "{COPYDIR} \"%{wks.location}/sculpto/assets/shaders/lib\" \"%{prj.location}/assets/shaders/lib\"",
+    }
+
     filter { "system:windows", "kind:WindowedApp or ConsoleApp" }
         entrypoint "mainCRTStartup"
 
@@ -65,18 +65,12 @@ class raytracing_app: public application
             Size(Size), Rotation(Rotation), Position(Position), Surface(Surface) {}
     };
 
-#define MAX_SPHERE_COUNT 100
-#define MAX_BOX_COUNT    100
-#define MAX_PLANES_COUNT 100
-
+    // Objects are stored in storage buffers (std430 layout), so their count is not limited.
     struct scene_objects
     {
-        sphere Spheres[MAX_SPHERE_COUNT] {};
-        box    Boxes[MAX_BOX_COUNT] {};
-        plane  Planes[MAX_PLANES_COUNT] {};
-        u32    SpheresCount {};
-        u32    BoxesCount {};
-        u32    PlanesCount {};
+        std::vector<sphere> Spheres {};
+        std::vector<box>    Boxes {};
+        std::vector<plane>  Planes {};
     };
 
     struct scene_data
@@ -92,6 +86,9 @@ class raytracing_app: public application
         float  ViewportProjectionHeight;
         float  Time;
         u32    Samples;
+        u32    SpheresCount;
+        u32    BoxesCount;
+        u32    PlanesCount;
     };
 
 private:
@@ -106,7 +103,9 @@ private:
     shared<shader_program>  RayTracingShader {};
     shared<shader_program>  RayTracingFrameDrawShader {};
     shared<constant_buffer> SceneDataBuffer {};
-    shared<constant_buffer> SceneObjectsBuffer {};
+    shared<storage_buffer>  SpheresBuffer {};
+    shared<storage_buffer>  BoxesBuffer {};
+    shared<storage_buffer>  PlanesBuffer {};
     scene_data SceneData {};
     scene_objects SceneObjects {};
     bool IsImageStatic { true };
@@ -124,9 +123,19 @@ private:
         SceneData.ViewportProjectionHeight = Camera.GetViewportProjectionHeight();
         SceneData.Time                     = timer::GetTime();
         SceneData.Samples                  = IsImageStatic ? 16 : 4;
+        SceneData.SpheresCount             = (u32)SceneObjects.Spheres.size();
+        SceneData.BoxesCount               = (u32)SceneObjects.Boxes.size();
+        SceneData.PlanesCount              = (u32)SceneObjects.Planes.size();
         SceneDataBuffer->Update(&SceneData, sizeof(scene_data));
     }
 
+    void UpdateSceneObjects()
+    {
+        SpheresBuffer->Update(SceneObjects.Spheres.data(), (u32)(SceneObjects.Spheres.size() * sizeof(sphere)));
+        BoxesBuffer->Update(SceneObjects.Boxes.data(), (u32)(SceneObjects.Boxes.size() * sizeof(box)));
+        PlanesBuffer->Update(SceneObjects.Planes.data(), (u32)(SceneObjects.Planes.size() * sizeof(plane)));
+    }
+
 public:
     raytracing_app() : application("PathTracer") {}
     ~raytracing_app() override {}
@@ -138,7 +147,9 @@ public:
         RayTracingShader = assets_manager::LoadShader("assets/shaders/raytracing_main.glsl");
         RayTracingFrameDrawShader = assets_manager::LoadShader("assets/shaders/raytracing_frame_draw.glsl");
         SceneDataBuffer = constant_buffer::Create(sizeof(scene_data));
-        SceneObjectsBuffer = constant_buffer::Create(sizeof(scene_objects));
+        SpheresBuffer = storage_buffer::Create(sizeof(sphere) * 64);
+        BoxesBuffer = storage_buffer::Create(sizeof(box) * 16);
+        PlanesBuffer = storage_buffer::Create(sizeof(plane) * 4);
         MainViewportWindow = CreateShared<viewport_window>(Camera.GetMainFrameBuffer());
 
         Camera.SetRenderToSwapChain(false);
@@ -221,7 +232,9 @@ public:
         Camera.GetHDRFrameBuffer()->Bind();
 
         SceneDataBuffer->Bind(0);
-        SceneObjectsBuffer->Bind(1);
+        SpheresBuffer->Bind(1);
+        BoxesBuffer->Bind(2);
+        PlanesBuffer->Bind(3);
         RayTracingShader->Bind();
         Camera.GetHDRFrameBuffer()->GetColorAttachment()->Bind(0);
         renderer::DrawFullscreenQuad();
@@ -253,8 +266,8 @@ public:
 
     void InitCernellBoxScene()
     {
-        SceneObjects.SpheresCount = 3;
-        SceneObjects.BoxesCount = 9;
+        SceneObjects.Spheres.resize(3);
+        SceneObjects.Boxes.resize(9);
 
         SceneObjects.Spheres[0] = sphere(vec3(2.5, -1.0, -1.0), 1.0, surface(vec3(0.0), 1.0, vec3(0.95, 0.012, 0.032), 0.0));
         SceneObjects.Spheres[1] = sphere(vec3(-3.5, -4.25, 2.25), 0.75, surface(vec3(0.0), 0.7, vec3(0.97, 0.43, 0.012), 0.0));
@@ -305,20 +318,17 @@ public:
             0, 0, 0, 1
         ), vec3(1.5, 0, -5.2), surface(vec3(0.0), 1, vec3(0.85), 0));
 
-        SceneObjectsBuffer->Update(&SceneObjects, sizeof(scene_objects));
+        UpdateSceneObjects();
     }
 
     void InitializeSpheresFieldScene()
     {
-        SceneObjects.SpheresCount = 64;
-        SceneObjects.PlanesCount = 1;
-
+        const int spheres_count = 64;
         srand(30);
 
-        SceneObjects.Planes[0] = plane(0, vec3(0, 1, 0), surface(vec3(0), 0, vec3(0.61961, 0.65098, 0.54902), 0));
+        SceneObjects.Planes.push_back(plane(0, vec3(0, 1, 0), surface(vec3(0), 0, vec3(0.61961, 0.65098, 0.54902), 0)));
 
-        int dispersion = (int)sqrt(SceneObjects.SpheresCount) * 3 / 2;
-        int ind = 0;
+        int dispersion = (int)sqrt(spheres_count) * 3 / 2;
         for (int i = -dispersion; i < dispersion; i += 3)
             for (int j = -dispersion; j < dispersion; j += 3)
             {
@@ -361,11 +371,11 @@ public:
                 float radius = math::Rnd(0.1, 1.0);
                 float scetter_x = math::Rnd(-0.5, 0.5);
                 float scetter_z = math::Rnd(-0.5, 0.5);
-                SceneObjects.Spheres[ind++] = sphere(vec3(i + scetter_x, radius, j + scetter_z), radius,
-                                                     surface(emm, rough, refl, opac));
+                SceneObjects.Spheres.push_back(sphere(vec3(i + scetter_x, radius, j + scetter_z), radius,
+                                                      surface(emm, rough, refl, opac)));
             }
 
-        SceneObjectsBuffer->Update(&SceneObjects, sizeof(scene_objects));
+        UpdateSceneObjects();
     }
 };
 
@@ -1,7 +1,11 @@
+#pragma once
+
 #define BINDING_POINT_SCENE_DATA              0
 #define BINDING_POINT_MATERIAL_DATA           5
 #define BINDING_POINT_LIGHTS_STORAGE          10
 #define BINDING_POINT_SHADOW_CASTERS_STORAGE  11
+#define BINDING_POINT_DRAW_DATA               12
+#define BINDING_POINT_MATERIALS_STORAGE       13
 #define BINDING_POINT_FREE                    20
 
 #define TEXTURE_SLOT_MATERIAL_DIFFUSE         0
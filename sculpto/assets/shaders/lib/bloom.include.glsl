@@ -1,3 +1,5 @@
+#pragma once
+
 bool IsColorBright(vec3 Color)
 {
     float brightness = dot(Color, vec3(0.2126, 0.7152, 0.0722));
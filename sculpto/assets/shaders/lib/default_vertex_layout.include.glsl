@@ -1,3 +1,5 @@
+#pragma once
+
 layout (location = 0) in vec3 v_Pos;
 layout (location = 1) in vec3 v_Normal;
 layout (location = 2) in vec3 v_Tangent;
@@ -0,0 +1,24 @@
+#pragma once
+#include "binding_points.include.glsl"
+
+/* Indirect draw data (element per draw command of multi draw indirect call). */
+struct draw_data
+{
+    mat4 World;         /* Drawn geometry world matrix. */
+    mat4 Normal;        /* Drawn geometry normals matrix (upper 3x3 part is used). */
+    uint MaterialIndex; /* Drawn geometry material index in pass materials list. */
+};
+
+layout(std430, binding = BINDING_POINT_DRAW_DATA) readonly buffer ssbo_DrawData
+{
+    draw_data u_DrawData[];
+};
+
+/* Index of first draw of current multi draw call (gl_DrawID is counted from zero in each call). */
+uniform uint u_FirstDraw;
+
+/* Current draw data getter function. */
+draw_data GetDrawData()
+{
+    return u_DrawData[u_FirstDraw + gl_DrawID];
+}
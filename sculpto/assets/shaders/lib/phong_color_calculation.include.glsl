@@ -1,3 +1,5 @@
+#pragma once
+
 /*****************************************
   * Phong lighting model color components calculation
   *****************************************/
@@ -0,0 +1,146 @@
+#version 460
+
+#ifdef MATERIAL_STORAGE
+#extension GL_ARB_bindless_texture : require
+/* Maps handles of different draws of multi draw call are not dynamically uniform. */
+#extension GL_NV_gpu_shader5 : require
+#endif /* MATERIAL_STORAGE */
+
+#include "binding_points.include.glsl"
+#include "pipeline_data.include.glsl"
+#include "phong_lights_data.include.glsl"
+#include "phong_material_data.include.glsl"
+
+#shader-begin vert
+    #include "default_vertex_layout.include.glsl"
+
+    #ifdef INDIRECT_DRAW
+    #include "indirect_draw_data.include.glsl"
+    uniform mat4 u_MatrVP;
+    #else
+    uniform mat3 u_MatrN;
+    uniform mat4 u_MatrW;
+    uniform mat4 u_MatrWVP;
+    #endif /* INDIRECT_DRAW */
+
+    /* Shader output data. */
+    out VS_OUT
+    {
+        vec3 Pos;
+        vec4 LightSpacePos;
+        vec3 Normal;
+    #ifdef MATERIAL_NORMAL_MAP
+        mat3 TBN;
+    #endif /* MATERIAL_NORMAL_MAP */
+        vec2 TexCoords;
+    #ifdef MATERIAL_STORAGE
+        flat uint MaterialIndex;
+    #endif /* MATERIAL_STORAGE */
+    } vs_out;
+
+    void main()
+    {
+    #ifdef INDIRECT_DRAW
+        // Per draw matrices replace matrices uniforms of direct draws.
+        draw_data draw = GetDrawData();
+        mat4 u_MatrW = draw.World;
+        mat3 u_MatrN = mat3(draw.Normal);
+        mat4 u_MatrWVP = u_MatrVP * draw.World;
+    #ifdef MATERIAL_STORAGE
+        vs_out.MaterialIndex = draw.MaterialIndex;
+    #endif /* MATERIAL_STORAGE */
+    #endif /* INDIRECT_DRAW */
+
+        vs_out.TexCoords = v_TexCoords;
+        vs_out.Pos = vec3(u_MatrW * vec4(v_Pos, 1.0));
+        if (u_DirectionalLight.IsShadows)
+            vs_out.LightSpacePos = u_DirectionalLight.ViewProjection * vec4(vs_out.Pos, 1.0);
+        vs_out.Normal = normalize(u_MatrN * v_Normal);
+    #ifdef MATERIAL_NORMAL_MAP
+        vs_out.TBN = mat3(normalize(u_MatrN * v_Tangent), normalize(u_MatrN * v_Bitangent), vs_out.Normal);
+    #endif /* MATERIAL_NORMAL_MAP */
+
+        gl_Position = u_MatrWVP * vec4(v_Pos, 1.0);
+    }
+#shader-end
+
+#shader-begin frag
+    #include "phong_color_calculation.include.glsl"
+    #include "bloom.include.glsl"
+
+    /* Shader input data. */
+    in VS_OUT
+    {
+        vec3 Pos;
+        vec4 LightSpacePos;
+        vec3 Normal;
+    #ifdef MATERIAL_NORMAL_MAP
+        mat3 TBN;
+    #endif /* MATERIAL_NORMAL_MAP */
+        vec2 TexCoords;
+    #ifdef MATERIAL_STORAGE
+        flat uint MaterialIndex;
+    #endif /* MATERIAL_STORAGE */
+    } fs_in;
+
+    /* Shader output data. */
+    layout(location = COLOR_ATTACHMENT_GEOM_PASS_OUT_POSITION       ) out vec4 OutPosition;
+    layout(location = COLOR_ATTACHMENT_GEOM_PASS_OUT_NORMAL         ) out vec4 OutNormal;
+    layout(location = COLOR_ATTACHMENT_GEOM_PASS_OUT_COLOR          ) out vec4 OutColor;
+    layout(location = COLOR_ATTACHMENT_GEOM_PASS_OUT_PHONG_DIFFUSE  ) out vec4 OutDiffuse;
+    layout(location = COLOR_ATTACHMENT_GEOM_PASS_OUT_PHONG_SPECULAR ) out vec4 OutSpecular;
+    layout(location = COLOR_ATTACHMENT_GEOM_PASS_OUT_PHONG_SHININESS) out vec4 OutShininessIsShadeIsBloomed;
+
+    void main()
+    {
+    #ifdef MATERIAL_STORAGE
+        // Material data of draw replaces material uniforms and bound maps of direct draws.
+        material_data material = u_Materials[fs_in.MaterialIndex];
+        vec3 u_Specular = material.Specular;
+        float u_Shininess = material.Shininess;
+        vec3 u_Diffuse = material.Diffuse;
+        bool u_IsSpecularMap = material.IsSpecularMap;
+        bool u_IsDiffuseMap = material.IsDiffuseMap;
+        bool u_IsEmissionMap = material.IsEmissionMap;
+        bool u_IsNormalMap = material.IsNormalMap;
+        sampler2D u_SpecularMap = sampler2D(material.SpecularMap);
+        sampler2D u_DiffuseMap = sampler2D(material.DiffuseMap);
+        sampler2D u_EmissionMap = sampler2D(material.EmissionMap);
+        sampler2D u_NormalMap = sampler2D(material.NormalMap);
+    #endif /* MATERIAL_STORAGE */
+
+        OutPosition = vec4(fs_in.Pos, 1);
+
+        vec3 norm = fs_in.Normal;
+    #ifdef MATERIAL_NORMAL_MAP
+        if (IS_MATERIAL_MAP(u_IsNormalMap))
+        {
+            // Normal maps store only tangent space X and Y (Z is reconstructed), so they could be two channel compressed.
+            vec2 normal_xy = texture(u_NormalMap, fs_in.TexCoords).rg * 2 - 1;
+            norm = fs_in.TBN * vec3(normal_xy, sqrt(max(0, 1 - dot(normal_xy, normal_xy))));
+        }
+    #endif /* MATERIAL_NORMAL_MAP */
+        OutNormal = vec4(normalize(norm), 1);
+        // OutNormal = vec4(normalize(fs_in.Normal), 1);
+
+    #ifdef MATERIAL_EMISSION_MAP
+        if (IS_MATERIAL_MAP(u_IsEmissionMap))
+            OutColor = vec4(texture(u_EmissionMap, fs_in.TexCoords).rgb * 5, 1);
+    #endif /* MATERIAL_EMISSION_MAP */
+
+    #ifdef MATERIAL_DIFFUSE_MAP
+        OutDiffuse = IS_MATERIAL_MAP(u_IsDiffuseMap) ? texture(u_DiffuseMap, fs_in.TexCoords) : vec4(u_Diffuse, 1);
+    #else
+        OutDiffuse = vec4(u_Diffuse, 1);
+    #endif /* MATERIAL_DIFFUSE_MAP */
+        if (OutDiffuse.w < 0.1) discard;
+
+    #ifdef MATERIAL_SPECULAR_MAP
+        OutSpecular = IS_MATERIAL_MAP(u_IsSpecularMap) ? vec4(texture(u_SpecularMap, fs_in.TexCoords).rgb, 1) : vec4(u_Specular, 1);
+    #else
+        OutSpecular = vec4(u_Specular, 1);
+    #endif /* MATERIAL_SPECULAR_MAP */
+
+        OutShininessIsShadeIsBloomed = vec4(u_Shininess, 1, 1, 1);
+    }
+#shader-end
@@ -1,3 +1,6 @@
+#pragma once
+#include "binding_points.include.glsl"
+
 /* Point light structure. */
 struct point_light
 {
@@ -14,7 +17,6 @@ struct directional_light
     vec3 Direction;
     bool IsShadows;
     vec3 Color;
-    float dummy2;
     mat4 ViewProjection;
 };
 
@@ -32,9 +34,9 @@ struct spot_light
 /* Current pipieline lights storage. */
 layout(std140, binding = BINDING_POINT_LIGHTS_STORAGE) uniform ubo_LightsStorage
 {
-    point_light        u_PointLights[50];
+    point_light        u_PointLights[LIGHTS_MAX_POINT];
     directional_light  u_DirectionalLight;
-    spot_light         u_SpotLights[50];
+    spot_light         u_SpotLights[LIGHTS_MAX_SPOT];
     uint               u_PointLightsCount;
     bool               u_IsDirectionalLight;
     uint               u_SpotLightsCount;
@@ -0,0 +1,49 @@
+#pragma once
+#include "binding_points.include.glsl"
+
+#ifdef MATERIAL_STORAGE
+/* Material data of materials storage (maps are sampled by bindless texture handles). */
+struct material_data
+{
+    vec3  Specular;      /* Material specular lighting coefficient. */
+    float Shininess;     /* Material shiness exponent lighting coefficient. */
+    vec3  Diffuse;       /* Material diffuse lighting coefficient. */
+    bool  IsSpecularMap; /* Flag, showing whether specular map is used. */
+    bool  IsDiffuseMap;  /* Flag, showing whether diffuse map is used. */
+    bool  IsEmissionMap; /* Flag, showing whether emission map is used. */
+    bool  IsNormalMap;   /* Flag, showing whether normal map is used. */
+    uvec2 SpecularMap;   /* Specular map bindless handle. */
+    uvec2 DiffuseMap;    /* Diffuse map bindless handle. */
+    uvec2 EmissionMap;   /* Emission map bindless handle. */
+    uvec2 NormalMap;     /* Normal map bindless handle. */
+};
+
+/* Data of all materials of indirect draws (indexed by draw material index). */
+layout(std430, binding = BINDING_POINT_MATERIALS_STORAGE) readonly buffer ssbo_Materials
+{
+    material_data u_Materials[];
+};
+
+/* Any map could be used by material from storage, so maps code is compiled and maps flags are checked dynamically. */
+#define MATERIAL_DIFFUSE_MAP
+#define MATERIAL_SPECULAR_MAP
+#define MATERIAL_EMISSION_MAP
+#define MATERIAL_NORMAL_MAP
+#define IS_MATERIAL_MAP(IsMap) (IsMap)
+#else
+/* Currently rendering mesh material data (maps flags are resolved by shader variant, so they are not stored). */
+layout(std140, binding = BINDING_POINT_MATERIAL_DATA) uniform ubo_Material
+{
+    vec3  u_Specular;      /* Material specular lighting coefficient. */
+    float u_Shininess;     /* Material shiness exponent lighting coefficient. */
+    vec3  u_Diffuse;       /* Material diffuse lighting coefficient. */
+};
+
+layout(binding  = TEXTURE_SLOT_MATERIAL_DIFFUSE)      uniform sampler2D u_DiffuseMap;
+layout(binding  = TEXTURE_SLOT_MATERIAL_SPECULAR)     uniform sampler2D u_SpecularMap;
+layout(binding  = TEXTURE_SLOT_MATERIAL_EMISSION_MAP) uniform sampler2D u_EmissionMap;
+layout(binding  = TEXTURE_SLOT_MATERIAL_NORMAL_MAP)   uniform sampler2D u_NormalMap;
+
+/* Maps code is compiled only for maps, used by shader variant, so their flags are not checked. */
+#define IS_MATERIAL_MAP(IsMap) true
+#endif /* MATERIAL_STORAGE */
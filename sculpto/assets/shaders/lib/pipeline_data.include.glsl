@@ -1,3 +1,6 @@
+#pragma once
+#include "binding_points.include.glsl"
+
 /* Scene rendering data. */
 layout(std140, binding = BINDING_POINT_SCENE_DATA) uniform ubo_PipelineData {
     vec3  u_CameraPosition;       /* Submission camera direction vector. */
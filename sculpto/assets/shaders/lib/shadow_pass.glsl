@@ -0,0 +1,24 @@
+#version 460
+
+#shader-begin vert
+    layout (location = 0) in vec3 v_Pos;
+    #ifdef INDIRECT_DRAW
+    #include "indirect_draw_data.include.glsl"
+    uniform mat4 u_MatrVP;
+    #else
+    uniform mat4 u_MatrWVP;
+    #endif /* INDIRECT_DRAW */
+
+    void main()
+    {
+    #ifdef INDIRECT_DRAW
+        gl_Position = u_MatrVP * GetDrawData().World * vec4(v_Pos, 1.0);
+    #else
+        gl_Position = u_MatrWVP * vec4(v_Pos, 1.0);
+    #endif /* INDIRECT_DRAW */
+    }
+#shader-end
+
+#shader-begin frag
+    void main() {}
+#shader-end
\ No newline at end of file
@@ -46,7 +46,12 @@
         float phi = atan(dir.x, -dir.z);
         vec2 c = vec2(phi / 2 / PI, theta / PI);
 
-        vec4 tc = texture(u_Texture, c);
+        // Longitude wraps from 0.5 to -0.5 behind camera, so its screen derivatives are taken modulo 1
+        // (otherwise the smallest mip level is sampled along the wrap line).
+        vec2 c_dx = dFdx(c), c_dy = dFdy(c);
+        c_dx.x -= round(c_dx.x);
+        c_dy.x -= round(c_dy.x);
+        vec4 tc = textureGrad(u_Texture, c, c_dx, c_dy);
         OutColor = vec4(tc.rgb, 1);
         OutDiffuse = vec4(0, 0, 0, 1);
         OutShininessIsShadeIsBloomed = vec4(0, 0, 0, 1);
@@ -47,6 +47,9 @@ namespace scl
     using matr3_data = math::matr3_data<float>;
     using matr4      = math::matr4<float>;
     using matr4_data = math::matr4_data<float>;
+    using bound_box  = math::bound_box<float>;
+    using ray        = math::ray<float>;
+    using frustum    = math::frustum<float>;
 
     /*! Windows platform specific types */
 #ifdef SCL_PLATFORM_WINDOWS
@@ -13,6 +13,9 @@
 #include "application.h"
 #include "../render/render_bridge.h"
 #include "../render/renderer.h"
+#include "utilities/assets_manager/async_load.h"
+#include "utilities/assets_manager/hot_reload.h"
+#include "utilities/assets_manager/asset_registry.h"
 
 scl::application *scl::application::Instance = nullptr;
 
@@ -61,6 +64,18 @@ void scl::application::LoopIterationActions()
         gui::SubmitUpdate();
     }
 
+    // Upload asynchronously loaded assets to GPU
+    assets_manager::UpdateAsyncLoads(AssetsUploadBudget);
+    assets_manager::UpdateHotReload();
+
+    // Registry keeps entries of freed assets until they are collected.
+    AssetsGarbageCollectionTime += timer::GetDeltaTime();
+    if (AssetsGarbageCollectionTime >= AssetsGarbageCollectionPeriod)
+    {
+        assets_manager::asset_registry::Get().CollectGarbage();
+        AssetsGarbageCollectionTime = 0;
+    }
+
     // Update application
     OnUpdate(timer::GetDeltaTime());
 
@@ -31,11 +31,14 @@ namespace scl
     private: /*! Application data. */
         static application *Instance;            /*! Global application instance. */
 
-        bool           IsRunning { true };  /*! Application main loop running flag. */
-        unique<window> Window {};           /*! Main app window. */
+        bool           IsRunning { true };               /*! Application main loop running flag. */
+        unique<window> Window {};                        /*! Main app window. */
+        float          AssetsGarbageCollectionTime {};   /*! Time since last freed assets registry entries removal (in seconds). */
 
     public:
-        bool GuiEnabled { false };          /*! Application graphic user interface enabled flag. If false do not rendering gui. */
+        bool GuiEnabled { false };                  /*! Application graphic user interface enabled flag. If false do not rendering gui. */
+        float AssetsUploadBudget { 4 };             /*! Per-frame time (in milliseconds) for asynchronously loaded assets GPU upload. */
+        float AssetsGarbageCollectionPeriod { 1 };  /*! Time (in seconds) between freed assets registry entries removals. */
 
     public: /*! Applicatino getters/setters functions. */
         /*! Get applciation instance function. */
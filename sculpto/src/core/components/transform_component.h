@@ -22,10 +22,11 @@ namespace scl
         matr4 AnglesMatr {};
         matr4 PositionMatr {};
         matr4 Transform {};
+        u32 Version {}; /*! Transform change counter, incremented on each matrices invalidation. */
 
         transform_component() = default;
         transform_component(const transform_component &Other) = default;
-        transform_component(const matr4 &Tranform) : Transform(Transform) {}
+        transform_component(const matr4 &Transform) : Transform(Transform) {}
         transform_component(const vec3 &Scale, const vec3 &Angles, const vec3 &Position) :
             Scale(Scale), Angles(Angles), Position(Position),
             ScaleMatr(matr4::Scale(Scale)), AnglesMatr(matr4::RotateX(Angles.X) * matr4::RotateY(Angles.Y) * matr4::RotateZ(Angles.Z)),
@@ -49,20 +50,29 @@ namespace scl
             InvalidatePosition();
         }
 
+        void SetTransform(const matr4 &Transform)
+        {
+            this->Transform = Transform;
+            Version++;
+        }
+
         void InvalidateScale()
         {
             ScaleMatr = matr4::Scale(Scale);
             Transform = ScaleMatr * AnglesMatr * PositionMatr;
+            Version++;
         }
         void InvalidateRotation()
         {
             AnglesMatr = matr4::RotateX(Angles.X) * matr4::RotateY(Angles.Y) * matr4::RotateZ(Angles.Z);
             Transform = ScaleMatr * AnglesMatr * PositionMatr;
+            Version++;
         }
         void InvalidatePosition()
         {
             PositionMatr = matr4::Translate(Position);
             Transform = ScaleMatr * AnglesMatr * PositionMatr;
+            Version++;
         }
         void Invalidate()
         {
@@ -70,6 +80,7 @@ namespace scl
             AnglesMatr = matr4::RotateX(Angles.X) * matr4::RotateY(Angles.Y) * matr4::RotateZ(Angles.Z);
             PositionMatr = matr4::Translate(Position);
             Transform = ScaleMatr * AnglesMatr * PositionMatr;
+            Version++;
         }
 
         operator const matr4 &() const { return Transform; }
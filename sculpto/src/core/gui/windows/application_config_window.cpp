@@ -13,7 +13,9 @@
 #include "application_config_window.h"
 #include "core/application/application.h"
 #include "core/render/render_bridge.h"
+#include "core/render/renderer.h"
 #include "core/render/primitives/shader.h"
+#include "core/render/shader_variants.h"
 #include "utilities/assets_manager/shaders_load.h"
 
 void scl::application_config_window::Draw()
@@ -32,6 +34,15 @@ void scl::application_config_window::Draw()
             render_bridge::SetClearColor(clear_color);
         if (ImGui::Checkbox("Wireframe Mode", &is_wireframe)) render_bridge::SetWireframeMode(is_wireframe);
         if (ImGui::Checkbox("VSync", &is_vsync)) render_bridge::SetVSync(is_vsync);
+
+        bool is_cluster_culling = renderer::GetClusterCulling();
+        bool is_indirect_drawing = renderer::GetIndirectDrawing();
+        bool is_materials_storage = renderer::GetMaterialsStorage();
+        if (ImGui::Checkbox("Cluster Culling", &is_cluster_culling)) renderer::SetClusterCulling(is_cluster_culling);
+        if (ImGui::Checkbox("Indirect Drawing (new meshes)", &is_indirect_drawing)) renderer::SetIndirectDrawing(is_indirect_drawing);
+        ImGui::BeginDisabled(!render_bridge::GetBindlessTexturesSupport());
+        if (ImGui::Checkbox("Materials Storage (bindless textures)", &is_materials_storage)) renderer::SetMaterialsStorage(is_materials_storage);
+        ImGui::EndDisabled();
         ImGui::NewLine();
 
         float w = ImGui::GetContentRegionAvail().x;
@@ -40,8 +51,9 @@ void scl::application_config_window::Draw()
         if (ImGui::Button("Reload##shd1", { w * 0.2f, 0 })) assets_manager::UpdateShader(render_bridge::GetGaussianBlurPassShader()); ImGui::SameLine();
         ImGui::Text("Shader \"%s\"", render_bridge::GetGaussianBlurPassShader()->DebugName.c_str());
 
-        if (ImGui::Button("Reload##shd2", { w * 0.2f, 0 })) assets_manager::UpdateShader(render_bridge::GetPhongGeometryShader()); ImGui::SameLine();
-        ImGui::Text("Shader \"%s\"", render_bridge::GetPhongGeometryShader()->DebugName.c_str());
+        if (ImGui::Button("Reload##shd2", { w * 0.2f, 0 })) render_bridge::GetPhongGeometryShaderVariants()->Update(); ImGui::SameLine();
+        ImGui::Text("Shader \"%s\" (%zu variants)", render_bridge::GetPhongGeometryShaderVariants()->GetFilePath().string().c_str(),
+                    render_bridge::GetPhongGeometryShaderVariants()->GetVariantsCount());
 
         if (ImGui::Button("Reload##shd3", { w * 0.2f, 0 })) assets_manager::UpdateShader(render_bridge::GetPhongLightingShader()); ImGui::SameLine();
         ImGui::Text("Shader \"%s\"", render_bridge::GetPhongLightingShader()->DebugName.c_str());
@@ -49,6 +61,9 @@ void scl::application_config_window::Draw()
         if (ImGui::Button("Reload##shd4", { w * 0.2f, 0 })) assets_manager::UpdateShader(render_bridge::GetShadowPassShader()); ImGui::SameLine();
         ImGui::Text("Shader \"%s\"", render_bridge::GetShadowPassShader()->DebugName.c_str());
 
+        if (ImGui::Button("Reload##shd7", { w * 0.2f, 0 })) assets_manager::UpdateShader(render_bridge::GetShadowPassIndirectShader()); ImGui::SameLine();
+        ImGui::Text("Shader \"%s\"", render_bridge::GetShadowPassIndirectShader()->DebugName.c_str());
+
         if (ImGui::Button("Reload##shd5", { w * 0.2f, 0 })) assets_manager::UpdateShader(render_bridge::GetSingleColorMaterialShader()); ImGui::SameLine();
         ImGui::Text("Shader \"%s\"", render_bridge::GetSingleColorMaterialShader()->DebugName.c_str());
 
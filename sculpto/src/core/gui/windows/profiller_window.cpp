@@ -13,6 +13,9 @@
 #include "profiller_window.h"
 #include "core/application/timer.h"
 #include "core/render/render_bridge.h"
+#include "core/render/primitives/texture.h"
+#include "core/resources/mesh.h"
+#include "utilities/assets_manager/asset_registry.h"
 
 void scl::profiller_window::Draw()
 {
@@ -27,7 +30,16 @@ void scl::profiller_window::Draw()
     ImGui::Begin("Profiller");
     {
         ImGui::Text("Average framerate %.1f FPS", timer::GetFps());
-        ImGui::PlotLines("", FPSList.data(), (u32)FPSList.size(), 0, 0, FLT_MAX, FLT_MAX, { ImGui::GetWindowWidth() - 15.0f, ImGui::GetWindowHeight() - 56.0f });
+
+        auto draw_assets_stats = [](const char *AssetsName, const assets_manager::asset_registry::stats &Stats)
+        {
+            ImGui::Text("%s: %zu loaded (%.1f MB), %zu hits, %zu misses", AssetsName,
+                        Stats.ResidentCount, Stats.ResidentBytes / (1024.0f * 1024.0f), Stats.Hits, Stats.Misses);
+        };
+        draw_assets_stats("Textures", assets_manager::asset_registry::Get().GetStats<texture_2d>());
+        draw_assets_stats("Meshes", assets_manager::asset_registry::Get().GetStats<mesh>());
+
+        ImGui::PlotLines("", FPSList.data(), (u32)FPSList.size(), 0, 0, FLT_MAX, FLT_MAX, { ImGui::GetWindowWidth() - 15.0f, ImGui::GetWindowHeight() - 96.0f });
     }
     ImGui::End();
 }
@@ -25,22 +25,35 @@ void scl::scene_hierarchy_window::Draw()
     ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_OpenOnArrow
         | ImGuiTreeNodeFlags_OpenOnDoubleClick
         | ImGuiTreeNodeFlags_SpanAvailWidth;
-    for (auto &&[entity, tag] : Scene->Registry.view<name_component>().each())
+
+    ImGui::SetNextItemWidth(ImGui::GetWindowWidth() - 15);
+    ImGui::InputTextWithHint("##objects_filter", "Filter by name prefix", FilterTextBuffer, 128);
+
+    // Objects could not be removed while name index is iterated, so removal is deferred.
+    bool is_selected_removed = false;
+    auto draw_object = [&](scene_object_handle Entity, const std::string &Name)
     {
-        if (ImGui::Selectable(tag.Name.c_str(), entity == SelectedObject, ImGuiSelectableFlags_None,
-                              { entity == SelectedObject ? ImGui::GetWindowWidth() * 0.6f - 10 : 0, 20 }))
+        if (ImGui::Selectable(Name.c_str(), Entity == SelectedObject, ImGuiSelectableFlags_None,
+                              { Entity == SelectedObject ? ImGui::GetWindowWidth() * 0.6f - 10 : 0, 20 }))
         {
-            SelectedObject = scene_object { entity, Scene };
+            SelectedObject = scene_object { Entity, Scene };
             OnObjectSelect(SelectedObject);
         }
 
-        if (entity == SelectedObject)
+        if (Entity == SelectedObject)
         {
             ImGui::SameLine(ImGui::GetWindowWidth() * 0.6f + 5);
             if (ImGui::Button("Delete##delete_object", { ImGui::GetWindowWidth() * 0.4f - 10, 0 }))
-                Scene->RemoveObject(SelectedObject);
+                is_selected_removed = true;
         }
-    }
+    };
+
+    if (FilterTextBuffer[0] == 0)
+        for (auto &&[entity, tag] : Scene->Registry.view<name_component>().each())
+            draw_object(entity, tag.Name);
+    else
+        Scene->NameIndex.FindByPrefix(FilterTextBuffer, draw_object);
+    if (is_selected_removed) Scene->RemoveObject(SelectedObject);
 
     ImGui::SetNextItemWidth(ImGui::GetWindowWidth() * 0.6f - 5);
     ImGui::InputText("##adding_object_name", ObjectCreationNameTextBuffer, 128);
@@ -22,6 +22,7 @@ namespace scl
         scene_object SelectedObject {};
 
         char ObjectCreationNameTextBuffer[128] {};
+        char FilterTextBuffer[128] {};
 
     public:
         /*!*
@@ -82,7 +82,7 @@ namespace scl
             auto &name = ConfiguringObject.GetComponent<name_component>();
             if (strcmp(NameTextBuffer, name.Name.c_str()) != 0) strcpy_s(NameTextBuffer, name.Name.c_str());
             if (ImGui::InputText("Name", NameTextBuffer, 128))
-                name.Name = std::string(NameTextBuffer);
+                ConfiguringObject.PatchComponent<name_component>([&](name_component &Name) { Name.Name = std::string(NameTextBuffer); });
             ImGui::Separator();
         }
 
@@ -36,6 +36,15 @@ void scl::viewport_window::Draw()
         if (auto viewport_buffer = ViewportBuffer.lock())
             ImGui::Image((ImTextureID)viewport_buffer->GetColorAttachment()->GetHandle(), window_size, {0, 1}, {1, 0});
 
+        // Releasing after dragging (e.g. camera rotation) is not a click.
+        ImGuiIO &io = ImGui::GetIO();
+        if (OnClick && ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Left) &&
+            io.MouseDragMaxDistanceSqr[ImGuiMouseButton_Left] < io.MouseDragThreshold * io.MouseDragThreshold)
+        {
+            ImVec2 image_min = ImGui::GetItemRectMin();
+            OnClick((io.MousePos.x - image_min.x) / window_size.x, (io.MousePos.y - image_min.y) / window_size.y);
+        }
+
         if (ImGui::IsItemHovered()) ImGui::SetNextFrameWantCaptureMouse(false);
         if (ImGui::IsItemActive()) ImGui::SetNextFrameWantCaptureKeyboard(false);
     }
@@ -23,6 +23,7 @@ namespace scl
         int    ViewportId { 30 };
         int    ViewportWidth { 16 };
         int    ViewportHeight { 16 };
+        std::function<void(float X, float Y)> OnClick {};
 
     public: /*! Viewport window data getter/setter functinos. */
         /*! Viewport window viewport id getter function. Viewport resize event invoked with it. */
@@ -33,6 +34,8 @@ namespace scl
         int GetViewportHegith() const { return ViewportHeight; }
 
         void SetViewportBuffer(const shared<frame_buffer> &ViewportBuffer) { this->ViewportBuffer = ViewportBuffer; }
+        /*! Viewport click (left mouse button release without dragging) callback setter function. Click point is passed in range [0; 1] from top left corner. */
+        void SetOnClick(const std::function<void(float X, float Y)> &OnClick) { this->OnClick = OnClick; }
         /*! Viewport window viewport id setter function. Viewport resize event invoked with it. */
         void SetViewportId(int ViewportId) {
             SCL_CORE_ASSERT(ViewportId != 0, "ViewportId = 0 is not allowed, it is reserved by main application window.");
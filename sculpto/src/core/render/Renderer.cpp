@@ -18,25 +18,117 @@
 #include "core/application/timer.h"
 #include "core/resources/mesh.h"
 #include "core/resources/materials/material.h"
+#include "core/resources/materials/material_phong.h"
+#include "core/resources/materials/material_single_color.h"
 #include "core/resources/topology/full_screen_quad.h"
 
 #include "platform/opengl/gl.h"
 
+namespace scl
+{
+    /*! Index of material, which could not be drawn indirectly, in pipeline indirect materials indices. */
+    static constexpr u32 INVALID_MATERIAL_INDEX = ~0u;
+}
+
 scl::render_pipeline scl::renderer::Pipeline {};
 
+float scl::renderer::GetLodMaxError(const bound_box &Box, const matr4 &Transform)
+{
+    if (Box.IsEmpty() || Pipeline.LodPixelError <= 0) return 0;
+
+    // Bound sphere radius is scaled by largest transformation axis scale.
+    float scale = math::Max(math::Max(Transform.TransformVector({ 1, 0, 0 }).Length(),
+                                      Transform.TransformVector({ 0, 1, 0 }).Length()),
+                            Transform.TransformVector({ 0, 0, 1 }).Length());
+    float radius = Box.GetSize().Length() * 0.5f;
+    float world_radius = radius * scale;
+
+    float projected_radius = world_radius * Pipeline.LodPixelsPerUnit;
+    if (Pipeline.IsLodPerspective)
+    {
+        float distance = (Transform.TransformPoint(Box.GetCenter()) - Pipeline.Data.CameraPosition).Length() - world_radius;
+        if (distance <= 0) return 0;
+        projected_radius /= distance;
+    }
+    if (projected_radius <= 0) return 0;
+
+    return Pipeline.LodPixelError * radius / projected_radius;
+}
+
+scl::u32 scl::renderer::CullMeshlets(const mesh::submesh_data &Submesh, const matr4 &Transform, const matr4 &WVP)
+{
+    // Meshlets bounds are in mesh space, so frustum and camera are transformed to it instead.
+    frustum mesh_frustum(WVP);
+    vec3 camera_position = Transform.Inverse().TransformPoint(Pipeline.Data.CameraPosition);
+    bool is_backface_culling = Pipeline.IsLodPerspective && render_bridge::GetCullingMode() == render_cull_face_mode::BACK;
+
+    std::vector<index_range> &ranges = Pipeline.ClusterRanges;
+    ranges.clear();
+    u32 visible_indices_count = 0;
+    for (const auto &meshlet : Submesh.Meshlets)
+    {
+        if (!topology::IsMeshletVisible(meshlet, mesh_frustum, camera_position, is_backface_culling)) continue;
+
+        visible_indices_count += meshlet.IndicesCount;
+        if (!ranges.empty() && ranges.back().FirstIndex + ranges.back().Count == meshlet.FirstIndex)
+            ranges.back().Count += meshlet.IndicesCount;
+        else
+            ranges.push_back({ meshlet.FirstIndex, meshlet.IndicesCount });
+    }
+    return visible_indices_count;
+}
+
+void scl::renderer::DrawMeshlets(const mesh::submesh_data &Submesh, const matr4 &Transform, const matr4 &WVP)
+{
+    u32 visible_indices_count = CullMeshlets(Submesh, Transform, WVP);
+
+    if (Pipeline.ClusterRanges.empty()) return;
+    if (visible_indices_count == Submesh.IndexBuffer->GetCount())
+        render_bridge::DrawIndices(Submesh.VertexArray);
+    else
+        render_bridge::DrawIndicesRanges(Submesh.VertexArray, Pipeline.ClusterRanges);
+}
+
+void scl::renderer::DrawSubmeshDepth(const mesh::submesh_data &Submesh, const matr4 &Transform)
+{
+    // Currently local tranform matrix is usless.
+    // matr4 world = submesh.LocalTransform * Transform;
+
+    Pipeline.ShadowPassShader->SetMatr4("u_MatrWVP", Transform * matr4(Pipeline.LightsStorage.DirectionalLight.ViewProjection));
+    render_bridge::DrawIndices(Submesh.GetLodVertexArray(GetLodMaxError(Submesh.BoundBox, Transform)));
+}
+
 void scl::renderer::DrawDepth(const shared<mesh> &Mesh, const matr4 &Transform)
 {
     if (!Mesh->IsCastingShadow) return;
 
     Pipeline.ShadowPassShader->Bind();
     for (auto &submesh : Mesh->SubMeshes)
-    {
-        // Currently local tranform matrix is usless.
-        // matr4 world = submesh.LocalTransform * Transform;
+        DrawSubmeshDepth(submesh, Transform);
+}
 
-        Pipeline.ShadowPassShader->SetMatr4("u_MatrWVP", Transform * matr4(Pipeline.LightsStorage.DirectionalLight.ViewProjection));
-        render_bridge::DrawIndices(submesh.VertexArray);
-    }
+void scl::renderer::DrawSubmeshGeometry(const mesh::submesh_data &Submesh, const matr4 &Transform)
+{
+    // matr4 world = submesh.LocalTransform * Transform;
+
+    // Sub-meshes with still compiling material shader are skipped instead of waiting for compilation.
+    if (!Submesh.Material->Shader->IsReady()) return;
+    if (const uniform_block_layout *layout = Submesh.Material->GetDataLayout())
+        ValidateUniformBlock(Submesh.Material->Shader, "ubo_Material", *layout);
+
+    Submesh.Material->Bind();
+    Submesh.Material->Shader->SetMatr3("u_MatrN", matr3(Transform.Inverse().Transpose()));
+    Submesh.Material->Shader->SetMatr4("u_MatrW", Transform);
+    matr4 wvp = Transform * Pipeline.ViewProjection;
+    Submesh.Material->Shader->SetMatr4("u_MatrWVP", wvp);
+
+    // Only full detail sub-mesh is clustered, levels of detail are drawn whole.
+    const shared<vertex_array> &lod_vertex_array = Submesh.GetLodVertexArray(GetLodMaxError(Submesh.BoundBox, Transform));
+    if (Pipeline.IsClusterCulling && !Submesh.Meshlets.empty() && lod_vertex_array == Submesh.VertexArray)
+        DrawMeshlets(Submesh, Transform, wvp);
+    else
+        render_bridge::DrawIndices(lod_vertex_array);
+    Submesh.Material->Unbind();
 }
 
 void scl::renderer::DrawGeometry(const shared<mesh> &Mesh, const matr4 &Transform)
@@ -44,16 +136,70 @@ void scl::renderer::DrawGeometry(const shared<mesh> &Mesh, const matr4 &Transfor
     if (!Mesh->IsDrawing) return;
 
     for (auto &submesh : Mesh->SubMeshes)
+        DrawSubmeshGeometry(submesh, Transform);
+}
+
+bool scl::renderer::AddIndirectDraw(indirect_draw_list &List, const mesh::submesh_data &Submesh, const matr4 &Transform,
+                                    u32 MaterialIndex, bool IsClusterCulling)
+{
+    const geometry_arena_allocation &allocation = Submesh.ArenaAllocation;
+    if (!allocation.IsAllocated()) return false;
+
+    // Levels of detail, which did not fit in arena page, are drawn directly.
+    int lod = Submesh.GetLodIndex(GetLodMaxError(Submesh.BoundBox, Transform));
+    if (lod >= 0)
+    {
+        if (Submesh.Lods[lod].ArenaIndices.Count == 0) return false;
+        List.Add(allocation.Page, MaterialIndex, Submesh.Lods[lod].ArenaIndices, allocation.BaseVertex, Transform);
+        return true;
+    }
+
+    // Visible meshlets ranges are relative to sub-mesh indices, so they are offset to its arena range.
+    if (IsClusterCulling && Pipeline.IsClusterCulling && !Submesh.Meshlets.empty())
     {
-        // matr4 world = submesh.LocalTransform * Transform;
-
-        submesh.Material->Bind();
-        submesh.Material->Shader->SetMatr3("u_MatrN", matr3(Transform.Inverse().Transpose()));
-        submesh.Material->Shader->SetMatr4("u_MatrW", Transform);
-        submesh.Material->Shader->SetMatr4("u_MatrWVP", Transform * Pipeline.ViewProjection);
-        render_bridge::DrawIndices(submesh.VertexArray);
-        submesh.Material->Unbind();
+        CullMeshlets(Submesh, Transform, Transform * Pipeline.ViewProjection);
+        for (const index_range &range : Pipeline.ClusterRanges)
+            List.Add(allocation.Page, MaterialIndex, { allocation.Indices.FirstIndex + range.FirstIndex, range.Count },
+                     allocation.BaseVertex, Transform);
+        return true;
     }
+
+    List.Add(allocation.Page, MaterialIndex, allocation.Indices, allocation.BaseVertex, Transform);
+    return true;
+}
+
+bool scl::renderer::GetIndirectMaterialIndex(const material *Material, bool IsMaterialsStorage, u32 &OutIndex)
+{
+    auto [material_index, is_inserted] = Pipeline.IndirectMaterialsIndices.try_emplace(Material, INVALID_MATERIAL_INDEX);
+    if (is_inserted)
+    {
+        // Materials, which could not be drawn indirectly, are remembered too, so they are checked once per frame.
+        material_storage_data data {};
+        shared<shader_program> indirect_shader = IsMaterialsStorage ? nullptr : Material->GetIndirectShader();
+        bool is_indirect = IsMaterialsStorage ? Material->GetStorageData(data) :
+                                                indirect_shader != nullptr && indirect_shader->IsReady();
+        if (is_indirect && indirect_shader != nullptr)
+            if (const uniform_block_layout *layout = Material->GetDataLayout())
+                ValidateUniformBlock(indirect_shader, "ubo_Material", *layout);
+        if (is_indirect)
+        {
+            material_index->second = (u32)Pipeline.IndirectMaterials.size();
+            Pipeline.IndirectMaterials.push_back(Material);
+            if (IsMaterialsStorage) Pipeline.MaterialsStorage.push_back(data);
+        }
+    }
+
+    OutIndex = material_index->second;
+    return OutIndex != INVALID_MATERIAL_INDEX;
+}
+
+void scl::renderer::UploadIndirectDraws(indirect_draw_list &List, const shared<storage_buffer> &CommandsBuffer,
+                                        const shared<storage_buffer> &DrawDataBuffer, bool IsSplitByMaterial)
+{
+    List.Build(IsSplitByMaterial);
+    CommandsBuffer->Update(0, List.GetCommands().data(), (u32)(List.GetCommands().size() * sizeof(draw_indirect_command)));
+    DrawDataBuffer->Update(0, List.GetDrawData().data(), (u32)(List.GetDrawData().size() * sizeof(indirect_draw_data)));
+    DrawDataBuffer->Bind(render_context::BINDING_POINT_DRAW_DATA);
 }
 
 void scl::renderer::DrawFullscreenQuad()
@@ -68,6 +214,8 @@ void scl::renderer::DrawFullscreenQuad()
 
 void scl::renderer::ApplyTexture(const shared<frame_buffer> &Destination, const shared<texture_2d> &SourceTexture)
 {
+    if (!Pipeline.TextureAddShader->IsReady()) return;
+
     Pipeline.TextureAddShader->Bind();
     Destination->GetColorAttachment()->Bind(render_context::TEXTURE_SLOT_APPLY_SOURCE);
     SourceTexture->Bind(render_context::TEXTURE_SLOT_APPLY_TEXTURE_ADD);
@@ -79,6 +227,8 @@ void scl::renderer::ApplyTexture(const shared<frame_buffer> &Destination, const
 
 void scl::renderer::ApplyBluredTexture(const shared<frame_buffer> &Destination, const shared<texture_2d> &Source, int Iterations)
 {
+    if (!Pipeline.GaussianBlurApplyShader->IsReady()) return;
+
     Pipeline.GaussianBlurApplyShader->Bind();
     for (int i = 0; i < Iterations; i++)
     {
@@ -101,12 +251,39 @@ void scl::renderer::ApplyBluredTexture(const shared<frame_buffer> &Destination,
 
 void scl::renderer::ComputeDepth()
 {
+    if (!Pipeline.ShadowPassShader->IsReady()) return;
+
     Pipeline.ShadowPassShader->Bind();
 
     Pipeline.ShadowMap->Clear();
     Pipeline.ShadowMap->Bind();
+
+    // Sub-meshes in geometry arena are collected and drawn with one call per arena page after direct draws.
+    bool is_indirect = geometry_arena::Get().GetEnabled() && Pipeline.ShadowPassIndirectShader->IsReady();
+    auto draw_depth = [&](const submission &Submission)
+    {
+        if (!Submission.Mesh->IsCastingShadow) return;
+        for (auto &submesh : Submission.Mesh->SubMeshes)
+            if (!is_indirect || !AddIndirectDraw(Pipeline.DepthDrawList, submesh, Submission.Transform, 0, false))
+                DrawSubmeshDepth(submesh, Submission.Transform);
+    };
     for (const submission &subm : Pipeline.SubmissionsList)
-        renderer::DrawDepth(subm.Mesh, subm.Transform);
+        draw_depth(subm);
+    for (const submission &subm : Pipeline.ShadowCastersList)
+        draw_depth(subm);
+
+    if (Pipeline.DepthDrawList.GetDrawsCount() > 0)
+    {
+        UploadIndirectDraws(Pipeline.DepthDrawList, Pipeline.DepthDrawCommandsBuffer, Pipeline.DepthDrawDataBuffer, false);
+        Pipeline.ShadowPassIndirectShader->Bind();
+        Pipeline.ShadowPassIndirectShader->SetMatr4("u_MatrVP", matr4(Pipeline.LightsStorage.DirectionalLight.ViewProjection));
+        for (const indirect_draw_batch &batch : Pipeline.DepthDrawList.GetBatches())
+        {
+            Pipeline.ShadowPassIndirectShader->SetUInt("u_FirstDraw", batch.FirstDraw);
+            render_bridge::DrawIndicesIndirect(geometry_arena::Get().GetVertexArray(batch.Page), Pipeline.DepthDrawCommandsBuffer,
+                                               batch.FirstDraw, batch.DrawsCount);
+        }
+    }
     Pipeline.ShadowMap->Unbind();
 }
 
@@ -114,15 +291,76 @@ void scl::renderer::ComputeGeometry()
 {
     Pipeline.GBuffer->Clear();
     Pipeline.GBuffer->Bind();
+
+    // Sub-meshes in geometry arena with indirectly drawable material are collected and drawn after direct draws
+    // with one call per arena page (if materials storage is used) or per arena page and material.
+    bool is_indirect = geometry_arena::Get().GetEnabled();
+    shared<shader_program> materials_storage_shader {};
+    if (is_indirect && Pipeline.IsMaterialsStorage && render_bridge::GetBindlessTexturesSupport())
+        materials_storage_shader = render_bridge::GetPhongGeometryShaderVariants()->GetVariant(render_context::PHONG_FEATURE_INDIRECT_DRAW |
+                                                                                               render_context::PHONG_FEATURE_MATERIAL_STORAGE);
+    bool is_materials_storage = materials_storage_shader != nullptr && materials_storage_shader->IsReady();
+
     for (const submission &subm : Pipeline.SubmissionsList)
-        renderer::DrawGeometry(subm.Mesh, subm.Transform);
+    {
+        if (!subm.Mesh->IsDrawing) continue;
+        for (auto &submesh : subm.Mesh->SubMeshes)
+        {
+            u32 material_index = 0;
+            if (is_indirect && submesh.ArenaAllocation.IsAllocated() &&
+                GetIndirectMaterialIndex(submesh.Material.get(), is_materials_storage, material_index) &&
+                AddIndirectDraw(Pipeline.GeometryDrawList, submesh, subm.Transform, material_index, true)) continue;
+            DrawSubmeshGeometry(submesh, subm.Transform);
+        }
+    }
+
+    if (Pipeline.GeometryDrawList.GetDrawsCount() > 0 && is_materials_storage)
+    {
+        UploadIndirectDraws(Pipeline.GeometryDrawList, Pipeline.GeometryDrawCommandsBuffer, Pipeline.GeometryDrawDataBuffer, false);
+        Pipeline.MaterialsStorageBuffer->Update(0, Pipeline.MaterialsStorage.data(), (u32)(Pipeline.MaterialsStorage.size() * sizeof(material_storage_data)));
+        Pipeline.MaterialsStorageBuffer->Bind(render_context::BINDING_POINT_MATERIALS_STORAGE);
+
+        materials_storage_shader->Bind();
+        materials_storage_shader->SetMatr4("u_MatrVP", Pipeline.ViewProjection);
+        for (const indirect_draw_batch &batch : Pipeline.GeometryDrawList.GetBatches())
+        {
+            materials_storage_shader->SetUInt("u_FirstDraw", batch.FirstDraw);
+            render_bridge::DrawIndicesIndirect(geometry_arena::Get().GetVertexArray(batch.Page), Pipeline.GeometryDrawCommandsBuffer,
+                                               batch.FirstDraw, batch.DrawsCount);
+        }
+        materials_storage_shader->Unbind();
+    }
+    else if (Pipeline.GeometryDrawList.GetDrawsCount() > 0)
+    {
+        UploadIndirectDraws(Pipeline.GeometryDrawList, Pipeline.GeometryDrawCommandsBuffer, Pipeline.GeometryDrawDataBuffer, true);
+        for (const indirect_draw_batch &batch : Pipeline.GeometryDrawList.GetBatches())
+        {
+            // Material binds its data buffer and textures only (its own shader could be still compiling), drawing is done by its indirect shader variant.
+            const material *batch_material = Pipeline.IndirectMaterials[batch.MaterialIndex];
+            shared<shader_program> indirect_shader = batch_material->GetIndirectShader();
+            batch_material->BindData();
+            indirect_shader->Bind();
+            indirect_shader->SetMatr4("u_MatrVP", Pipeline.ViewProjection);
+            indirect_shader->SetUInt("u_FirstDraw", batch.FirstDraw);
+            render_bridge::DrawIndicesIndirect(geometry_arena::Get().GetVertexArray(batch.Page), Pipeline.GeometryDrawCommandsBuffer,
+                                               batch.FirstDraw, batch.DrawsCount);
+            batch_material->Unbind();
+        }
+    }
     Pipeline.GBuffer->Unbind();
 }
 
 void scl::renderer::ComputateLighting()
 {
-    if (Pipeline.Data.IsHDR) Pipeline.HDRFrameBuffer->Clear(),  Pipeline.HDRFrameBuffer->Bind();
-    else                     Pipeline.MainFrameBuffer->Clear(), Pipeline.MainFrameBuffer->Bind();
+    if (Pipeline.Data.IsHDR) Pipeline.HDRFrameBuffer->Clear();
+    else                     Pipeline.MainFrameBuffer->Clear();
+    if (!Pipeline.PhongLightingApplyShader->IsReady()) return;
+    static const uniform_block_layout pipeline_data_layout = pipeline_data::GetLayout(), lights_storage_layout = lights_storage::GetLayout();
+    ValidateUniformBlock(Pipeline.PhongLightingApplyShader, "ubo_PipelineData", pipeline_data_layout);
+    ValidateUniformBlock(Pipeline.PhongLightingApplyShader, "ubo_LightsStorage", lights_storage_layout);
+
+    if (Pipeline.Data.IsHDR) Pipeline.HDRFrameBuffer->Bind();
+    else                     Pipeline.MainFrameBuffer->Bind();
 
     Pipeline.PhongLightingApplyShader->Bind();
     Pipeline.GBuffer->GetColorAttachment(render_context::COLOR_ATTACHMENT_GEOM_PASS_OUT_POSITION       )->Bind(render_context::TEXTURE_SLOT_GEOM_PASS_OUT_POSITION       );
@@ -157,7 +395,9 @@ void scl::renderer::ComputeBloom()
 
 void scl::renderer::ComputeToneMapping()
 {
-    Pipeline.MainFrameBuffer->Clear(), Pipeline.MainFrameBuffer->Bind();
+    Pipeline.MainFrameBuffer->Clear();
+    if (!Pipeline.ToneMappingApplyShader->IsReady()) return;
+    Pipeline.MainFrameBuffer->Bind();
 
     Pipeline.ToneMappingApplyShader->Bind();
     Pipeline.ToneMappingApplyShader->SetFloat("u_Exposure", Pipeline.Data.Exposure);
@@ -168,6 +408,23 @@ void scl::renderer::ComputeToneMapping()
     Pipeline.MainFrameBuffer->Unbind();
 }
 
+void scl::renderer::ValidateUniformBlock(const shared<shader_program> &Shader, const std::string &BlockName, const uniform_block_layout &Layout)
+{
+#ifndef SCL_DIST
+    static std::set<std::pair<render_primitive::handle, std::string>> validated_blocks {};
+    if (!validated_blocks.emplace(Shader->GetHandle(), BlockName).second) return;
+
+    uniform_block_layout shader_layout {};
+    if (!Shader->GetUniformBlockLayout(BlockName, shader_layout)) return;
+
+    std::vector<std::string> mismatches = Layout.GetMismatches(shader_layout);
+    for (const std::string &mismatch : mismatches)
+        SCL_CORE_ERROR("Uniform block \"{}\" of shader \"{}\" layout mismatch: {}.", BlockName, Shader->DebugName, mismatch);
+    if (mismatches.empty())
+        SCL_CORE_INFO("Uniform block \"{}\" of shader \"{}\" layout validated.", BlockName, Shader->DebugName);
+#endif /*! SCL_DIST */
+}
+
 void scl::renderer::Initialize()
 {
     Pipeline.Initalize();
@@ -175,7 +432,7 @@ void scl::renderer::Initialize()
 
 void scl::renderer::StartPipeline(const camera &Camera, const vec3 &EnviromentAmbient)
 {
-    if (!Pipeline.IsInitialized) Pipeline.Initalize();
+    if (!Pipeline.IsInitialized) Initialize();
 
     Pipeline.Data.Time = timer::GetTime();
     Pipeline.Data.EnviromentAmbient = EnviromentAmbient;
@@ -187,6 +444,9 @@ void scl::renderer::StartPipeline(const camera &Camera, const vec3 &EnviromentAm
     Pipeline.Data.CameraUpDirection    = Camera.GetUpDirection();
     Pipeline.Data.CameraRightDirection = Camera.GetRightDirection();
     Pipeline.ViewProjection            = Camera.GetViewProjection();
+    Pipeline.IsLodPerspective          = Camera.GetProjectionType() == camera_projection_type::PERSPECTIVE;
+    Pipeline.LodPixelsPerUnit          = Camera.GetViewportHeight() / Camera.GetViewportProjectionHeight() *
+                                         (Pipeline.IsLodPerspective ? Camera.GetProjectionDistance() : 1);
     Pipeline.Data.Exposure             = Camera.Effects.Exposure;
     Pipeline.Data.IsHDR                = Camera.Effects.HDR;
     Pipeline.Data.IsBloom              = Camera.Effects.Bloom;
@@ -267,3 +527,8 @@ void scl::renderer::Submit(const shared<mesh> &Mesh, const matr4 &Transform)
 {
     Pipeline.SubmissionsList.emplace_back<submission>({ Mesh, Transform });
 }
+
+void scl::renderer::SubmitShadowCaster(const shared<mesh> &Mesh, const matr4 &Transform)
+{
+    Pipeline.ShadowCastersList.emplace_back<submission>({ Mesh, Transform });
+}
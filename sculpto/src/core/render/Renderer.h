@@ -11,6 +11,7 @@
 
 #include "render_pipeline.h"
 #include "core/resources/camera.h"
+#include "core/resources/mesh.h"
 
 namespace scl
 {
@@ -51,6 +52,94 @@ namespace scl
         static void DrawFullscreenQuad();
 
     private:
+        /*!*
+         * Evaluate maximum allowed level of detail geometric error of sub-mesh function.
+         * Projected size of sub-mesh bound sphere is used, so error is not larger than pipeline pixel error on screen.
+         *
+         * \param Box - sub-mesh bound box in mesh space.
+         * \param Transform - mesh transformation matrix.
+         * \return maximum allowed error in mesh space units.
+         */
+        static float GetLodMaxError(const bound_box &Box, const matr4 &Transform);
+
+        /*!*
+         * Cull full detail sub-mesh meshlets function.
+         * Meshlets outside of camera frustum or facing away from camera (if back faces are culled) are skipped,
+         * adjacent visible meshlets are merged to single index range. Ranges are stored in pipeline cluster ranges.
+         *
+         * \param Submesh - clustered sub-mesh to cull.
+         * \param Transform - mesh transformation matrix.
+         * \param WVP - mesh world view projection matrix.
+         * \return visible meshlets indices count.
+         */
+        static u32 CullMeshlets(const mesh::submesh_data &Submesh, const matr4 &Transform, const matr4 &WVP);
+
+        /*!*
+         * Draw full detail sub-mesh by its visible meshlets function.
+         *
+         * \param Submesh - clustered sub-mesh to draw.
+         * \param Transform - mesh transformation matrix.
+         * \param WVP - mesh world view projection matrix.
+         * \return None.
+         */
+        static void DrawMeshlets(const mesh::submesh_data &Submesh, const matr4 &Transform, const matr4 &WVP);
+
+        /*!*
+         * Draw sub-mesh geometry (for geometry pass) function.
+         *
+         * \param Submesh - sub-mesh to draw.
+         * \param Transform - mesh tranformations matrix.
+         * \return None.
+         */
+        static void DrawSubmeshGeometry(const mesh::submesh_data &Submesh, const matr4 &Transform);
+
+        /*!*
+         * Draw sub-mesh depth only (for shadow pass) function.
+         * Shadow pass shader should be binded.
+         *
+         * \param Submesh - sub-mesh to draw.
+         * \param Transform - mesh tranformations matrix.
+         * \return None.
+         */
+        static void DrawSubmeshDepth(const mesh::submesh_data &Submesh, const matr4 &Transform);
+
+        /*!*
+         * Add sub-mesh, allocated in geometry arena, to indirect draw list function.
+         * Level of detail (or visible meshlets of full detail sub-mesh) is selected same way as for direct drawing.
+         *
+         * \param List - indirect draw list to add sub-mesh draws to.
+         * \param Submesh - sub-mesh to add.
+         * \param Transform - mesh transformation matrix.
+         * \param MaterialIndex - sub-mesh material index in pipeline indirect materials list.
+         * \param IsClusterCulling - wheather full detail clustered sub-mesh is culled by meshlets or not.
+         * \return wheather sub-mesh was added or not (it is not in arena and should be drawn directly).
+         */
+        static bool AddIndirectDraw(indirect_draw_list &List, const mesh::submesh_data &Submesh, const matr4 &Transform,
+                                    u32 MaterialIndex, bool IsClusterCulling);
+
+        /*!*
+         * Get index of geometry pass indirect draws material (add it to pipeline indirect materials list on first call in frame) function.
+         *
+         * \param Material - material to get index of.
+         * \param IsMaterialsStorage - wheather material is drawn with materials storage or by its own indirect shader.
+         * \param OutIndex - material index in pipeline indirect materials list.
+         * \return wheather material could be drawn indirectly or not.
+         */
+        static bool GetIndirectMaterialIndex(const material *Material, bool IsMaterialsStorage, u32 &OutIndex);
+
+        /*!*
+         * Build indirect draw list and upload its commands and draws data to storage buffers function.
+         * Draws data buffer is binded to draw data binding point.
+         *
+         * \param List - indirect draw list to upload.
+         * \param CommandsBuffer - storage buffer to upload draw commands to.
+         * \param DrawDataBuffer - storage buffer to upload draws data to.
+         * \param IsSplitByMaterial - wheather draws of different materials are split to different batches.
+         * \return None.
+         */
+        static void UploadIndirectDraws(indirect_draw_list &List, const shared<storage_buffer> &CommandsBuffer,
+                                        const shared<storage_buffer> &DrawDataBuffer, bool IsSplitByMaterial);
+
         /*!*
          * Add texture colors to main color attachment of detination frame buffer function.
          *
@@ -112,9 +201,22 @@ namespace scl
          */
         static void ComputeToneMapping();
 
+        /*!*
+         * Validate constant buffer data structure layout against uniform block of shader program function.
+         * Called for ready programs only, so validation never waits for compilation. Each linked program
+         * (updated program is linked anew) is validated once, mismatches are reported to log.
+         *
+         * \param Shader - ready shader program to validate uniform block of.
+         * \param BlockName - uniform block name.
+         * \param Layout - constant buffer data structure layout.
+         * \return None.
+         */
+        static void ValidateUniformBlock(const shared<shader_program> &Shader, const std::string &BlockName, const uniform_block_layout &Layout);
+
     public: /*! Renderer API functions. */
         /*!*
          * Renderer initialization function.
+         * Called automatically on first pipeline start.
          * 
          * \param None.
          * \return None.
@@ -131,6 +233,55 @@ namespace scl
          */
         static void StartPipeline(const camera &Camera, const vec3 &EnviromentAmbiente);
 
+        /*! Maximum allowed geometric error of drawn meshes levels of detail on screen (in pixels) getter function. */
+        static float GetLodPixelError() { return Pipeline.LodPixelError; }
+
+        /*!*
+         * Maximum allowed geometric error of drawn meshes levels of detail on screen setter function.
+         *
+         * \param LodPixelError - maximum error in pixels (zero to always draw full detail meshes).
+         * \return None.
+         */
+        static void SetLodPixelError(float LodPixelError) { Pipeline.LodPixelError = LodPixelError; }
+
+        /*! Sub-meshes clusters (meshlets) culling enabled flag getter function. */
+        static bool GetClusterCulling() { return Pipeline.IsClusterCulling; }
+
+        /*!*
+         * Sub-meshes clusters (meshlets) culling enabled flag setter function.
+         *
+         * \param IsClusterCulling - wheather clustered sub-meshes are drawn by visible meshlets only.
+         * \return None.
+         */
+        static void SetClusterCulling(bool IsClusterCulling) { Pipeline.IsClusterCulling = IsClusterCulling; }
+
+        /*! Indirect drawing (of meshes in geometry arena) enabled flag getter function. */
+        static bool GetIndirectDrawing() { return geometry_arena::Get().GetEnabled(); }
+
+        /*!*
+         * Indirect drawing enabled flag setter function.
+         * Geometry of meshes, created while indirect drawing is enabled, is allocated in geometry arena and
+         * drawn with one multi draw indirect call per arena page and material. Other meshes are drawn directly.
+         *
+         * \param IsIndirectDrawing - wheather created meshes are drawn indirectly.
+         * \return None.
+         */
+        static void SetIndirectDrawing(bool IsIndirectDrawing) { geometry_arena::Get().SetEnabled(IsIndirectDrawing); }
+
+        /*! Materials storage enabled flag getter function. */
+        static bool GetMaterialsStorage() { return Pipeline.IsMaterialsStorage; }
+
+        /*!*
+         * Materials storage enabled flag setter function.
+         * Data of indirectly drawn materials is stored in one storage buffer and maps are sampled by bindless handles,
+         * so all indirect draws of arena page are drawn with single call without material binds.
+         * Used only if render context supports bindless textures, otherwise materials are bound per indirect draws batch.
+         *
+         * \param IsMaterialsStorage - wheather materials storage is used for indirect draws.
+         * \return None.
+         */
+        static void SetMaterialsStorage(bool IsMaterialsStorage) { Pipeline.IsMaterialsStorage = IsMaterialsStorage; }
+
         /*!*
          * End render pass function.
          * Flush render_pass_submission quque and draw all meshes to specified frame buffer function.
@@ -196,5 +347,14 @@ namespace scl
          * \return None.
          */
         static void Submit(const shared<mesh> &Mesh, const matr4 &Transform);
+
+        /*!*
+         * Submit mesh, which is not visible by camera, but could cast shadows, to render_pass_submission queue function.
+         *
+         * \param Mesh - mesh to submit to queue.
+         * \param Transform - mesh tranformations matrix.
+         * \return None.
+         */
+        static void SubmitShadowCaster(const shared<mesh> &Mesh, const matr4 &Transform);
     };
 }
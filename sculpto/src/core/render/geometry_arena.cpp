@@ -0,0 +1,92 @@
+/*!****************************************************************//*!*
+ * \file   geometry_arena.cpp
+ * \brief  Shared vertex and index buffers (geometry arena) class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "geometry_arena.h"
+#include "primitives/buffer.h"
+#include "primitives/vertex_array.h"
+
+scl::u32 scl::geometry_arena::CreatePage(u32 VerticesCount, u32 IndicesCount)
+{
+    page &new_page = Pages.emplace_back();
+    new_page.VertexBuffer = vertex_buffer::Create(VerticesCount, vertex::GetVertexLayout());
+    new_page.IndexBuffer = index_buffer::Create(nullptr, IndicesCount);
+    new_page.VertexArray = vertex_array::Create(mesh_type::TRIANGLES);
+    new_page.VertexArray->SetVertexBuffer(new_page.VertexBuffer);
+    new_page.VertexArray->SetIndexBuffer(new_page.IndexBuffer);
+    new_page.Vertices = range_allocator(VerticesCount);
+    new_page.Indices = range_allocator(IndicesCount);
+
+    SCL_CORE_INFO("Geometry arena page {} with {} vertices and {} indices created.", Pages.size() - 1, VerticesCount, IndicesCount);
+    return (u32)Pages.size() - 1;
+}
+
+bool scl::geometry_arena::Allocate(std::span<const vertex> Vertices, std::span<const u32> Indices, geometry_arena_allocation &OutAllocation)
+{
+    if (Vertices.empty() || Indices.empty()) return false;
+
+    const u32 vertices_count = (u32)Vertices.size(), indices_count = (u32)Indices.size();
+    auto allocate_in_page = [&](u32 Page)
+    {
+        page &arena_page = Pages[Page];
+        if (!arena_page.Vertices.Allocate(vertices_count, OutAllocation.BaseVertex)) return false;
+        if (!arena_page.Indices.Allocate(indices_count, OutAllocation.Indices.FirstIndex))
+        {
+            arena_page.Vertices.Free(OutAllocation.BaseVertex, vertices_count);
+            return false;
+        }
+        OutAllocation.Page = Page;
+        OutAllocation.VerticesCount = vertices_count;
+        OutAllocation.Indices.Count = indices_count;
+        return true;
+    };
+
+    // Geometry, larger than default page, gets its own page.
+    bool is_allocated = false;
+    for (u32 i = 0; i < (u32)Pages.size() && !is_allocated; i++)
+        is_allocated = allocate_in_page(i);
+    if (!is_allocated)
+        is_allocated = allocate_in_page(CreatePage(math::Max(vertices_count, PAGE_VERTICES_COUNT),
+                                                   math::Max(indices_count, PAGE_INDICES_COUNT)));
+    if (!is_allocated) return false;
+
+    Pages[OutAllocation.Page].VertexBuffer->Update(OutAllocation.BaseVertex, Vertices.data(), vertices_count);
+    Pages[OutAllocation.Page].IndexBuffer->Update(OutAllocation.Indices.FirstIndex, Indices.data(), indices_count);
+    return true;
+}
+
+bool scl::geometry_arena::AllocateIndices(u32 Page, std::span<const u32> Indices, index_range &OutIndices)
+{
+    if (Page >= Pages.size() || Indices.empty()) return false;
+    if (!Pages[Page].Indices.Allocate((u32)Indices.size(), OutIndices.FirstIndex)) return false;
+
+    OutIndices.Count = (u32)Indices.size();
+    Pages[Page].IndexBuffer->Update(OutIndices.FirstIndex, Indices.data(), OutIndices.Count);
+    return true;
+}
+
+void scl::geometry_arena::Free(const geometry_arena_allocation &Allocation)
+{
+    if (!Allocation.IsAllocated() || Allocation.Page >= Pages.size()) return;
+
+    Pages[Allocation.Page].Vertices.Free(Allocation.BaseVertex, Allocation.VerticesCount);
+    Pages[Allocation.Page].Indices.Free(Allocation.Indices.FirstIndex, Allocation.Indices.Count);
+}
+
+void scl::geometry_arena::FreeIndices(u32 Page, const index_range &Indices)
+{
+    if (Indices.Count == 0 || Page >= Pages.size()) return;
+
+    Pages[Page].Indices.Free(Indices.FirstIndex, Indices.Count);
+}
+
+scl::geometry_arena &scl::geometry_arena::Get()
+{
+    static geometry_arena global_arena {};
+    return global_arena;
+}
@@ -0,0 +1,128 @@
+/*!****************************************************************//*!*
+ * \file   geometry_arena.h
+ * \brief  Shared vertex and index buffers (geometry arena) class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+#include "render_context.h"
+#include "core/resources/vertex.h"
+#include "utilities/memory/range_allocator.h"
+
+namespace scl
+{
+    /*! Classes declaration. */
+    class vertex_buffer;
+    class index_buffer;
+    class vertex_array;
+
+    /*! Geometry arena allocation structure. */
+    struct geometry_arena_allocation
+    {
+        u32 Page {};          /*! Arena page, geometry is allocated in. */
+        u32 BaseVertex {};    /*! Geometry first vertex in page vertex buffer (indices are relative to it). */
+        u32 VerticesCount {}; /*! Geometry vertices count. */
+        index_range Indices {}; /*! Geometry range of page index buffer. */
+
+        /*! Wheather geometry is allocated or not check function. */
+        bool IsAllocated() const { return Indices.Count != 0; }
+    };
+
+    /*!*
+     * Geometry arena class.
+     * Triangles geometry of many meshes is sub-allocated from pages (large shared vertex and index buffers),
+     * so all geometry of page is drawn by single vertex array with one multi draw indirect call.
+     * Pages are never reallocated, new page is created if geometry does not fit in existing ones.
+     */
+    class geometry_arena
+    {
+    private: /*! Geometry arena data. */
+        /*! Geometry arena page structure. */
+        struct page
+        {
+            shared<vertex_buffer> VertexBuffer {};
+            shared<index_buffer> IndexBuffer {};
+            shared<vertex_array> VertexArray {};
+            range_allocator Vertices {};
+            range_allocator Indices {};
+        };
+
+        std::vector<page> Pages {};
+        bool IsEnabled {};
+
+    public: /*! Geometry arena data getter/setter functions. */
+        /*! Default page vertices capacity. */
+        static const u32 PAGE_VERTICES_COUNT = 1 << 19;
+        /*! Default page indices capacity. */
+        static const u32 PAGE_INDICES_COUNT = 1 << 21;
+
+        /*! Arena enabled flag (wheather created meshes geometry is allocated in arena) getter function. */
+        bool GetEnabled() const { return IsEnabled; }
+        /*! Arena enabled flag setter function. Geometry of meshes, created before enabling, is not allocated in arena. */
+        void SetEnabled(bool IsEnabled) { this->IsEnabled = IsEnabled; }
+        /*! Arena pages count getter function. */
+        u32 GetPagesCount() const { return (u32)Pages.size(); }
+        /*! Page vertex array (drawing page vertex and index buffers) getter function. */
+        const shared<vertex_array> &GetVertexArray(u32 Page) const { return Pages[Page].VertexArray; }
+
+    private:
+        /*!*
+         * Create arena page function.
+         *
+         * \param VerticesCount - page vertices capacity.
+         * \param IndicesCount - page indices capacity.
+         * \return created page index.
+         */
+        u32 CreatePage(u32 VerticesCount, u32 IndicesCount);
+
+    public:
+        /*!*
+         * Allocate geometry in arena and upload it function.
+         *
+         * \param Vertices - geometry vertices.
+         * \param Indices - geometry triangles vertices indices.
+         * \param OutAllocation - geometry allocation.
+         * \return wheather geometry was allocated or not.
+         */
+        bool Allocate(std::span<const vertex> Vertices, std::span<const u32> Indices, geometry_arena_allocation &OutAllocation);
+
+        /*!*
+         * Allocate additional indices (e.g. level of detail triangles) over already allocated vertices function.
+         *
+         * \param Page - page of allocated vertices.
+         * \param Indices - triangles vertices indices (relative to allocated vertices).
+         * \param OutIndices - allocated range of page index buffer.
+         * \return wheather indices were allocated or not (page has no space for them).
+         */
+        bool AllocateIndices(u32 Page, std::span<const u32> Indices, index_range &OutIndices);
+
+        /*!*
+         * Free allocated geometry function.
+         *
+         * \param Allocation - geometry allocation.
+         * \return None.
+         */
+        void Free(const geometry_arena_allocation &Allocation);
+
+        /*!*
+         * Free additionaly allocated indices function.
+         *
+         * \param Page - page of indices.
+         * \param Indices - allocated range of page index buffer.
+         * \return None.
+         */
+        void FreeIndices(u32 Page, const index_range &Indices);
+
+        /*!*
+         * Global geometry arena getter function.
+         *
+         * \param None.
+         * \return global geometry arena.
+         */
+        static geometry_arena &Get();
+    };
+}
@@ -0,0 +1,57 @@
+/*!****************************************************************//*!*
+ * \file   indirect_draw_list.cpp
+ * \brief  Indirect (multi draw indirect) draw commands list class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "indirect_draw_list.h"
+
+void scl::indirect_draw_list::Add(u32 Page, u32 MaterialIndex, const index_range &Indices, i32 BaseVertex, const matr4 &Transform)
+{
+    if (Indices.Count == 0) return;
+    Draws.push_back({ Page, MaterialIndex, Indices, BaseVertex, Transform });
+}
+
+void scl::indirect_draw_list::Build(bool IsSplitByMaterial)
+{
+    Commands.clear();
+    DrawData.clear();
+    Batches.clear();
+
+    Order.resize(Draws.size());
+    for (u32 i = 0; i < (u32)Order.size(); i++) Order[i] = i;
+    std::stable_sort(Order.begin(), Order.end(), [&](u32 A, u32 B)
+    {
+        if (Draws[A].Page != Draws[B].Page || !IsSplitByMaterial) return Draws[A].Page < Draws[B].Page;
+        return Draws[A].MaterialIndex < Draws[B].MaterialIndex;
+    });
+
+    Commands.reserve(Draws.size());
+    DrawData.reserve(Draws.size());
+    for (u32 i : Order)
+    {
+        const draw &added = Draws[i];
+        u32 draw_index = (u32)Commands.size();
+        if (Batches.empty() || Batches.back().Page != added.Page ||
+            (IsSplitByMaterial && Batches.back().MaterialIndex != added.MaterialIndex))
+            Batches.push_back({ added.Page, added.MaterialIndex, draw_index, 0 });
+        Batches.back().DrawsCount++;
+
+        Commands.push_back({ added.Indices.Count, 1, added.Indices.FirstIndex, added.BaseVertex, draw_index });
+        indirect_draw_data &data = DrawData.emplace_back();
+        data.World = added.Transform;
+        data.Normal = added.Transform.Inverse().Transpose();
+        data.MaterialIndex = added.MaterialIndex;
+    }
+}
+
+void scl::indirect_draw_list::Clear()
+{
+    Draws.clear();
+    Commands.clear();
+    DrawData.clear();
+    Batches.clear();
+}
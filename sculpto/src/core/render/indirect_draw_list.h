@@ -0,0 +1,116 @@
+/*!****************************************************************//*!*
+ * \file   indirect_draw_list.h
+ * \brief  Indirect (multi draw indirect) draw commands list class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+#include "render_context.h"
+
+namespace scl
+{
+    /*! Indexed draw indirect command structure (matches DrawElementsIndirectCommand layout). */
+    struct draw_indirect_command
+    {
+        u32 Count;         /*! Drawn indices count. */
+        u32 InstanceCount; /*! Drawn instances count. */
+        u32 FirstIndex;    /*! First drawn index in index buffer. */
+        i32 BaseVertex;    /*! Value, added to each index before vertices fetching. */
+        u32 BaseInstance;  /*! First drawn instance index. */
+    };
+    static_assert(sizeof(draw_indirect_command) == 20, "Draw indirect command should be tightly packed.");
+
+    /*!*
+     * Indirect draw data structure.
+     * Array of structures is stored in storage buffer with std430 layout, element of draw is indexed by draw index
+     * (batch first draw plus draw index in multi draw call).
+     */
+    struct indirect_draw_data
+    {
+        matr4_data World;         /*! Drawn geometry world matrix. */
+        matr4_data Normal;        /*! Drawn geometry normals matrix (upper 3x3 part is used). */
+        u32        MaterialIndex; /*! Drawn geometry material index in pass materials list. */
+        u32        __dummy[3];
+    };
+    static_assert(sizeof(indirect_draw_data) % 16 == 0, "Indirect draw data size should be multiple of 16 bytes (std430 structure array stride).");
+
+    /*! Indirect draws batch (draws, sharing same geometry arena page and material) structure. */
+    struct indirect_draw_batch
+    {
+        u32 Page;          /*! Geometry arena page of batch draws. */
+        u32 MaterialIndex; /*! Material index of batch draws (first draw material index if batches are not split by material). */
+        u32 FirstDraw;     /*! Batch first draw command (and draw data) index. */
+        u32 DrawsCount;    /*! Batch draw commands count. */
+    };
+
+    /*!*
+     * Indirect draw commands list class.
+     * Draws are added in any order and grouped to batches of same arena page and material while building,
+     * so each batch is drawn with single multi draw indirect call.
+     * List performs no render context calls, so commands building could be checked without render context.
+     */
+    class indirect_draw_list
+    {
+    private: /*! Indirect draw commands list data. */
+        /*! Added draw structure. */
+        struct draw
+        {
+            u32 Page;
+            u32 MaterialIndex;
+            index_range Indices;
+            i32 BaseVertex;
+            matr4 Transform;
+        };
+
+        std::vector<draw> Draws {};                          /*! Added draws (in order of addition). */
+        std::vector<u32> Order {};                           /*! Added draws indices, sorted by batch (reused between builds). */
+        std::vector<draw_indirect_command> Commands {};      /*! Built draw commands. */
+        std::vector<indirect_draw_data> DrawData {};         /*! Built draws data (element per command). */
+        std::vector<indirect_draw_batch> Batches {};         /*! Built batches. */
+
+    public: /*! Indirect draw commands list data getter/setter functions. */
+        /*! Added draws count getter function. */
+        size_t GetDrawsCount() const { return Draws.size(); }
+        /*! Built draw commands getter function. */
+        const std::vector<draw_indirect_command> &GetCommands() const { return Commands; }
+        /*! Built draws data getter function. */
+        const std::vector<indirect_draw_data> &GetDrawData() const { return DrawData; }
+        /*! Built batches getter function. */
+        const std::vector<indirect_draw_batch> &GetBatches() const { return Batches; }
+
+    public:
+        /*!*
+         * Add draw to list function.
+         *
+         * \param Page - geometry arena page of drawn geometry.
+         * \param MaterialIndex - drawn geometry material index.
+         * \param Indices - drawn range of page index buffer.
+         * \param BaseVertex - drawn geometry first vertex in page vertex buffer.
+         * \param Transform - drawn geometry world matrix.
+         * \return None.
+         */
+        void Add(u32 Page, u32 MaterialIndex, const index_range &Indices, i32 BaseVertex, const matr4 &Transform);
+
+        /*!*
+         * Build draw commands, draws data and batches from added draws function.
+         * Draws order is kept inside of batch.
+         *
+         * \param IsSplitByMaterial - wheather draws of different materials are split to different batches
+         *                           (false if draw material is selected by shader from draw data).
+         * \return None.
+         */
+        void Build(bool IsSplitByMaterial = true);
+
+        /*!*
+         * Clear added draws and built commands function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Clear();
+    };
+}
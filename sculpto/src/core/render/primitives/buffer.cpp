@@ -35,6 +35,30 @@ scl::shared<scl::constant_buffer> scl::constant_buffer::Create(const void *Data,
     return nullptr;
 }
 
+scl::shared<scl::storage_buffer> scl::storage_buffer::Create(u32 Size)
+{
+    switch (render_context::GetApi())
+    {
+    case scl::render_context_api::OpenGL:  return CreateShared<scl::gl_storage_buffer>(nullptr, Size);
+    case scl::render_context_api::DirectX: SCL_CORE_ASSERT(0, "This API is currently unsupported."); return nullptr;
+    }
+
+    SCL_CORE_ASSERT(0, "Unknown render API was selected.");
+    return nullptr;
+}
+
+scl::shared<scl::storage_buffer> scl::storage_buffer::Create(const void *Data, u32 Size)
+{
+    switch (render_context::GetApi())
+    {
+    case scl::render_context_api::OpenGL:  return CreateShared<scl::gl_storage_buffer>(Data, Size);
+    case scl::render_context_api::DirectX: SCL_CORE_ASSERT(0, "This API is currently unsupported."); return nullptr;
+    }
+
+    SCL_CORE_ASSERT(0, "Unknown render API was selected.");
+    return nullptr;
+}
+
 scl::vertex_buffer::vertex_buffer(const vertex_layout &VertexLayout) :
     VertexLayout(VertexLayout) {}
 
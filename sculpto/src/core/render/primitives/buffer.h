@@ -96,6 +96,97 @@ namespace scl
         static shared<constant_buffer> Create(const void *Data, u32 Size);
     };
 
+    /*!*
+     * Storage buffer (shader storage buffer) interface.
+     * Could be read and written by shaders, used as compute shaders input and output and as indirect commands source.
+     * Buffer grows on updates, exceeding its size, so it could store arrays of any length.
+     * Shader storage blocks use std430 layout, so arrays of scalars and vec2 are tightly packed, unlike in constant buffers.
+     */
+    class storage_buffer : public render_primitive
+    {
+    public:
+        /*! Storage buffer default destructor. */
+        virtual ~storage_buffer() = default;
+
+        /*!*
+         * Bind buffer to shader storage binding point function.
+         *
+         * \param BindingPoint - shader storage block binding point.
+         * \return None.
+         */
+        virtual void Bind(u32 BindingPoint) const = 0;
+
+        /*!*
+         * Unbind buffer from shader storage binding point function.
+         *
+         * \param None.
+         * \return None.
+         */
+        virtual void Unbind() const = 0;
+
+        /*!*
+         * Update buffer data from its begining function.
+         *
+         * \param Data - buffer data pointer.
+         * \param Size - buffer data size (buffer grows if it is exceeded).
+         * \return None.
+         */
+        virtual void Update(const void *Data, u32 Size) = 0;
+
+        /*!*
+         * Update buffer data range function.
+         * Only specified range is uploaded, so changed array elements could be updated without uploading whole array.
+         *
+         * \param Offset - updated range offset in bytes.
+         * \param Data - range data pointer.
+         * \param Size - range data size (buffer grows if it is exceeded).
+         * \return None.
+         */
+        virtual void Update(u32 Offset, const void *Data, u32 Size) = 0;
+
+        /*!*
+         * Make buffer size at least specified one function.
+         * Buffer capacity grows geometrically, its data is kept. Buffer is rebound if it was bound.
+         *
+         * \param Size - required buffer size in bytes.
+         * \return None.
+         */
+        virtual void Reserve(u32 Size) = 0;
+
+        /*!*
+         * Clear buffer from GPU memory function.
+         *
+         * \param None.
+         * \return None.
+         */
+        virtual void Free() = 0;
+
+        /*!*
+         * Storage buffer size (capacity) getter function.
+         *
+         * \param None.
+         * \return buffer size in bytes.
+         */
+        virtual u32 GetSize() const = 0;
+
+        /*!*
+         * Create API specific empty (zero filled) storage buffer.
+         *
+         * \param Size - buffer data size.
+         * \return storage buffer pointer.
+         */
+        static shared<storage_buffer> Create(u32 Size);
+
+        /*!*
+         * Create API specific storage buffer filled with data.
+         *
+         * \param Data - buffer data pointer.
+         * \param Size - buffer data size.
+         * \return storage buffer pointer.
+         */
+        static shared<storage_buffer> Create(const void *Data, u32 Size);
+    };
+
     /*! Vertex bufer interface. */
     class vertex_buffer : public render_primitive
     {
@@ -142,6 +233,16 @@ namespace scl
          */
         virtual void Update(const void *Vertices, u32 Count) = 0;
 
+        /*!*
+         * Update range of buffer vertices function.
+         *
+         * \param FirstVertex - first updated vertex index.
+         * \param Vertices - verices array.
+         * \param Count - length of vertices array (range should not exceed buffer).
+         * \return None.
+         */
+        virtual void Update(u32 FirstVertex, const void *Vertices, u32 Count) = 0;
+
         /*!*
          * Clear buffer from GPU memory function.
          *
@@ -217,6 +318,16 @@ namespace scl
          */
         virtual void Update(u32 *Indices, u32 Count) = 0;
 
+        /*!*
+         * Update range of buffer indices function.
+         *
+         * \param FirstIndex - first updated index.
+         * \param Indices - array of indices.
+         * \param Count - length of indices array (range should not exceed buffer).
+         * \return None.
+         */
+        virtual void Update(u32 FirstIndex, const u32 *Indices, u32 Count) = 0;
+
         /*!*
          * Index biffer indices count getter function.
          * 
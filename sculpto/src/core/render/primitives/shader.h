@@ -9,6 +9,7 @@
 #pragma once
 
 #include "render_primitive.h"
+#include "uniform_block_layout.h"
 
 namespace scl
 {
@@ -47,6 +48,8 @@ namespace scl
         std::string VertexShadersourceFileName {};
         std::string GeometryShadersourceFileName {};
         std::string PixelShadersourceFileName {};
+        std::vector<std::string> Defines {};
+        std::set<std::string> IncludedFileNames {};
         std::string DebugName {};
 
     public: /*! Saader program getter/setter functions. */
@@ -105,6 +108,26 @@ namespace scl
         /*! Shader program default deatructor. */
         virtual ~shader_program() = default;
 
+        /*!*
+         * Check if shader program compilation is finished function.
+         * Programs are compiled asynchronously if backend supports it, not ready program could be skipped while rendering.
+         * Binding not ready program waits for its compilation.
+         *
+         * \param None.
+         * \return wheather program is compiled and linked successfully.
+         */
+        virtual bool IsReady() const = 0;
+
+        /*!*
+         * Get uniform block memory layout, used by linked shader program, function.
+         * Waits for program compilation if it is not finished.
+         *
+         * \param BlockName - uniform block name.
+         * \param OutLayout[out] - uniform block layout.
+         * \return wheather program has active uniform block with specified name.
+         */
+        virtual bool GetUniformBlockLayout(const std::string &BlockName, uniform_block_layout &OutLayout) const = 0;
+
         /*!*
          * Bind buffer to current render stage function.
          *
@@ -123,6 +146,7 @@ namespace scl
 
         /*!*
          * Recompile shader program function.
+         * Previous program is used until new one is ready and kept if new one could not be compiled.
          * 
          * \param Shaders - shaders array.
          * \return None.
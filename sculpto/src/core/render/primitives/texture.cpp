@@ -22,3 +22,15 @@ scl::shared<scl::texture_2d> scl::texture_2d::Create(const image &Image, texture
     SCL_CORE_ASSERT(0, "Unknown render API was selected.");
     return nullptr;
 }
+
+scl::shared<scl::texture_2d> scl::texture_2d::Create(const texture_data &Data)
+{
+    switch (render_context::GetApi())
+    {
+    case scl::render_context_api::OpenGL:  return CreateShared<gl_texture_2d>(Data);
+    case scl::render_context_api::DirectX: SCL_CORE_ASSERT(0, "This API is currently unsupported."); return nullptr;
+    }
+
+    SCL_CORE_ASSERT(0, "Unknown render API was selected.");
+    return nullptr;
+}
@@ -21,6 +21,38 @@ namespace scl
         DEPTH,                   /*! Depth component texture type. */
     };
 
+    /*! Texture pixels compression types enum class. */
+    enum class texture_compression
+    {
+        NONE,   /*! Uncompressed pixels (8 bits per component). */
+        BC1,    /*! Opaque RGB color, 8 bytes per 4x4 pixels block. */
+        BC3,    /*! RGBA color, 16 bytes per 4x4 pixels block. */
+        BC5,    /*! Two channel (normal map XY) data, 16 bytes per 4x4 pixels block. */
+    };
+
+    /*! Texture image (shader load/store) access types enum class. */
+    enum class texture_image_access
+    {
+        READ,         /*! Image is only read by shaders. */
+        WRITE,        /*! Image is only written by shaders. */
+        READ_WRITE,   /*! Image is read and written by shaders. */
+    };
+
+    /*! Texture mip level pixels data view structure. */
+    struct texture_level
+    {
+        int Width {}, Height {};        /*! Level size in pixels. */
+        std::span<const u8> Data {};    /*! Level pixels (or compressed blocks) data. */
+    };
+
+    /*! Texture with all mip levels data structure. */
+    struct texture_data
+    {
+        texture_compression Compression {};     /*! Levels pixels compression type. */
+        int ComponentsCount {};                 /*! Components per pixel count of uncompressed levels. */
+        std::vector<texture_level> Levels {};   /*! Mip levels (from largest to smallest). */
+    };
+
     /*! Texture interface. */
     class texture_2d : public render_primitive
     {
@@ -32,6 +64,8 @@ namespace scl
         int GetWidth() const { return Width; }
         /*! Texture height (in pixels) getter function. */
         int GetHeight() const { return Height; }
+        /*! Texture bindless handle getter function. Texture becomes resident (and immutable) on first call, zero is returned if bindless textures are not supported. */
+        virtual u64 GetBindlessHandle() const = 0;
 
     public:
         /*! Texture default deatructor. */
@@ -53,6 +87,18 @@ namespace scl
          */
         virtual void Unbind() const = 0;
 
+        /*!*
+         * Bind texture mip level as image for shaders load/store operations function.
+         * Only uncompressed textures with one, two or four components could be bound as images.
+         * Shader image accesses should be synchronized with render_bridge::Barrier.
+         *
+         * \param Unit - image unit to bind texture to.
+         * \param Access - shaders access type.
+         * \param Level - bound mip level.
+         * \return None.
+         */
+        virtual void BindImage(u32 Unit, texture_image_access Access, int Level = 0) const = 0;
+
         /*!*
          * Load texture image from GPU memory function.
          * 
@@ -61,6 +107,15 @@ namespace scl
          */
         virtual image GetImage() = 0;
 
+        /*!*
+         * Replace texture content with new mip levels function.
+         * Texture object stays same (so all its users see new content), only its GPU storage is recreated.
+         *
+         * \param Data - new texture mip levels data (could be block compressed).
+         * \return None.
+         */
+        virtual void Update(const texture_data &Data) = 0;
+
         /*!*
          * Unload texture from GPU memory function.
          *
@@ -76,5 +131,13 @@ namespace scl
          * \return created texture pointer.
          */
         static shared<texture_2d> Create(const image &Image, texture_type Type = texture_type::COLOR);
+
+        /*!*
+         * Create color texture from prepared mip levels function.
+         *
+         * \param Data - texture mip levels data (could be block compressed).
+         * \return created texture pointer.
+         */
+        static shared<texture_2d> Create(const texture_data &Data);
     };
 }
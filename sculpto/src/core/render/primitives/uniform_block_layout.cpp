@@ -0,0 +1,81 @@
+/*!****************************************************************//*!*
+ * \file   uniform_block_layout.cpp
+ * \brief  Uniform block (constant buffer) memory layout class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "uniform_block_layout.h"
+
+namespace scl
+{
+    /*!*
+     * Get shader uniform block element name without uniforms prefix function.
+     *
+     * \param ShaderName - element name in shader.
+     * \return element name, comparable with C++ structure member name.
+     */
+    static std::string GetElementName(const std::string &ShaderName)
+    {
+        return ShaderName.starts_with("u_") ? ShaderName.substr(2) : ShaderName;
+    }
+}
+
+scl::uniform_block_layout &scl::uniform_block_layout::AddElement(const uniform_block_element &Element)
+{
+    Elements.push_back(Element);
+    return *this;
+}
+
+scl::uniform_block_layout &scl::uniform_block_layout::AddStruct(const std::string &Name, u32 Offset, const uniform_block_layout &StructLayout)
+{
+    for (const uniform_block_element &element : StructLayout)
+        Elements.push_back({ Name + "." + element.Name, Offset + element.Offset, element.Size });
+    return *this;
+}
+
+scl::uniform_block_layout &scl::uniform_block_layout::AddStructArray(const std::string &Name, u32 Offset,
+                                                                    const uniform_block_layout &StructLayout, u32 Count)
+{
+    for (u32 i = 0; i < Count; i++)
+        AddStruct(std::format("{}[{}]", Name, i), Offset + i * StructLayout.GetSize(), StructLayout);
+    return *this;
+}
+
+std::vector<std::string> scl::uniform_block_layout::GetMismatches(const uniform_block_layout &ShaderLayout) const
+{
+    std::vector<std::string> mismatches {};
+    if (ShaderLayout.GetSize() > Size)
+        mismatches.push_back(std::format("shader block size is {} bytes, but only {} bytes are uploaded", ShaderLayout.GetSize(), Size));
+
+    std::unordered_map<std::string, const uniform_block_element *> elements {};
+    for (const uniform_block_element &element : Elements)
+        elements[element.Name] = &element;
+
+    for (const uniform_block_element &shader_element : ShaderLayout)
+    {
+        std::string name = GetElementName(shader_element.Name);
+        auto element = elements.find(name);
+        if (element == elements.end())
+        {
+            mismatches.push_back(std::format("shader member \"{}\" (offset {}) is not described", name, shader_element.Offset));
+            continue;
+        }
+
+        if (element->second->Offset != shader_element.Offset)
+            mismatches.push_back(std::format("member \"{}\" offset is {} in shader, but {} in structure",
+                                             name, shader_element.Offset, element->second->Offset));
+        else if (shader_element.Size != 0 && element->second->Size != shader_element.Size)
+            mismatches.push_back(std::format("member \"{}\" size is {} in shader, but {} in structure",
+                                             name, shader_element.Size, element->second->Size));
+        elements.erase(element);
+    }
+
+    // Members are reported in structure order.
+    for (const uniform_block_element &element : Elements)
+        if (elements.contains(element.Name))
+            mismatches.push_back(std::format("structure member \"{}\" is not present in shader block", element.Name));
+    return mismatches;
+}
@@ -0,0 +1,99 @@
+/*!****************************************************************//*!*
+ * \file   uniform_block_layout.h
+ * \brief  Uniform block (constant buffer) memory layout class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl
+{
+    /*! Uniform block element (not structure member of block) layout structure. */
+    struct uniform_block_element
+    {
+        std::string Name {};   /*! Element name with enclosing structures and array indices (e.g. "PointLights[3].Color"). */
+        u32 Offset {};         /*! Element offset from block begining in bytes. */
+        u32 Size {};           /*! Element size in bytes (0 if unknown). */
+    };
+
+    /*!*
+     * Uniform block memory layout class.
+     * Layout is described for C++ structures, uploaded to constant buffers, and reflected from linked shader programs,
+     * so both sides of block could be compared.
+     */
+    class uniform_block_layout
+    {
+    private: /*! Uniform block layout data. */
+        std::vector<uniform_block_element> Elements {};
+        u32 Size {};
+
+    public: /*! Uniform block layout getter/setter functions. */
+        /*! Uniform block layout elements getter function. */
+        const std::vector<uniform_block_element> &GetElements() const { return Elements; }
+        /*! Uniform block layout size getter function. */
+        u32 GetSize() const { return Size; }
+
+        std::vector<uniform_block_element>::const_iterator begin() const { return Elements.begin(); }
+        std::vector<uniform_block_element>::const_iterator end() const { return Elements.end(); }
+
+    public:
+        /*! Uniform block layout default constructor. */
+        uniform_block_layout() = default;
+
+        /*!*
+         * Uniform block layout constructor.
+         *
+         * \param Size - uniform block size in bytes.
+         * \param Elements - array of uniform block elements.
+         */
+        uniform_block_layout(u32 Size, const std::initializer_list<uniform_block_element> &Elements = {}) :
+            Elements(Elements), Size(Size) {}
+
+        /*!*
+         * Add element to layout function.
+         *
+         * \param Element - element to add.
+         * \return self reference.
+         */
+        uniform_block_layout &AddElement(const uniform_block_element &Element);
+
+        /*!*
+         * Add structure member to layout function.
+         *
+         * \param Name - structure member name.
+         * \param Offset - structure member offset from block begining in bytes.
+         * \param StructLayout - structure layout.
+         * \return self reference.
+         */
+        uniform_block_layout &AddStruct(const std::string &Name, u32 Offset, const uniform_block_layout &StructLayout);
+
+        /*!*
+         * Add structures array member to layout function.
+         * Structures are placed one by one, so array stride is equal to structure size.
+         *
+         * \param Name - array member name.
+         * \param Offset - array member offset from block begining in bytes.
+         * \param StructLayout - array element structure layout.
+         * \param Count - array elements count.
+         * \return self reference.
+         */
+        uniform_block_layout &AddStructArray(const std::string &Name, u32 Offset, const uniform_block_layout &StructLayout, u32 Count);
+
+        /*!*
+         * Compare layout with shader uniform block layout function.
+         * Shader elements names prefix "u_" is ignored.
+         *
+         * \param ShaderLayout - uniform block layout, reflected from shader program.
+         * \return descriptions of found mismatches (empty if layouts match).
+         */
+        std::vector<std::string> GetMismatches(const uniform_block_layout &ShaderLayout) const;
+    };
+}
+
+/*! Uniform block element description by C++ structure member macro. */
+#define SCL_UNIFORM_ELEMENT(Struct, Member) \
+    scl::uniform_block_element { #Member, (scl::u32)offsetof(Struct, Member), (scl::u32)sizeof(Struct::Member) }
@@ -17,6 +17,7 @@ namespace scl
     /*! Vertex buffer and arary classes declaration. */
     class vertex_buffer;
     class vertex_array;
+    class storage_buffer;
 
     /*! Render bridge class. */
     class render_bridge
@@ -35,6 +36,8 @@ namespace scl
         inline static bool GetDepthTestMode() { return RenderContext->GetDepthTestMode(); }
         /*! Render virtual syncronisation flag getter function. */
         inline static bool GetVSync() { return RenderContext->GetVSync(); }
+        /*! Bindless textures support flag getter function. */
+        inline static bool GetBindlessTexturesSupport() { return RenderContext->GetBindlessTexturesSupport(); }
 
         /*! Frame clear color setter function. */
         inline static void SetClearColor(const vec4 &ClearColor) { RenderContext->SetClearColor(ClearColor); }
@@ -98,6 +101,80 @@ namespace scl
             RenderContext->DrawIndicesInstanced(VertexArray, InstanceCount);
         }
 
+        /*!*
+         * Draw ranges of vertex array indices to curent render target.
+         *
+         * \param VertexArray - vertex array to draw verticces from.
+         * \param Ranges - ranges of vertex array index buffer indices to draw.
+         * \return None.
+         */
+        inline static void DrawIndicesRanges(const shared<vertex_array> &VertexArray, std::span<const index_range> Ranges)
+        {
+            RenderContext->DrawIndicesRanges(VertexArray, Ranges);
+        }
+
+        /*!*
+         * Draw vertex array by indirect draw commands, read from buffer, with single call function.
+         *
+         * \param VertexArray - vertex array to draw verticces from.
+         * \param Commands - buffer, containing draw indirect commands (draw_indirect_command structures).
+         * \param FirstCommand - first drawn command index in buffer.
+         * \param CommandsCount - drawn commands count.
+         * \return None.
+         */
+        inline static void DrawIndicesIndirect(const shared<vertex_array> &VertexArray, const shared<storage_buffer> &Commands,
+                                               u32 FirstCommand, u32 CommandsCount)
+        {
+            RenderContext->DrawIndicesIndirect(VertexArray, Commands, FirstCommand, CommandsCount);
+        }
+
+        /*!*
+         * Dispatch compute work groups of currently bound compute shader program function.
+         *
+         * \param GroupsCountX, GroupsCountY, GroupsCountZ - work groups count by each dimension.
+         * \return None.
+         */
+        inline static void Dispatch(u32 GroupsCountX, u32 GroupsCountY = 1, u32 GroupsCountZ = 1)
+        {
+            RenderContext->Dispatch(GroupsCountX, GroupsCountY, GroupsCountZ);
+        }
+
+        /*!*
+         * Dispatch compute work groups of currently bound compute shader program with groups count, read from buffer, function.
+         * Arguments, written by shaders, should be made visible with BARRIER_INDIRECT_COMMAND barrier.
+         *
+         * \param Arguments - buffer, containing three u32 work groups counts.
+         * \param Offset - arguments offset in buffer in bytes (should be multiple of 4).
+         * \return None.
+         */
+        inline static void DispatchIndirect(const shared<storage_buffer> &Arguments, u32 Offset = 0)
+        {
+            RenderContext->DispatchIndirect(Arguments, Offset);
+        }
+
+        /*!*
+         * Wait for shaders memory writes (storage buffers, images) to become visible to specified accesses function.
+         *
+         * \param Barriers - accesses, following writes (render_context::BARRIER_* bits).
+         * \return None.
+         */
+        inline static void Barrier(u32 Barriers = render_context::BARRIER_ALL)
+        {
+            RenderContext->Barrier(Barriers);
+        }
+
+        /*!*
+         * Get compute work groups count, covering specified invocations count, function.
+         *
+         * \param InvocationsCount - count of invocations (e.g. pixels or elements) to cover.
+         * \param GroupSize - work group size (local size) by same dimension.
+         * \return work groups count.
+         */
+        inline static u32 GetGroupsCount(u32 InvocationsCount, u32 GroupSize)
+        {
+            return (InvocationsCount + GroupSize - 1) / GroupSize;
+        }
+
     public: /*! Sculpto library built-in backend API specific rendering objects getter function. */
         /*! Backend API specific single color material shader getter function. */
         inline static shared<shader_program> GetSingleColorMaterialShader()
@@ -117,6 +194,12 @@ namespace scl
             return RenderContext->GetPhongGeometryShader();
         }
 
+        /*! Backend API specific phong lighint model shader for geometry pass variants getter function. */
+        inline static shared<shader_variants> GetPhongGeometryShaderVariants()
+        {
+            return RenderContext->GetPhongGeometryShaderVariants();
+        }
+
         /*! Backend API specific phong lighint model shader for lighting pass getter function. */
         inline static shared<shader_program> GetPhongLightingShader()
         {
@@ -129,6 +212,12 @@ namespace scl
             return RenderContext->GetShadowPassShader();
         }
 
+        /*! Backend API specific shadow pass shader for indirect draws getter function. */
+        inline static shared<shader_program> GetShadowPassIndirectShader()
+        {
+            return RenderContext->GetShadowPassIndirectShader();
+        }
+
         /*! Backend API specific full viewport mesh with tone mapping shader. */
         inline static shared<shader_program> GetToneMappingPassShader()
         {
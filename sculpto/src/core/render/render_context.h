@@ -16,6 +16,8 @@ namespace scl
     /*! Vertex array class declaration. */
     class vertex_array;
     class shader_program;
+    class shader_variants;
+    class storage_buffer;
     class mesh;
     enum class mesh_type;
 
@@ -43,6 +45,13 @@ namespace scl
         FRONT
     };
 
+    /*! Range of index buffer indices structure. */
+    struct index_range
+    {
+        u32 FirstIndex; /*! Range first index. */
+        u32 Count;      /*! Range indices count. */
+    };
+
     /*! Render context backend api enum. */
     enum class render_context_api
     {
@@ -70,6 +79,8 @@ namespace scl
         virtual bool GetDepthTestMode() const = 0;
         /*! Render virtual syncronisation flag getter function. */
         virtual bool GetVSync() const = 0;
+        /*! Bindless textures (sampling textures by handles, stored in buffers, even if handles are not dynamically uniform) support flag getter function. */
+        virtual bool GetBindlessTexturesSupport() const = 0;
 
         /*! Frame clear color setter function. */
         virtual void SetClearColor(const vec4 &ClearColor) = 0;
@@ -146,6 +157,51 @@ namespace scl
          */
         virtual void DrawIndicesInstanced(const shared<vertex_array> &Mesh, int InstanceCount) = 0;
 
+        /*!*
+         * Draw ranges of vertices indices function.
+         *
+         * \param Mesh - mesh, containing vertices and vertex indices to draw.
+         * \param Ranges - ranges of mesh index buffer indices to draw.
+         * \return None.
+         */
+        virtual void DrawIndicesRanges(const shared<vertex_array> &Mesh, std::span<const index_range> Ranges) = 0;
+
+        /*!*
+         * Draw vertices by indirect draw commands, read from buffer, with single call function.
+         *
+         * \param Mesh - mesh, containing vertices and vertex indices to draw.
+         * \param Commands - buffer, containing draw indirect commands (draw_indirect_command structures).
+         * \param FirstCommand - first drawn command index in buffer.
+         * \param CommandsCount - drawn commands count.
+         * \return None.
+         */
+        virtual void DrawIndicesIndirect(const shared<vertex_array> &Mesh, const shared<storage_buffer> &Commands, u32 FirstCommand, u32 CommandsCount) = 0;
+
+        /*!*
+         * Dispatch compute work groups of currently bound compute shader program function.
+         *
+         * \param GroupsCountX, GroupsCountY, GroupsCountZ - work groups count by each dimension.
+         * \return None.
+         */
+        virtual void Dispatch(u32 GroupsCountX, u32 GroupsCountY, u32 GroupsCountZ) = 0;
+
+        /*!*
+         * Dispatch compute work groups of currently bound compute shader program with groups count, read from buffer, function.
+         *
+         * \param Arguments - buffer, containing three u32 work groups counts (could be written by previous dispatch).
+         * \param Offset - arguments offset in buffer in bytes (should be multiple of 4).
+         * \return None.
+         */
+        virtual void DispatchIndirect(const shared<storage_buffer> &Arguments, u32 Offset) = 0;
+
+        /*!*
+         * Wait for shaders memory writes to become visible to specified accesses function.
+         *
+         * \param Barriers - accesses, following writes (BARRIER_* bits).
+         * \return None.
+         */
+        virtual void Barrier(u32 Barriers) = 0;
+
         /*!*
          * Rendering context creation function.
          *
@@ -159,12 +215,16 @@ namespace scl
         virtual shared<shader_program> GetSingleColorMaterialShader() const = 0;
         /*! Backend API specific skybox material shader getter function. */
         virtual shared<shader_program> GetSkyboxMaterialShader() const = 0;
-        /*! Backend API specific phong lighint model shader for geometry pass getter function. */
+        /*! Backend API specific phong lighint model shader for geometry pass (variant without features) getter function. */
         virtual shared<shader_program> GetPhongGeometryShader() const = 0;
+        /*! Backend API specific phong lighint model shader for geometry pass variants (by PHONG_FEATURE_* key) getter function. */
+        virtual shared<shader_variants> GetPhongGeometryShaderVariants() const = 0;
         /*! Backend API specific phong lighint model shader for lighting pass getter function. */
         virtual shared<shader_program> GetPhongLightingShader() const = 0;
         /*! Backend API specific shadow pass shader getter function. */
         virtual shared<shader_program> GetShadowPassShader() const = 0;
+        /*! Backend API specific shadow pass shader for indirect draws (with per draw data, indexed by draw index) getter function. */
+        virtual shared<shader_program> GetShadowPassIndirectShader() const = 0;
         /*! Backend API specific tone mapping pass shader getter function. */
         virtual shared<shader_program> GetToneMappingPassShader() const = 0;
         /*! Backend API specific gaussian blur pass shader getter function. */
@@ -177,6 +237,8 @@ namespace scl
         static const int BINDING_POINT_MATERIAL_DATA           = 5;
         static const int BINDING_POINT_LIGHTS_STORAGE          = 10;
         static const int BINDING_POINT_SHADOW_CASTERS_STORAGE  = 11;
+        static const int BINDING_POINT_DRAW_DATA               = 12;
+        static const int BINDING_POINT_MATERIALS_STORAGE       = 13;
         static const int BINDING_POINT_FREE                    = 20;
 
         static const int TEXTURE_SLOT_MATERIAL_DIFFUSE         = 0;
@@ -210,5 +272,23 @@ namespace scl
         static const int COLOR_ATTACHMENT_LIGHTING_PASS_OUT_BRIGHT_COLOR     = 1;
 
         static const int MESH_RESTART_INDEX = -1;
+
+        static const u32 PHONG_FEATURE_DIFFUSE_MAP             = 1 << 0;
+        static const u32 PHONG_FEATURE_SPECULAR_MAP            = 1 << 1;
+        static const u32 PHONG_FEATURE_EMISSION_MAP            = 1 << 2;
+        static const u32 PHONG_FEATURE_NORMAL_MAP              = 1 << 3;
+        static const u32 PHONG_FEATURE_INDIRECT_DRAW           = 1 << 4;
+        static const u32 PHONG_FEATURE_MATERIAL_STORAGE        = 1 << 5;
+
+        static const u32 BARRIER_STORAGE_BUFFER                = 1 << 0;
+        static const u32 BARRIER_IMAGE_ACCESS                  = 1 << 1;
+        static const u32 BARRIER_TEXTURE_FETCH                 = 1 << 2;
+        static const u32 BARRIER_CONSTANT_BUFFER               = 1 << 3;
+        static const u32 BARRIER_VERTEX_BUFFER                 = 1 << 4;
+        static const u32 BARRIER_INDEX_BUFFER                  = 1 << 5;
+        static const u32 BARRIER_INDIRECT_COMMAND              = 1 << 6;
+        static const u32 BARRIER_FRAME_BUFFER                  = 1 << 7;
+        static const u32 BARRIER_BUFFER_UPDATE                 = 1 << 8;
+        static const u32 BARRIER_ALL                           = 0xFFFFFFFF;
     };
 }
@@ -12,6 +12,9 @@
 #include "base.h"
 #include "core/render/render_bridge.h"
 #include "core/render/primitives/buffer.h"
+#include "core/render/primitives/uniform_block_layout.h"
+#include "core/render/indirect_draw_list.h"
+#include "core/resources/materials/material.h"
 #include "utilities/assets_manager/shaders_load.h"
 
 namespace scl
@@ -23,6 +26,12 @@ namespace scl
     class constant_buffer;
     class shader_program;
 
+    /*!*
+     * Constant buffers data structures.
+     * Structures follow std140 layout of matching shader uniform blocks, their layouts are described
+     * by GetLayout functions and validated against shaders, using them, when they are ready.
+     */
+
     /*! Scene rendering data. */
     struct pipeline_data
     {
@@ -33,11 +42,30 @@ namespace scl
         vec3  CameraUpDirection;    /*! Submission camer location vector. */
         int   ViewportHeight;       /*! Currently rendering frame viewport height. */
         vec3  CameraRightDirection; /*! Submission camer location vector. */
-        bool  IsHDR;                /*! Flag, showing wheather HDR frame buffer, tone mapped to destination frame buffer is active or not. */
+        u32   IsHDR;                /*! Flag, showing wheather HDR frame buffer, tone mapped to destination frame buffer is active or not. */
         vec3  EnviromentAmbient;    /*! Scene enviroment apbient color. */
         float Exposure;             /*! Exposure level for exposure tone mapping algoritm (applyed only if HDR is active). */
-        bool  IsBloom;              /*! Flag, showing wheather bloom effect is active or not. */
+        u32   IsBloom;              /*! Flag, showing wheather bloom effect is active or not. */
         int   BloomAmount;          /*! Iteration of blur while applying bloom effect. */
+
+        /*! Uniform block "ubo_PipelineData" layout getter function. */
+        static uniform_block_layout GetLayout()
+        {
+            return uniform_block_layout(sizeof(pipeline_data), {
+                SCL_UNIFORM_ELEMENT(pipeline_data, CameraPosition),
+                SCL_UNIFORM_ELEMENT(pipeline_data, Time),
+                SCL_UNIFORM_ELEMENT(pipeline_data, CameraDirection),
+                SCL_UNIFORM_ELEMENT(pipeline_data, ViewportWidth),
+                SCL_UNIFORM_ELEMENT(pipeline_data, CameraUpDirection),
+                SCL_UNIFORM_ELEMENT(pipeline_data, ViewportHeight),
+                SCL_UNIFORM_ELEMENT(pipeline_data, CameraRightDirection),
+                SCL_UNIFORM_ELEMENT(pipeline_data, IsHDR),
+                SCL_UNIFORM_ELEMENT(pipeline_data, EnviromentAmbient),
+                SCL_UNIFORM_ELEMENT(pipeline_data, Exposure),
+                SCL_UNIFORM_ELEMENT(pipeline_data, IsBloom),
+                SCL_UNIFORM_ELEMENT(pipeline_data, BloomAmount),
+            });
+        }
     };
 
     /*! Render object render_pass_submission structure. */
@@ -56,6 +84,18 @@ namespace scl
         float Linear;
         float Quadratic;
         float __dummy[3];
+
+        /*! Shader structure "point_light" layout getter function. */
+        static uniform_block_layout GetLayout()
+        {
+            return uniform_block_layout(sizeof(point_light), {
+                SCL_UNIFORM_ELEMENT(point_light, Position),
+                SCL_UNIFORM_ELEMENT(point_light, Constant),
+                SCL_UNIFORM_ELEMENT(point_light, Color),
+                SCL_UNIFORM_ELEMENT(point_light, Linear),
+                SCL_UNIFORM_ELEMENT(point_light, Quadratic),
+            });
+        }
     };
 
     /*! Directional light structure. */
@@ -66,6 +106,17 @@ namespace scl
         vec3 Color;
         float __dummy;
         matr4_data ViewProjection;
+
+        /*! Shader structure "directional_light" layout getter function. */
+        static uniform_block_layout GetLayout()
+        {
+            return uniform_block_layout(sizeof(directional_light), {
+                SCL_UNIFORM_ELEMENT(directional_light, Direction),
+                SCL_UNIFORM_ELEMENT(directional_light, IsShadows),
+                SCL_UNIFORM_ELEMENT(directional_light, Color),
+                SCL_UNIFORM_ELEMENT(directional_light, ViewProjection),
+            });
+        }
     };
 
     /*! Spot light structure. */
@@ -77,19 +128,49 @@ namespace scl
         float OuterCutoffCos;
         vec3 Color;
         float Epsilon;
+
+        /*! Shader structure "spot_light" layout getter function. */
+        static uniform_block_layout GetLayout()
+        {
+            return uniform_block_layout(sizeof(spot_light), {
+                SCL_UNIFORM_ELEMENT(spot_light, Position),
+                SCL_UNIFORM_ELEMENT(spot_light, InnerCutoffCos),
+                SCL_UNIFORM_ELEMENT(spot_light, Direction),
+                SCL_UNIFORM_ELEMENT(spot_light, OuterCutoffCos),
+                SCL_UNIFORM_ELEMENT(spot_light, Color),
+                SCL_UNIFORM_ELEMENT(spot_light, Epsilon),
+            });
+        }
     };
 
     /*! Lights storage structure. */
     struct lights_storage
     {
-        point_light PointLights[50] {};
+        point_light PointLights[render_context::LIGHTS_MAX_POINT] {};
         directional_light DirectionalLight {};
-        spot_light SpotLights[50] {};
+        spot_light SpotLights[render_context::LIGHTS_MAX_SPOT] {};
         u32 PointLightsCount {};
         u32 IsDirectionalLight {};
         u32 SpotLightsCount {};
+
+        /*! Uniform block "ubo_LightsStorage" layout getter function. */
+        static uniform_block_layout GetLayout()
+        {
+            return uniform_block_layout(sizeof(lights_storage), {
+                SCL_UNIFORM_ELEMENT(lights_storage, PointLightsCount),
+                SCL_UNIFORM_ELEMENT(lights_storage, IsDirectionalLight),
+                SCL_UNIFORM_ELEMENT(lights_storage, SpotLightsCount),
+            }).AddStructArray("PointLights", offsetof(lights_storage, PointLights), point_light::GetLayout(), render_context::LIGHTS_MAX_POINT)
+              .AddStruct("DirectionalLight", offsetof(lights_storage, DirectionalLight), directional_light::GetLayout())
+              .AddStructArray("SpotLights", offsetof(lights_storage, SpotLights), spot_light::GetLayout(), render_context::LIGHTS_MAX_SPOT);
+        }
     };
 
+    /*! Arrays of structures have 16 bytes aligned stride in std140 layout, so array elements structures are padded. */
+    static_assert(sizeof(point_light) % 16 == 0, "Point light structure size should be multiple of 16 bytes (std140 array stride).");
+    static_assert(sizeof(spot_light) % 16 == 0, "Spot light structure size should be multiple of 16 bytes (std140 array stride).");
+    static_assert(offsetof(directional_light, ViewProjection) % 16 == 0, "Matrix should be 16 bytes aligned (std140 matrix alignment).");
+
     /*! Render pipeline data storage class. */
     struct render_pipeline
     {
@@ -97,6 +178,7 @@ namespace scl
 
         /*! Render resources used by renderer. */
         shared<shader_program>  ShadowPassShader {};         /*! Shader program for filling depth buffer of shadow caster frame buffer. */
+        shared<shader_program>  ShadowPassIndirectShader {}; /*! Shader program for filling depth buffer of shadow caster frame buffer by indirect draws. */
         shared<shader_program>  PhongLightingApplyShader {}; /*! Shader program for applying deffered phong lighting. */
         shared<shader_program>  GaussianBlurApplyShader {};  /*! Shader program for applying bloom effect (bluring bright colors) to main buffer. */
         shared<shader_program>  TextureAddShader {};         /*! Shader program for combining (additive bluring) two textuers. */
@@ -117,8 +199,31 @@ namespace scl
         /*! Pipeline camera view projection matrix. */
         matr4 ViewProjection;
 
+        /*! Levels of detail selection data. */
+        float LodPixelError { 1 };      /*! Maximum allowed geometric error of drawn level of detail on screen (in pixels). */
+        float LodPixelsPerUnit {};      /*! Count of viewport pixels, covered by unit length at unit distance from camera (or at any distance for orthographic camera). */
+        bool  IsLodPerspective {};      /*! Flag, showing wheather level of detail projected size depends on distance to camera. */
+
+        /*! Sub-meshes clusters (meshlets) culling data. */
+        bool IsClusterCulling { true };        /*! Flag, showing wheather clustered sub-meshes are drawn by visible meshlets only. */
+        bool IsMaterialsStorage {};            /*! Flag, showing wheather indirectly drawn materials are read from materials storage (if bindless textures are supported). */
+        std::vector<index_range> ClusterRanges {}; /*! Visible meshlets index ranges of currently drawing sub-mesh (reused between draws). */
+
+        /*! Indirect drawing (of sub-meshes in geometry arena) data. */
+        indirect_draw_list GeometryDrawList {};                            /*! Geometry pass indirect draws. */
+        indirect_draw_list DepthDrawList {};                               /*! Shadow pass indirect draws. */
+        shared<storage_buffer> GeometryDrawCommandsBuffer {};              /*! Geometry pass indirect draw commands buffer. */
+        shared<storage_buffer> GeometryDrawDataBuffer {};                  /*! Geometry pass indirect draws data buffer. */
+        shared<storage_buffer> DepthDrawCommandsBuffer {};                 /*! Shadow pass indirect draw commands buffer. */
+        shared<storage_buffer> DepthDrawDataBuffer {};                     /*! Shadow pass indirect draws data buffer. */
+        std::vector<const material *> IndirectMaterials {};                /*! Materials of geometry pass indirect draws (indexed by draw material index). */
+        std::unordered_map<const material *, u32> IndirectMaterialsIndices {}; /*! Geometry pass indirect draws materials indices. */
+        std::vector<material_storage_data> MaterialsStorage {};            /*! Materials storage data of geometry pass indirect draws materials. */
+        shared<storage_buffer> MaterialsStorageBuffer {};                  /*! Materials storage buffer. */
+
         /*! Every frame updating data. */
         std::vector<submission> SubmissionsList {}; /*! Pipeline list of submited to draw meshes. */
+        std::vector<submission> ShadowCastersList {}; /*! Pipeline list of submited meshes, only casting shadows (not visible by camera). */
         lights_storage          LightsStorage {};   /*! Pipeline lights storage. */
         pipeline_data           Data {};            /*! Pipeline data. */
 
@@ -139,12 +244,20 @@ namespace scl
             IsInitialized = true;
 
             ShadowPassShader         = render_bridge::GetShadowPassShader();
+            ShadowPassIndirectShader = render_bridge::GetShadowPassIndirectShader();
             PhongLightingApplyShader = render_bridge::GetPhongLightingShader();
             GaussianBlurApplyShader  = render_bridge::GetGaussianBlurPassShader();
             TextureAddShader         = render_bridge::GetTextureAddPassShader();
             ToneMappingApplyShader   = render_bridge::GetToneMappingPassShader();
             DataBuffer               = constant_buffer::Create(sizeof(pipeline_data));
             LightsStorageBuffer      = constant_buffer::Create(sizeof(lights_storage));
+
+            // Indirect draws buffers grow on demand.
+            GeometryDrawCommandsBuffer = storage_buffer::Create(sizeof(draw_indirect_command) * 1024);
+            GeometryDrawDataBuffer     = storage_buffer::Create(sizeof(indirect_draw_data) * 1024);
+            DepthDrawCommandsBuffer    = storage_buffer::Create(sizeof(draw_indirect_command) * 1024);
+            DepthDrawDataBuffer        = storage_buffer::Create(sizeof(indirect_draw_data) * 1024);
+            MaterialsStorageBuffer     = storage_buffer::Create(sizeof(material_storage_data) * 256);
         }
 
         /*!*
@@ -156,6 +269,12 @@ namespace scl
         void Clear()
         {
             SubmissionsList.clear();
+            ShadowCastersList.clear();
+            GeometryDrawList.Clear();
+            DepthDrawList.Clear();
+            IndirectMaterials.clear();
+            IndirectMaterialsIndices.clear();
+            MaterialsStorage.clear();
             std::memset(&Data, 0, sizeof(pipeline_data));
             std::memset(&LightsStorage, 0, sizeof(lights_storage));
 
@@ -0,0 +1,44 @@
+/*!****************************************************************//*!*
+ * \file   shader_variants.cpp
+ * \brief  Shader program variants (permutations) cache class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "shader_variants.h"
+#include "primitives/shader.h"
+#include "utilities/assets_manager/shaders_load.h"
+
+scl::shader_variants::shader_variants(const std::filesystem::path &FilePath, const std::vector<std::string> &FeaturesNames) :
+    FilePath(FilePath), FeaturesNames(FeaturesNames)
+{
+    SCL_CORE_ASSERT(FeaturesNames.size() <= 32, "Shader variants features count could not exceed 32.");
+}
+
+const scl::shared<scl::shader_program> &scl::shader_variants::GetVariant(u32 FeaturesKey) const
+{
+    if (FeaturesNames.size() < 32) FeaturesKey &= (1u << FeaturesNames.size()) - 1;
+
+    auto it = Variants.find(FeaturesKey);
+    if (it != Variants.end()) return it->second;
+
+    std::vector<std::string> defines {};
+    for (u32 i = 0; i < (u32)FeaturesNames.size(); i++)
+        if (FeaturesKey & (1u << i)) defines.push_back(FeaturesNames[i]);
+
+    SCL_CORE_INFO("Shader \"{}\" variant with features key {:#x} requested, it will be compiled.", FilePath.string(), FeaturesKey);
+    return Variants[FeaturesKey] = assets_manager::LoadShader(FilePath, defines);
+}
+
+void scl::shader_variants::Update()
+{
+    for (auto &[key, variant] : Variants)
+        assets_manager::UpdateShader(variant);
+}
+
+scl::shared<scl::shader_variants> scl::shader_variants::Create(const std::filesystem::path &FilePath, const std::vector<std::string> &FeaturesNames)
+{
+    return CreateShared<shader_variants>(FilePath, FeaturesNames);
+}
@@ -0,0 +1,73 @@
+/*!****************************************************************//*!*
+ * \file   shader_variants.h
+ * \brief  Shader program variants (permutations) cache class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl
+{
+    /*! Shader program class declaration. */
+    class shader_program;
+
+    /*!*
+     * Shader program variants cache class.
+     * Each variant is compiled from same source file with "#define" directive for each feature, enabled in variant key,
+     * so features are selected at compile time instead of dynamic branching in shader.
+     * Variants are compiled lazily on first request and cached by key.
+     */
+    class shader_variants
+    {
+    private: /*! Shader program variants cache data. */
+        std::filesystem::path FilePath {};                                    /*! Shader program source file path. */
+        std::vector<std::string> FeaturesNames {};                            /*! Defines names of features (feature bit index is name index). */
+        mutable std::unordered_map<u32, shared<shader_program>> Variants {}; /*! Compiled variants by features key. */
+
+    public: /*! Shader program variants cache data getter/setter functions. */
+        /*! Shader program source file path getter function. */
+        const std::filesystem::path &GetFilePath() const { return FilePath; }
+        /*! Features defines names getter function. */
+        const std::vector<std::string> &GetFeaturesNames() const { return FeaturesNames; }
+        /*! Compiled variants count getter function. */
+        size_t GetVariantsCount() const { return Variants.size(); }
+
+    public:
+        /*!*
+         * Shader program variants cache constructor.
+         *
+         * \param FilePath - shader program source file path.
+         * \param FeaturesNames - defines names of features (feature bit index is name index).
+         */
+        shader_variants(const std::filesystem::path &FilePath, const std::vector<std::string> &FeaturesNames);
+
+        /*!*
+         * Get shader program variant (compile it if it was not requested before) function.
+         *
+         * \param FeaturesKey - bit mask of enabled features (bits out of features names count are ignored).
+         * \return shader program variant.
+         */
+        const shared<shader_program> &GetVariant(u32 FeaturesKey) const;
+
+        /*!*
+         * Recompile all already compiled variants from source file function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Update();
+
+        /*!*
+         * Shader program variants cache creation function.
+         *
+         * \param FilePath - shader program source file path.
+         * \param FeaturesNames - defines names of features (feature bit index is name index).
+         * \return created variants cache pointer.
+         */
+        static shared<shader_variants> Create(const std::filesystem::path &FilePath, const std::vector<std::string> &FeaturesNames);
+    };
+}
@@ -215,3 +215,15 @@ scl::camera &scl::camera::Move(const vec3 &MoveVector)
     InvalidateView();
     return *this;
 }
+
+scl::ray scl::camera::GetRay(float X, float Y) const
+{
+    // Up direction of projection plane is orthogonal to look direction.
+    vec3 up_direction = RightDirection.Cross(LookDirection);
+    vec3 offset = RightDirection * ((X - 0.5f) * ViewportProjectionWidth) +
+                  up_direction * ((0.5f - Y) * ViewportProjectionHeight);
+
+    if (ProjectionType == camera_projection_type::ORTHOGRAPHIC)
+        return ray(Position + offset, LookDirection);
+    return ray(Position, LookDirection * ProjectionDistance + offset);
+}
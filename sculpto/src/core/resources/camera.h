@@ -236,5 +236,13 @@ namespace scl
          * \return self reference.
          */
         camera &Move(const vec3 &MoveVector);
+
+        /*!*
+         * Get ray from camera through viewport point function.
+         *
+         * \param X, Y - viewport point coordinates in range [0; 1] (from top left viewport corner).
+         * \return ray through viewport point (direction is not normalized).
+         */
+        ray GetRay(float X, float Y) const;
     };
 }
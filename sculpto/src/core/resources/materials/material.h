@@ -13,6 +13,31 @@
 
 namespace scl
 {
+    /*!*
+     * Material data of materials storage structure.
+     * Array of structures is stored in storage buffer with std430 layout (matches "ssbo_Materials" of phong geometry pass shader),
+     * element of draw is indexed by draw material index. Maps are sampled by bindless texture handles.
+     */
+    struct material_storage_data
+    {
+        vec3  Specular {};      /*! Material specular lighting coefficient. */
+        float Shininess {};     /*! Material shiness exponent lighting coefficient. */
+        vec3  Diffuse {};       /*! Material diffuse lighting coefficient. */
+        u32   IsSpecularMap {}; /*! Flag, showing whether specular map is used. */
+        u32   IsDiffuseMap {};  /*! Flag, showing whether diffuse map is used. */
+        u32   IsEmissionMap {}; /*! Flag, showing whether emission map is used. */
+        u32   IsNormalMap {};   /*! Flag, showing whether normal map is used. */
+        u32   __dummy {};
+        u64   SpecularMap {};   /*! Specular map bindless handle. */
+        u64   DiffuseMap {};    /*! Diffuse map bindless handle. */
+        u64   EmissionMap {};   /*! Emission map bindless handle. */
+        u64   NormalMap {};     /*! Normal map bindless handle. */
+    };
+    static_assert(sizeof(material_storage_data) == 80, "Material storage data should match std430 layout.");
+    static_assert(offsetof(material_storage_data, Diffuse) == 16, "Material storage data should match std430 layout.");
+    static_assert(offsetof(material_storage_data, IsNormalMap) == 40, "Material storage data should match std430 layout.");
+    static_assert(offsetof(material_storage_data, SpecularMap) == 48, "Material storage data should match std430 layout.");
+
     /*! Mesh material class. */
     class material
     {
@@ -27,15 +52,52 @@ namespace scl
         material(shared<shader_program> Shader) :
             Shader(Shader) {}
 
+        /*!*
+         * Material shader for indirect draws (reading transformation matrices from per draw data) getter function.
+         * Material data is bound (by BindData) before indirect draw, then indirect shader is bound instead of material shader.
+         *
+         * \param None.
+         * \return shader program (nullptr if material could not be drawn indirectly).
+         */
+        virtual shared<shader_program> GetIndirectShader() const { return nullptr; }
+
+        /*!*
+         * Material data for materials storage getter function.
+         * Materials from storage are drawn by single shader, so material changes between indirect draws need no binds.
+         *
+         * \param OutData - material storage data.
+         * \return wheather material could be drawn with materials storage or not.
+         */
+        virtual bool GetStorageData(material_storage_data &OutData) const { return false; }
+
+        /*!*
+         * Material shader uniform block "ubo_Material" layout getter function.
+         * Used to validate material data structure against material shaders, when they are ready.
+         *
+         * \param None.
+         * \return material data layout (nullptr if material has no data uniform block).
+         */
+        virtual const uniform_block_layout *GetDataLayout() const { return nullptr; }
+
+        /*!*
+         * Bind material data (constant buffer and textures) without shader to current render stage function.
+         * Used when material is drawn by other shader (e.g. indirect shader variant), so its shader is not waited for.
+         *
+         * \param None.
+         * \return None.
+         */
+        virtual void BindData() const {}
+
         /*!*
          * Bind material to current render stage function.
          *
          * \param None.
          * \return None.
          */
-        virtual void Bind() const
+        void Bind() const
         {
             if (Shader != nullptr) Shader->Bind();
+            BindData();
         }
 
         /*!*
@@ -10,8 +10,10 @@
 
 #include "material.h"
 #include "core/render/render_bridge.h"
+#include "core/render/shader_variants.h"
 #include "core/render/primitives/texture.h"
 #include "core/render/primitives/buffer.h"
+#include "core/render/primitives/uniform_block_layout.h"
 
 namespace scl
 {
@@ -19,18 +21,24 @@ namespace scl
     class material_phong : public material
     {
     private: /*! Material for blin-phong lighing model data. */
-        /*! Structure to use ass shader buffer data. */
+        /*!*
+         * Structure to use ass shader buffer data.
+         * Maps flags are resolved by shader variant at compile time, so they are not uploaded and block takes 32 bytes instead of 48.
+         */
         struct buffer_data
         {
             vec3   Specular {};       /*! Material specular lighting coefficient. */
             float  Shininess {};      /*! Material shiness exponent lighting coefficient. */
             vec3   Diffuse {};        /*! Material diffuse lighting coefficient. */
-            u32    IsSpecularMap {};  /*! Flag, showing whether specular map passing to shader. */
-            u32    IsDiffuseMap {};   /*! Flag, showing whether diffuse map passing to shader. */
-            u32    IsEmissionMap {};  /*! Flag, showing whether normal map passing to shader. */
-            u32    IsNormalMap {};    /*! Flag, showing whether normal map passing to shader. */
+            float  __dummy {};
         } Data {};
 
+        /*! Material maps usage flags. */
+        bool IsSpecularMap {};  /*! Flag, showing whether specular map passing to shader. */
+        bool IsDiffuseMap {};   /*! Flag, showing whether diffuse map passing to shader. */
+        bool IsEmissionMap {};  /*! Flag, showing whether normal map passing to shader. */
+        bool IsNormalMap {};    /*! Flag, showing whether normal map passing to shader. */
+
         /*! Constant shader buffer for passing material data to shader. */
         shared<constant_buffer> DataBuffer {};
 
@@ -40,6 +48,18 @@ namespace scl
         shared<texture_2d> EmissionMapTexture {};
         shared<texture_2d> NormalMapTexture {};
 
+        /*!*
+         * Select geometry pass shader variant, matching material features (set maps), function.
+         * Variant is compiled lazily, so features are resolved at shader compile time instead of dynamic branching.
+         *
+         * \param None.
+         * \return None.
+         */
+        void UpdateShaderVariant()
+        {
+            Shader = render_bridge::GetPhongGeometryShaderVariants()->GetVariant(GetFeaturesKey());
+        }
+
     public: /*! Material for blin-phong lighing model data getter setter functions. */
         /*! Material specular lighting coefficient getter function. */
         const vec3 &GetSpecular() const { return Data.Specular; }
@@ -49,13 +69,64 @@ namespace scl
         float GetShininess() const { return Data.Shininess; }
 
         /*! Flag, showing whether specular map passing to shader getter function. */
-        bool GetIsSpecularMap() const { return Data.IsSpecularMap; }
+        bool GetIsSpecularMap() const { return IsSpecularMap; }
         /*! Flag, showing whether diffuse map passing to shader getter function. */
-        bool GetIsDiffuseMap() const { return Data.IsDiffuseMap; }
+        bool GetIsDiffuseMap() const { return IsDiffuseMap; }
         /*! Flag, showing whether normal map passing to shader getter function. */
-        bool GetIsEmissionMap() const { return Data.IsEmissionMap; }
+        bool GetIsEmissionMap() const { return IsEmissionMap; }
         /*! Flag, showing whether normal map passing to shader getter function. */
-        bool GetIsNormalMap() const { return Data.IsNormalMap; }
+        bool GetIsNormalMap() const { return IsNormalMap; }
+
+        /*! Material features (render_context::PHONG_FEATURE_* bits) key getter function. */
+        u32 GetFeaturesKey() const
+        {
+            return (IsDiffuseMap  ? render_context::PHONG_FEATURE_DIFFUSE_MAP  : 0) |
+                   (IsSpecularMap ? render_context::PHONG_FEATURE_SPECULAR_MAP : 0) |
+                   (IsEmissionMap ? render_context::PHONG_FEATURE_EMISSION_MAP : 0) |
+                   (IsNormalMap   ? render_context::PHONG_FEATURE_NORMAL_MAP   : 0);
+        }
+
+        /*! Geometry pass shader variant for indirect draws getter function. */
+        shared<shader_program> GetIndirectShader() const override
+        {
+            return render_bridge::GetPhongGeometryShaderVariants()->GetVariant(GetFeaturesKey() | render_context::PHONG_FEATURE_INDIRECT_DRAW);
+        }
+
+        /*! Material data for materials storage getter function. Maps should have bindless handles. */
+        bool GetStorageData(material_storage_data &OutData) const override
+        {
+            OutData.Specular = Data.Specular;
+            OutData.Shininess = Data.Shininess;
+            OutData.Diffuse = Data.Diffuse;
+            OutData.IsSpecularMap = SpecularMapTexture && IsSpecularMap;
+            OutData.IsDiffuseMap = DiffuseMapTexture && IsDiffuseMap;
+            OutData.IsEmissionMap = EmissionMapTexture && IsEmissionMap;
+            OutData.IsNormalMap = NormalMapTexture && IsNormalMap;
+            OutData.SpecularMap = OutData.IsSpecularMap ? SpecularMapTexture->GetBindlessHandle() : 0;
+            OutData.DiffuseMap = OutData.IsDiffuseMap ? DiffuseMapTexture->GetBindlessHandle() : 0;
+            OutData.EmissionMap = OutData.IsEmissionMap ? EmissionMapTexture->GetBindlessHandle() : 0;
+            OutData.NormalMap = OutData.IsNormalMap ? NormalMapTexture->GetBindlessHandle() : 0;
+
+            return (!OutData.IsSpecularMap || OutData.SpecularMap != 0) && (!OutData.IsDiffuseMap || OutData.DiffuseMap != 0) &&
+                   (!OutData.IsEmissionMap || OutData.EmissionMap != 0) && (!OutData.IsNormalMap || OutData.NormalMap != 0);
+        }
+
+        /*! Material shader uniform block "ubo_Material" layout getter function. */
+        static uniform_block_layout GetBufferLayout()
+        {
+            return uniform_block_layout(sizeof(buffer_data), {
+                SCL_UNIFORM_ELEMENT(buffer_data, Specular),
+                SCL_UNIFORM_ELEMENT(buffer_data, Shininess),
+                SCL_UNIFORM_ELEMENT(buffer_data, Diffuse),
+            });
+        }
+
+        /*! Material shader uniform block "ubo_Material" layout getter function. */
+        const uniform_block_layout *GetDataLayout() const override
+        {
+            static const uniform_block_layout layout = GetBufferLayout();
+            return &layout;
+        }
 
         /*! Diffuse map getter function. */
         const shared<texture_2d> &GetDiffuseMapTexture() const { return DiffuseMapTexture; }
@@ -68,25 +139,19 @@ namespace scl
 
         /*! Diffuse coeffisient setter function.*/
         void SetDiffuse(const vec3 &Diffuse) {
-            if (DiffuseMapTexture)
-            {
-                DiffuseMapTexture->Free();
-                DiffuseMapTexture = nullptr;
-            }
+            DiffuseMapTexture = nullptr;
             Data.Diffuse = Diffuse;
-            Data.IsDiffuseMap = false;
+            IsDiffuseMap = false;
             DataBuffer->Update(&Data, sizeof(Data));
+            UpdateShaderVariant();
         }
         /*! Specular coefficient setter function. */
         void SetSpecular(const vec3 &Specular) {
-            if (SpecularMapTexture)
-            {
-                SpecularMapTexture->Free();
-                SpecularMapTexture = nullptr;
-            }
+            SpecularMapTexture = nullptr;
             Data.Specular = Specular;
-            Data.IsSpecularMap = false;
+            IsSpecularMap = false;
             DataBuffer->Update(&Data, sizeof(Data));
+            UpdateShaderVariant();
         }
         /*! Shiness exponent setter function. */
         void SetShininess(float Shininess) {
@@ -98,48 +163,44 @@ namespace scl
         void SetDiffuseMapTexture(shared<texture_2d> DiffuseMapTexture) {
             if (!DiffuseMapTexture) return;
 
-            if (this->DiffuseMapTexture) this->DiffuseMapTexture->Free();
             this->DiffuseMapTexture = DiffuseMapTexture;
-            if (!Data.IsDiffuseMap)
+            if (!IsDiffuseMap)
             {
-                Data.IsDiffuseMap = true;
-                DataBuffer->Update(&Data, sizeof(Data));
+                IsDiffuseMap = true;
+                UpdateShaderVariant();
             }
         }
         /*! Specular map setter function. */
         void SetSpecularMapTexture(shared<texture_2d> SpecularMapTexture) {
             if (!SpecularMapTexture) return;
 
-            if (this->SpecularMapTexture) this->SpecularMapTexture->Free();
             this->SpecularMapTexture = SpecularMapTexture;
-            if (!Data.IsSpecularMap)
+            if (!IsSpecularMap)
             {
-                Data.IsSpecularMap = true;
-                DataBuffer->Update(&Data, sizeof(Data));
+                IsSpecularMap = true;
+                UpdateShaderVariant();
             }
         }
         /*! Emission map setter function. */
         void SetEmissionMapTexture(shared<texture_2d> EmissionMapTexture) {
             if (!EmissionMapTexture) return;
 
-            if (this->EmissionMapTexture) this->EmissionMapTexture->Free();
             this->EmissionMapTexture = EmissionMapTexture;
-            if (!Data.IsEmissionMap)
+            if (!IsEmissionMap)
             {
-                Data.IsEmissionMap = true;
-                DataBuffer->Update(&Data, sizeof(Data));
+                IsEmissionMap = true;
+                UpdateShaderVariant();
             }
         }
         /*! Normal map setter function. */
         void SetNormalMapTexture(shared<texture_2d> NormalMapTexture) {
             if (!NormalMapTexture) return;
 
-            if (this->NormalMapTexture) this->NormalMapTexture->Free();
             this->NormalMapTexture = NormalMapTexture;
-            if (!Data.IsNormalMap)
+            if (!IsNormalMap)
             {
-                Data.IsNormalMap = true;
-                DataBuffer->Update(&Data, sizeof(Data));
+                IsNormalMap = true;
+                UpdateShaderVariant();
             }
         }
 
@@ -167,20 +228,19 @@ namespace scl
         }
 
         /*!*
-         * Bind material to current render stage function.
+         * Bind material data (constant buffer and textures) to current render stage function.
          *
          * \param None.
          * \return None.
          */
-        void Bind() const override
+        void BindData() const override
         {
-            if (Shader != nullptr) Shader->Bind();
             if (DataBuffer != nullptr) DataBuffer->Bind(render_context::BINDING_POINT_MATERIAL_DATA);
 
-            if (DiffuseMapTexture && Data.IsDiffuseMap) DiffuseMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_DIFFUSE);
-            if (SpecularMapTexture && Data.IsSpecularMap) SpecularMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_SPECULAR);
-            if (EmissionMapTexture && Data.IsEmissionMap) EmissionMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_EMISSION_MAP);
-            if (NormalMapTexture && Data.IsNormalMap) NormalMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_NORMAL_MAP);
+            if (DiffuseMapTexture && IsDiffuseMap) DiffuseMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_DIFFUSE);
+            if (SpecularMapTexture && IsSpecularMap) SpecularMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_SPECULAR);
+            if (EmissionMapTexture && IsEmissionMap) EmissionMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_EMISSION_MAP);
+            if (NormalMapTexture && IsNormalMap) NormalMapTexture->Bind(render_context::TEXTURE_SLOT_MATERIAL_NORMAL_MAP);
         }
 
         /*!*
@@ -193,9 +253,9 @@ namespace scl
         {
             if (Shader != nullptr) Shader->Unbind();
             if (DataBuffer != nullptr) DataBuffer->Unbind();
-            if (SpecularMapTexture && Data.IsSpecularMap) SpecularMapTexture->Unbind();
-            if (DiffuseMapTexture && Data.IsDiffuseMap) DiffuseMapTexture->Unbind();
-            if (NormalMapTexture && Data.IsNormalMap) NormalMapTexture->Unbind();
+            if (SpecularMapTexture && IsSpecularMap) SpecularMapTexture->Unbind();
+            if (DiffuseMapTexture && IsDiffuseMap) DiffuseMapTexture->Unbind();
+            if (NormalMapTexture && IsNormalMap) NormalMapTexture->Unbind();
         }
 
        /*!*
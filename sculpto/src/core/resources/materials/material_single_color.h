@@ -12,6 +12,7 @@
 #include "core/render/render_bridge.h"
 #include "core/render/primitives/texture.h"
 #include "core/render/primitives/buffer.h"
+#include "core/render/primitives/uniform_block_layout.h"
 
 namespace scl
 {
@@ -37,13 +38,25 @@ namespace scl
 
         const shared<texture_2d> &GetTexture() const { return Texture; }
 
+        /*! Material shader uniform block "ubo_Material" layout getter function. */
+        static uniform_block_layout GetBufferLayout()
+        {
+            return uniform_block_layout(sizeof(buffer_data), {
+                SCL_UNIFORM_ELEMENT(buffer_data, Color),
+                SCL_UNIFORM_ELEMENT(buffer_data, IsTexture),
+            });
+        }
+
+        /*! Material shader uniform block "ubo_Material" layout getter function. */
+        const uniform_block_layout *GetDataLayout() const override
+        {
+            static const uniform_block_layout layout = GetBufferLayout();
+            return &layout;
+        }
+
         /*! Color setter function. */
         void SetColor(const vec3 &Color) {
-            if (Texture)
-            {
-                Texture->Free();
-                Texture = nullptr;
-            }
+            Texture = nullptr;
             Data.IsTexture = false;
             Data.Color = Color;
             DataBuffer->Update(&Data, sizeof(Data));
@@ -52,7 +65,6 @@ namespace scl
         void SetTexture(shared<texture_2d> Texture) {
             if (!Texture) return;
 
-            if (this->Texture) this->Texture->Free();
             this->Texture = Texture;
             if (!Data.IsTexture)
             {
@@ -93,14 +105,13 @@ namespace scl
         }
 
         /*!*
-         * Bind material to current render stage function.
+         * Bind material data (constant buffer and textures) to current render stage function.
          *
          * \param None.
          * \return None.
          */
-        void Bind() const override
+        void BindData() const override
         {
-            if (Shader) Shader->Bind();
             if (DataBuffer) DataBuffer->Bind(render_context::BINDING_POINT_MATERIAL_DATA);
             if (Texture && Data.IsTexture) Texture->Bind(render_context::TEXTURE_SLOT_MATERIAL_DIFFUSE);
         }
@@ -26,7 +26,6 @@ namespace scl
         /*! Texture setter function.*/
         void SetTexture(shared<texture_2d> Texture) {
             if (!Texture) return;
-            if (this->Texture) this->Texture->Free();
             this->Texture = Texture;
         }
 
@@ -48,15 +47,14 @@ namespace scl
         }
 
         /*!*
-         * Bind material to current render stage function.
+         * Bind material data (texture and depth test mode) to current render stage function.
          *
          * \param None.
          * \return None.
          */
-        void Bind() const override
+        void BindData() const override
         {
             render_bridge::SetDepthTestMode(false);
-            if (Shader) Shader->Bind();
             if (Texture) Texture->Bind(render_context::TEXTURE_SLOT_MATERIAL_DIFFUSE);
         }
 
@@ -13,8 +13,10 @@
 
 #include "materials/material.h"
 #include "topology/trimesh.h"
+#include "topology/meshlets.h"
 #include "core/render/primitives/vertex_array.h"
 #include "core/render/primitives/buffer.h"
+#include "core/render/geometry_arena.h"
 
 namespace scl
 {
@@ -31,6 +33,15 @@ namespace scl
     {
         friend class renderer;
 
+        /*! Sub-mesh level of detail (simplified triangles over sub-mesh vertex buffer) structure. */
+        struct submesh_lod
+        {
+            shared<vertex_array> VertexArray {};
+            shared<index_buffer> IndexBuffer {};
+            float Error {};  /*! Maximum geometric deviation from full detail sub-mesh (in mesh space units). */
+            index_range ArenaIndices {}; /*! Level of detail triangles range of sub-mesh geometry arena page index buffer (empty if not allocated). */
+        };
+
         /*! Single mesh data structure. */
         struct submesh_data
         {
@@ -39,16 +50,51 @@ namespace scl
             shared<index_buffer> IndexBuffer {};
             shared<material> Material {};
             matr4 LocalTransform {};
+            bound_box BoundBox {};              /*! Sub-mesh bound box in mesh local space. */
+            std::vector<submesh_lod> Lods {};   /*! Sub-mesh levels of detail (from most to least detailed). */
+            std::vector<topology::meshlet> Meshlets {}; /*! Sub-mesh full detail triangles clusters (empty if sub-mesh is not clustered). */
+            geometry_arena_allocation ArenaAllocation {}; /*! Sub-mesh geometry allocation in geometry arena (empty if sub-mesh is not in arena). */
+
+            /*!*
+             * Get index of least detailed level of detail, which error does not exceed specified one, function.
+             * Not positive maximum error always selects full detail sub-mesh (even if level of detail has zero error).
+             *
+             * \param MaxError - maximum allowed geometric error (in mesh space units).
+             * \return level of detail index (-1 for full detail sub-mesh).
+             */
+            int GetLodIndex(float MaxError) const
+            {
+                if (MaxError <= 0) return -1;
+                for (int i = (int)Lods.size() - 1; i >= 0; i--)
+                    if (Lods[i].Error <= MaxError) return i;
+                return -1;
+            }
+
+            /*!*
+             * Get vertex array of least detailed level of detail, which error does not exceed specified one, function.
+             *
+             * \param MaxError - maximum allowed geometric error (in mesh space units).
+             * \return vertex array to draw.
+             */
+            const shared<vertex_array> &GetLodVertexArray(float MaxError) const
+            {
+                int lod = GetLodIndex(MaxError);
+                return lod < 0 ? VertexArray : Lods[lod].VertexArray;
+            }
         };
 
     public: /*! Mesh data. */
         std::string FileName {};                /*! File name file, from which model was loaded. */
         std::vector<submesh_data> SubMeshes {}; /*! Mesh submesmeshes (primitives) list. */
+        bound_box BoundBox {};                  /*! Mesh (all sub-meshes) bound box in mesh local space. */
 
         /*! Mesh rendering flags. */
         bool IsDrawing       = true; /*! Flag, showing wheather mesh is submited to render, during main geometry render pass. */
         bool IsCastingShadow = true; /*! Flag, showing wheather mesh is submiter to render, during shadow caster shadom map generation (render pass). */
 
+        /*! Mesh default constructor (creates mesh without sub-meshes). */
+        mesh() = default;
+
         /*!*
          * Mesh constructor by topology object and material.
          *
@@ -58,18 +104,7 @@ namespace scl
         template <typename Ttopology>
         mesh(const Ttopology &TopologyObject, shared<material> Material)
         {
-            submesh_data new_sub_mesh {};
-            new_sub_mesh.VertexArray = vertex_array::Create(TopologyObject.GetType());
-            new_sub_mesh.VertexBuffer = vertex_buffer::Create(TopologyObject.GetVertices().data(),
-                                                              (u32)TopologyObject.GetVertices().size(),
-                                                              vertex::GetVertexLayout());
-            new_sub_mesh.IndexBuffer = index_buffer::Create((u32 *)TopologyObject.GetIndices().data(),
-                                                            (u32)TopologyObject.GetIndices().size());
-            new_sub_mesh.VertexArray->SetIndexBuffer(new_sub_mesh.IndexBuffer);
-            new_sub_mesh.VertexArray->SetVertexBuffer(new_sub_mesh.VertexBuffer);
-
-            new_sub_mesh.Material = Material;
-            SubMeshes.push_back(new_sub_mesh);
+            AddSubmesh(TopologyObject, Material);
             FileName = typeid(Ttopology).name();
 
             SCL_CORE_INFO("Mesh with 1 sub-mesh created.");
@@ -83,31 +118,135 @@ namespace scl
         template <typename Tvertex>
         mesh(const std::vector<submesh_props<Tvertex>> &SubmeshesProperties)
         {
+            SubMeshes.reserve(SubmeshesProperties.size());
             for (const auto &submesh_prop : SubmeshesProperties)
-            {
-                submesh_data new_sub_mesh {};
-                new_sub_mesh.VertexArray = vertex_array::Create(submesh_prop.Topology.GetType());
-                new_sub_mesh.VertexBuffer = vertex_buffer::Create(submesh_prop.Topology.GetVertices().data(),
-                                                                  (u32)submesh_prop.Topology.GetVertices().size(),
-                                                                  vertex::GetVertexLayout());
-                new_sub_mesh.IndexBuffer = index_buffer::Create((u32 *)submesh_prop.Topology.GetIndices().data(),
-                                                                (u32)submesh_prop.Topology.GetIndices().size());
-                new_sub_mesh.VertexArray->SetIndexBuffer(new_sub_mesh.IndexBuffer);
-                new_sub_mesh.VertexArray->SetVertexBuffer(new_sub_mesh.VertexBuffer);
-
-                new_sub_mesh.Material = submesh_prop.Material;
-                SubMeshes.push_back(new_sub_mesh);
-            }
+                AddSubmesh(submesh_prop.Topology, submesh_prop.Material);
 
             SCL_CORE_INFO("Mesh with {} sub-mesh(es) created.", SubmeshesProperties.size());
         }
 
+        /*! Mesh copy constructor is deleted, because sub-meshes own their geometry arena allocations. */
+        mesh(const mesh &Other) = delete;
+
         /*! Mesh default destructor. */
         ~mesh()
         {
+            for (const auto &submesh : SubMeshes)
+            {
+                for (const auto &lod : submesh.Lods)
+                    geometry_arena::Get().FreeIndices(submesh.ArenaAllocation.Page, lod.ArenaIndices);
+                geometry_arena::Get().Free(submesh.ArenaAllocation);
+            }
             SCL_CORE_INFO("Mesh with {} sub-mesh(es) freed.", SubMeshes.size());
         }
 
+        /*!*
+         * Upload topology object to GPU and add it to mesh as new sub-mesh function.
+         *
+         * \param TopologyObject - topology object to create vertex array from.
+         * \param Material - sub-mesh material.
+         * \return None.
+         */
+        template <typename Ttopology>
+        void AddSubmesh(const Ttopology &TopologyObject, shared<material> Material)
+        {
+            const auto &vertices = TopologyObject.GetVertices();
+            const auto &indices = TopologyObject.GetIndices();
+
+            submesh_data new_sub_mesh {};
+            new_sub_mesh.VertexArray = vertex_array::Create(TopologyObject.GetType());
+            new_sub_mesh.VertexBuffer = vertex_buffer::Create(vertices.data(), (u32)vertices.size(), vertex::GetVertexLayout());
+            new_sub_mesh.IndexBuffer = index_buffer::Create((u32 *)indices.data(), (u32)indices.size());
+            new_sub_mesh.VertexArray->SetIndexBuffer(new_sub_mesh.IndexBuffer);
+            new_sub_mesh.VertexArray->SetVertexBuffer(new_sub_mesh.VertexBuffer);
+
+            if (geometry_arena::Get().GetEnabled() && TopologyObject.GetType() == mesh_type::TRIANGLES)
+                geometry_arena::Get().Allocate(vertices, indices, new_sub_mesh.ArenaAllocation);
+
+            new_sub_mesh.Material = Material;
+            for (const auto &v : vertices)
+                new_sub_mesh.BoundBox.Extend(v.Position);
+            BoundBox = bound_box::Union(BoundBox, new_sub_mesh.BoundBox);
+            SubMeshes.push_back(std::move(new_sub_mesh));
+        }
+
+        /*!*
+         * Add sub-mesh, created from triangles vertices and indices views, to mesh function.
+         * Data is uploaded to GPU directly from views, so it could point to any memory (e.g. memory mapped file).
+         *
+         * \param Vertices - sub-mesh vertices.
+         * \param Indices - sub-mesh vertices indices.
+         * \param Material - sub-mesh material.
+         * \param SubmeshBoundBox - sub-mesh vertices bound box.
+         * \return None.
+         */
+        void AddSubmesh(std::span<const vertex> Vertices, std::span<const u32> Indices,
+                        shared<material> Material, const bound_box &SubmeshBoundBox)
+        {
+            submesh_data new_sub_mesh {};
+            new_sub_mesh.VertexArray = vertex_array::Create(mesh_type::TRIANGLES);
+            new_sub_mesh.VertexBuffer = vertex_buffer::Create(Vertices.data(), (u32)Vertices.size(), vertex::GetVertexLayout());
+            new_sub_mesh.IndexBuffer = index_buffer::Create((u32 *)Indices.data(), (u32)Indices.size());
+            new_sub_mesh.VertexArray->SetIndexBuffer(new_sub_mesh.IndexBuffer);
+            new_sub_mesh.VertexArray->SetVertexBuffer(new_sub_mesh.VertexBuffer);
+            if (geometry_arena::Get().GetEnabled())
+                geometry_arena::Get().Allocate(Vertices, Indices, new_sub_mesh.ArenaAllocation);
+
+            new_sub_mesh.Material = Material;
+            new_sub_mesh.BoundBox = SubmeshBoundBox;
+            SubMeshes.push_back(std::move(new_sub_mesh));
+            BoundBox = bound_box::Union(BoundBox, SubmeshBoundBox);
+        }
+
+        /*!*
+         * Add level of detail to last added sub-mesh function.
+         * Level of detail triangles are drawn with sub-mesh vertex buffer.
+         *
+         * \param Indices - level of detail triangles vertices indices.
+         * \param Error - level of detail maximum geometric deviation from full detail sub-mesh (in mesh space units).
+         * \return None.
+         */
+        void AddSubmeshLod(std::span<const u32> Indices, float Error)
+        {
+            SCL_CORE_ASSERT(!SubMeshes.empty(), "Level of detail could not be added to mesh without sub-meshes.");
+
+            submesh_data &submesh = SubMeshes.back();
+            submesh_lod new_lod {};
+            new_lod.VertexArray = vertex_array::Create(submesh.VertexArray->GetType());
+            new_lod.IndexBuffer = index_buffer::Create((u32 *)Indices.data(), (u32)Indices.size());
+            new_lod.VertexArray->SetIndexBuffer(new_lod.IndexBuffer);
+            new_lod.VertexArray->SetVertexBuffer(submesh.VertexBuffer);
+            new_lod.Error = Error;
+            if (submesh.ArenaAllocation.IsAllocated())
+                geometry_arena::Get().AllocateIndices(submesh.ArenaAllocation.Page, Indices, new_lod.ArenaIndices);
+            submesh.Lods.push_back(std::move(new_lod));
+        }
+
+        /*!*
+         * Set last added sub-mesh triangles clusters function.
+         * Meshlets are ranges of sub-mesh index buffer, so they are culled and drawn without additional GPU data.
+         *
+         * \param Meshlets - sub-mesh full detail triangles clusters.
+         * \return None.
+         */
+        void AddSubmeshMeshlets(std::span<const topology::meshlet> Meshlets)
+        {
+            SCL_CORE_ASSERT(!SubMeshes.empty(), "Meshlets could not be added to mesh without sub-meshes.");
+
+            SubMeshes.back().Meshlets.assign(Meshlets.begin(), Meshlets.end());
+        }
+
+        /*!*
+         * Empty mesh (without sub-meshes) creation function.
+         *
+         * \param None.
+         * \return created mesh pointer.
+         */
+        static shared<mesh> Create()
+        {
+            return CreateShared<mesh>();
+        }
+
         /*!*
          * Mesh constructor by topology object and material.
          *
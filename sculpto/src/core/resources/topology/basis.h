@@ -27,9 +27,9 @@ namespace scl::topology
         /*! Topology object type getter function. */
         const mesh_type GetType() const { return MeshType; }
         /*! Topology obect basis vertices getter function. */
-        const std::vector<Tvertex> GetVertices() const { return Vertices; }
+        const std::vector<Tvertex> &GetVertices() const { return Vertices; }
         /*! Topology obect basis vertices indices getter function. */
-        const std::vector<u32> GetIndices() const { return Indices; }
+        const std::vector<u32> &GetIndices() const { return Indices; }
         /*! Object bound box minimum point getter function. */
         const vec3 &GetBoundMin() const { return Min; }
         /*! Object bound box maximum point getter function. */
@@ -64,7 +64,13 @@ namespace scl::topology
          * \param Indices - vertices indices rvalue ref.
          */
         basis(mesh_type MeshType, std::vector<Tvertex> &&Vertices, std::vector<u32> &&Indices) :
-            Vertices(std::move(Vertices)), Indices(std::move(Indices)) {}
+            MeshType(MeshType), Vertices(std::move(Vertices)), Indices(std::move(Indices)) {}
+
+        /*! Topology object basis default copy and move constructors and assignment operators. */
+        basis(const basis &Other) = default;
+        basis(basis &&Other) noexcept = default;
+        basis &operator=(const basis &Other) = default;
+        basis &operator=(basis &&Other) noexcept = default;
 
         /*! Topology object basis default destructor. */
         virtual ~basis() = default;
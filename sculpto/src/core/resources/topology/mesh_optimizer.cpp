@@ -0,0 +1,312 @@
+/*!****************************************************************//*!*
+ * \file   mesh_optimizer.cpp
+ * \brief  Topology object triangles mesh GPU rendering optimization functions implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   31 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "mesh_optimizer.h"
+#include "vertex_triangles.h"
+
+namespace scl::topology
+{
+    /*! Vertex cache optimization constants (see Tom Forsyth "Linear-Speed Vertex Cache Optimisation"). */
+    static constexpr u32 FORSYTH_CACHE_SIZE = 32;
+    static constexpr float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+    static constexpr float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+    static constexpr float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+    static constexpr float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+    /*!*
+     * Evaluate vertex score for vertex cache optimization function.
+     *
+     * \param CachePosition - vertex position in simulated cache (-1 if vertex is not in cache).
+     * \param RemainingTriangles - count of not emitted vertex triangles.
+     * \return vertex score.
+     */
+    static float GetVertexCacheScore(int CachePosition, u32 RemainingTriangles)
+    {
+        if (RemainingTriangles == 0) return -1;
+
+        float score = 0;
+        if (CachePosition >= 0)
+            if (CachePosition < 3)
+                // Vertices of last triangle get fixed score, so triangles are not sticked to them too much.
+                score = FORSYTH_LAST_TRIANGLE_SCORE;
+            else
+                score = powf(1 - (CachePosition - 3) / (float)(FORSYTH_CACHE_SIZE - 3), FORSYTH_CACHE_DECAY_POWER);
+
+        // Vertices with few remaining triangles are boosted, so they are removed from mesh sooner.
+        return score + FORSYTH_VALENCE_BOOST_SCALE * powf((float)RemainingTriangles, -FORSYTH_VALENCE_BOOST_POWER);
+    }
+
+    /*! Vertex bytes hash function (for exact vertices matching). */
+    struct vertex_bytes_hash
+    {
+        size_t operator()(const vertex &V) const
+        {
+            const u8 *bytes = (const u8 *)&V;
+            u64 hash = 14695981039346656037ull;
+            for (size_t i = 0; i < sizeof(vertex); i++)
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            return (size_t)hash;
+        }
+    };
+
+    /*! Vertex bytes equality function (for exact vertices matching). */
+    struct vertex_bytes_equal
+    {
+        bool operator()(const vertex &A, const vertex &B) const { return memcmp(&A, &B, sizeof(vertex)) == 0; }
+    };
+}
+
+scl::topology::vertex_cache_stats scl::topology::AnalyzeVertexCache(const std::vector<u32> &Indices, size_t VerticesCount, u32 CacheSize)
+{
+    vertex_cache_stats stats {};
+    stats.TrianglesCount = Indices.size() / 3;
+
+    // Vertex is in FIFO cache, if less than cache size vertices were transformed since it.
+    std::vector<size_t> timestamps(VerticesCount, 0);
+    size_t time = (size_t)CacheSize + 1;
+    for (size_t i = 0; i < stats.TrianglesCount * 3; i++)
+    {
+        u32 index = Indices[i];
+        if (timestamps[index] == 0) stats.VerticesCount++;
+        if (time - timestamps[index] > CacheSize)
+            timestamps[index] = time++, stats.Misses++;
+    }
+    return stats;
+}
+
+void scl::topology::DeduplicateVertices(std::vector<vertex> &Vertices, std::vector<u32> &Indices)
+{
+    std::unordered_map<vertex, u32, vertex_bytes_hash, vertex_bytes_equal> unique_vertices {};
+    unique_vertices.reserve(Vertices.size());
+
+    std::vector<u32> remap(Vertices.size());
+    u32 unique_count = 0;
+    for (size_t v = 0; v < Vertices.size(); v++)
+    {
+        auto [it, is_inserted] = unique_vertices.emplace(Vertices[v], unique_count);
+        if (is_inserted) Vertices[unique_count++] = Vertices[v];
+        remap[v] = it->second;
+    }
+
+    if (unique_count == Vertices.size()) return;
+    Vertices.resize(unique_count);
+    for (auto &index : Indices)
+        index = remap[index];
+}
+
+void scl::topology::OptimizeVertexCache(std::vector<u32> &Indices, size_t VerticesCount)
+{
+    const size_t triangles_count = Indices.size() / 3;
+    if (triangles_count == 0) return;
+
+    // Vertex triangles list first remaining count elements are not emitted triangles.
+    vertex_triangles adjacency(Indices, VerticesCount);
+    std::vector<u32> remaining(VerticesCount);
+    std::vector<int> cache_positions(VerticesCount, -1);
+    std::vector<float> vertices_scores(VerticesCount);
+    for (u32 v = 0; v < VerticesCount; v++)
+        remaining[v] = adjacency.GetCount(v),
+        vertices_scores[v] = GetVertexCacheScore(-1, remaining[v]);
+
+    std::vector<float> triangles_scores(triangles_count);
+    std::vector<bool> is_emitted(triangles_count);
+    for (size_t t = 0; t < triangles_count; t++)
+        triangles_scores[t] = vertices_scores[Indices[t * 3 + 0]] +
+                              vertices_scores[Indices[t * 3 + 1]] +
+                              vertices_scores[Indices[t * 3 + 2]];
+
+    std::vector<u32> cache {}, new_cache {};
+    cache.reserve(FORSYTH_CACHE_SIZE + 3), new_cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    std::vector<u32> optimized_indices {};
+    optimized_indices.reserve(triangles_count * 3);
+
+    size_t next_unemitted = 0;
+    size_t best_triangle = 0;
+    bool has_best_triangle = true;
+    while (optimized_indices.size() < triangles_count * 3)
+    {
+        // If there is no triangle, sharing vertices with cache, start from next not emitted one.
+        if (!has_best_triangle)
+        {
+            while (is_emitted[next_unemitted]) next_unemitted++;
+            best_triangle = next_unemitted;
+        }
+
+        // Emit triangle and remove it from its vertices remaining triangles lists.
+        const u32 *triangle = &Indices[best_triangle * 3];
+        is_emitted[best_triangle] = true;
+        new_cache.clear();
+        for (u32 k = 0; k < 3; k++)
+        {
+            u32 v = triangle[k];
+            optimized_indices.push_back(v);
+
+            u32 *list = &adjacency.Triangles[adjacency.Offsets[v]];
+            for (u32 i = 0; i < remaining[v]; i++)
+                if (list[i] == best_triangle)
+                {
+                    std::swap(list[i], list[remaining[v] - 1]);
+                    remaining[v]--;
+                    break;
+                }
+            if (std::find(new_cache.begin(), new_cache.end(), v) == new_cache.end())
+                new_cache.push_back(v);
+        }
+
+        // Move triangle vertices to cache front, push out least recently used vertices.
+        for (u32 v : cache)
+            if (std::find(new_cache.begin(), new_cache.end(), v) == new_cache.end())
+                new_cache.push_back(v);
+        for (size_t i = FORSYTH_CACHE_SIZE; i < new_cache.size(); i++)
+            cache_positions[new_cache[i]] = -1;
+        if (new_cache.size() > FORSYTH_CACHE_SIZE)
+            new_cache.resize(FORSYTH_CACHE_SIZE);
+        for (size_t i = 0; i < new_cache.size(); i++)
+            cache_positions[new_cache[i]] = (int)i;
+
+        // Update scores of pushed out and cached vertices and their triangles.
+        auto update_vertex_score = [&](u32 V)
+        {
+            float score = GetVertexCacheScore(cache_positions[V], remaining[V]);
+            float delta = score - vertices_scores[V];
+            vertices_scores[V] = score;
+            for (u32 i = 0; i < remaining[V]; i++)
+                triangles_scores[adjacency.Triangles[adjacency.Offsets[V] + i]] += delta;
+        };
+        for (u32 v : cache)
+            if (cache_positions[v] < 0) update_vertex_score(v);
+        for (u32 v : new_cache)
+            update_vertex_score(v);
+        std::swap(cache, new_cache);
+
+        // Best next triangle is searched among cached vertices triangles only.
+        float best_score = -1;
+        has_best_triangle = false;
+        for (u32 v : cache)
+            for (u32 i = 0; i < remaining[v]; i++)
+            {
+                u32 t = adjacency.Triangles[adjacency.Offsets[v] + i];
+                if (triangles_scores[t] > best_score)
+                    best_score = triangles_scores[t], best_triangle = t, has_best_triangle = true;
+            }
+    }
+
+    std::copy(optimized_indices.begin(), optimized_indices.end(), Indices.begin());
+}
+
+void scl::topology::OptimizeOverdraw(std::vector<u32> &Indices, const std::vector<vertex> &Vertices, float Threshold)
+{
+    const size_t triangles_count = Indices.size() / 3;
+    if (triangles_count == 0) return;
+    vertex_cache_stats source_stats = AnalyzeVertexCache(Indices, Vertices.size());
+
+    // Split triangles to clusters on hard boundaries (all triangle vertices missed cache).
+    std::vector<size_t> clusters_starts {};
+    std::vector<size_t> timestamps(Vertices.size(), 0);
+    const size_t cache_size = 16;
+    size_t time = cache_size + 1;
+    for (size_t t = 0; t < triangles_count; t++)
+    {
+        u32 misses = 0;
+        for (u32 k = 0; k < 3; k++)
+        {
+            u32 index = Indices[t * 3 + k];
+            if (time - timestamps[index] > cache_size)
+                timestamps[index] = time++, misses++;
+        }
+        if (t == 0 || misses == 3) clusters_starts.push_back(t);
+    }
+    if (clusters_starts.size() < 2) return;
+    clusters_starts.push_back(triangles_count);
+
+    // Mesh centroid (area weighted).
+    vec3 mesh_centroid {};
+    float mesh_area = 0;
+    for (size_t t = 0; t < triangles_count; t++)
+    {
+        const vec3 &P0 = Vertices[Indices[t * 3 + 0]].Position;
+        const vec3 &P1 = Vertices[Indices[t * 3 + 1]].Position;
+        const vec3 &P2 = Vertices[Indices[t * 3 + 2]].Position;
+        float area = (P1 - P0).Cross(P2 - P0).Length();
+        mesh_centroid += (P0 + P1 + P2) * (area / 3);
+        mesh_area += area;
+    }
+    if (mesh_area > 0) mesh_centroid /= mesh_area;
+
+    // Clusters, which are facing outward from mesh centroid more, are more likely to occlude other ones.
+    const size_t clusters_count = clusters_starts.size() - 1;
+    std::vector<float> clusters_sort_keys(clusters_count);
+    for (size_t c = 0; c < clusters_count; c++)
+    {
+        vec3 centroid {}, normal {};
+        float area = 0;
+        for (size_t t = clusters_starts[c]; t < clusters_starts[c + 1]; t++)
+        {
+            const vec3 &P0 = Vertices[Indices[t * 3 + 0]].Position;
+            const vec3 &P1 = Vertices[Indices[t * 3 + 1]].Position;
+            const vec3 &P2 = Vertices[Indices[t * 3 + 2]].Position;
+            vec3 N = (P1 - P0).Cross(P2 - P0);
+            float triangle_area = N.Length();
+            centroid += (P0 + P1 + P2) * (triangle_area / 3);
+            normal += N;
+            area += triangle_area;
+        }
+        if (area > 0) centroid /= area;
+        clusters_sort_keys[c] = normal.Length2() > 0 ? (centroid - mesh_centroid).Dot(normal.Normalized()) : 0;
+    }
+
+    std::vector<size_t> clusters_order(clusters_count);
+    for (size_t c = 0; c < clusters_count; c++) clusters_order[c] = c;
+    std::stable_sort(clusters_order.begin(), clusters_order.end(),
+                     [&](size_t A, size_t B) { return clusters_sort_keys[A] > clusters_sort_keys[B]; });
+
+    std::vector<u32> ordered_indices {};
+    ordered_indices.reserve(Indices.size());
+    for (size_t c : clusters_order)
+        ordered_indices.insert(ordered_indices.end(),
+                               Indices.begin() + clusters_starts[c] * 3, Indices.begin() + clusters_starts[c + 1] * 3);
+
+    // Reordering is not applied, if it hurts vertex cache efficiency too much.
+    vertex_cache_stats ordered_stats = AnalyzeVertexCache(ordered_indices, Vertices.size());
+    if (ordered_stats.GetACMR() > source_stats.GetACMR() * Threshold) return;
+    std::copy(ordered_indices.begin(), ordered_indices.end(), Indices.begin());
+}
+
+void scl::topology::OptimizeVertexFetch(std::vector<vertex> &Vertices, std::vector<u32> &Indices)
+{
+    const u32 unused = ~0u;
+    std::vector<u32> remap(Vertices.size(), unused);
+    std::vector<vertex> ordered_vertices {};
+    ordered_vertices.reserve(Vertices.size());
+
+    for (auto &index : Indices)
+    {
+        if (remap[index] == unused)
+            remap[index] = (u32)ordered_vertices.size(),
+            ordered_vertices.push_back(Vertices[index]);
+        index = remap[index];
+    }
+    Vertices = std::move(ordered_vertices);
+}
+
+scl::topology::mesh_optimization_report scl::topology::OptimizeMesh(trimesh &Mesh)
+{
+    mesh_optimization_report report {};
+    report.Before = AnalyzeVertexCache(Mesh.Indices, Mesh.Vertices.size());
+    report.VerticesBefore = Mesh.Vertices.size();
+
+    DeduplicateVertices(Mesh.Vertices, Mesh.Indices);
+    OptimizeVertexCache(Mesh.Indices, Mesh.Vertices.size());
+    OptimizeOverdraw(Mesh.Indices, Mesh.Vertices);
+    OptimizeVertexFetch(Mesh.Vertices, Mesh.Indices);
+
+    report.After = AnalyzeVertexCache(Mesh.Indices, Mesh.Vertices.size());
+    report.VerticesAfter = Mesh.Vertices.size();
+    return report;
+}
@@ -0,0 +1,109 @@
+/*!****************************************************************//*!*
+ * \file   mesh_optimizer.h
+ * \brief  Topology object triangles mesh GPU rendering optimization functions definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   31 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "trimesh.h"
+
+namespace scl::topology
+{
+    /*! Post-transform vertex cache simulation statistics structure. */
+    struct vertex_cache_stats
+    {
+        size_t TrianglesCount {};  /*! Count of simulated triangles. */
+        size_t VerticesCount {};   /*! Count of unique vertices, referenced by triangles. */
+        size_t Misses {};          /*! Count of vertex cache misses (transformed vertices). */
+
+        /*! Average cache miss ratio (transformed vertices per triangle) getter function. */
+        float GetACMR() const { return TrianglesCount != 0 ? (float)Misses / TrianglesCount : 0; }
+        /*! Average transform to vertex ratio (transformed vertices per unique vertex) getter function. */
+        float GetATVR() const { return VerticesCount != 0 ? (float)Misses / VerticesCount : 0; }
+
+        /*! Statistics (of other mesh) accumulation operator. */
+        vertex_cache_stats &operator+=(const vertex_cache_stats &Other)
+        {
+            TrianglesCount += Other.TrianglesCount, VerticesCount += Other.VerticesCount, Misses += Other.Misses;
+            return *this;
+        }
+    };
+
+    /*! Mesh optimization result report structure. */
+    struct mesh_optimization_report
+    {
+        vertex_cache_stats Before {};  /*! Vertex cache statistics of source mesh. */
+        vertex_cache_stats After {};   /*! Vertex cache statistics of optimized mesh. */
+        size_t VerticesBefore {};      /*! Count of source mesh vertices. */
+        size_t VerticesAfter {};       /*! Count of optimized mesh vertices. */
+
+        /*! Report (of other mesh) accumulation operator. */
+        mesh_optimization_report &operator+=(const mesh_optimization_report &Other)
+        {
+            Before += Other.Before, After += Other.After;
+            VerticesBefore += Other.VerticesBefore, VerticesAfter += Other.VerticesAfter;
+            return *this;
+        }
+    };
+
+    /*!*
+     * Simulate FIFO post-transform vertex cache function.
+     *
+     * \param Indices - triangles vertices indices.
+     * \param VerticesCount - count of vertices.
+     * \param CacheSize - simulated cache size.
+     * \return vertex cache statistics.
+     */
+    vertex_cache_stats AnalyzeVertexCache(const std::vector<u32> &Indices, size_t VerticesCount, u32 CacheSize = 16);
+
+    /*!*
+     * Merge exactly equal vertices function.
+     *
+     * \param Vertices - mesh vertices.
+     * \param Indices - triangles vertices indices (remapped to merged vertices).
+     * \return None.
+     */
+    void DeduplicateVertices(std::vector<vertex> &Vertices, std::vector<u32> &Indices);
+
+    /*!*
+     * Reorder triangles for post-transform vertex cache efficiency (Tom Forsyth linear-speed algorithm) function.
+     *
+     * \param Indices - triangles vertices indices to reorder.
+     * \param VerticesCount - count of vertices.
+     * \return None.
+     */
+    void OptimizeVertexCache(std::vector<u32> &Indices, size_t VerticesCount);
+
+    /*!*
+     * Reorder triangles clusters (continuous runs of vertex cache optimized triangles) to reduce overdraw function.
+     * Outward facing clusters are drawn first, so they occlude others. Clusters bounds are chosen on vertex cache
+     * hard boundaries, so vertex cache efficiency stays almost the same.
+     *
+     * \param Indices - vertex cache optimized triangles vertices indices to reorder.
+     * \param Vertices - mesh vertices.
+     * \param Threshold - maximum allowed average cache miss ratio increase (order is kept if it is exceeded).
+     * \return None.
+     */
+    void OptimizeOverdraw(std::vector<u32> &Indices, const std::vector<vertex> &Vertices, float Threshold = 1.05f);
+
+    /*!*
+     * Reorder vertices in order of first use by triangles (and remove unused ones) for vertex fetch locality function.
+     *
+     * \param Vertices - mesh vertices to reorder.
+     * \param Indices - triangles vertices indices (remapped to reordered vertices).
+     * \return None.
+     */
+    void OptimizeVertexFetch(std::vector<vertex> &Vertices, std::vector<u32> &Indices);
+
+    /*!*
+     * Run all optimizations on triangles mesh function.
+     * Vertices are merged, triangles reordered for vertex cache and overdraw, vertices reordered for fetch locality.
+     *
+     * \param Mesh - triangles mesh to optimize.
+     * \return optimization report.
+     */
+    mesh_optimization_report OptimizeMesh(trimesh &Mesh);
+}
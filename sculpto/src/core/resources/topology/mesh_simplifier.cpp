@@ -0,0 +1,254 @@
+/*!****************************************************************//*!*
+ * \file   mesh_simplifier.cpp
+ * \brief  Topology object triangles mesh simplification (level of detail generation) functions implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   31 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "mesh_simplifier.h"
+#include "mesh_optimizer.h"
+#include "vertex_triangles.h"
+
+namespace scl::topology
+{
+    /*! Plane distance squared quadric (symmetric 4x4 matrix upper triangle) structure. */
+    struct quadric
+    {
+        double A2 {}, AB {}, AC {}, AD {}, B2 {}, BC {}, BD {}, C2 {}, CD {}, D2 {};
+        double Weight {};  /*! Sum of planes weights. */
+
+        /*! Default constructor (zero quadric). */
+        quadric() = default;
+
+        /*!*
+         * Plane quadric constructor.
+         *
+         * \param N - normalized plane normal.
+         * \param D - plane distance from origin.
+         * \param Weight - quadric weight.
+         */
+        quadric(const vec3 &N, double D, double Weight) :
+            A2(Weight * N.X * N.X), AB(Weight * N.X * N.Y), AC(Weight * N.X * N.Z), AD(Weight * N.X * D),
+            B2(Weight * N.Y * N.Y), BC(Weight * N.Y * N.Z), BD(Weight * N.Y * D),
+            C2(Weight * N.Z * N.Z), CD(Weight * N.Z * D), D2(Weight * D * D), Weight(Weight) {}
+
+        /*! Quadrics sum operator. */
+        quadric &operator+=(const quadric &Other)
+        {
+            A2 += Other.A2, AB += Other.AB, AC += Other.AC, AD += Other.AD;
+            B2 += Other.B2, BC += Other.BC, BD += Other.BD;
+            C2 += Other.C2, CD += Other.CD, D2 += Other.D2;
+            Weight += Other.Weight;
+            return *this;
+        }
+
+        /*!*
+         * Evaluate weighted average of squared distances to quadric planes function.
+         *
+         * \param P - point to evaluate distances from.
+         * \return squared distances average.
+         */
+        double Evaluate(const vec3 &P) const
+        {
+            double x = P.X, y = P.Y, z = P.Z;
+            double result = A2 * x * x + B2 * y * y + C2 * z * z + D2 +
+                            2 * (AB * x * y + AC * x * z + BC * y * z + AD * x + BD * y + CD * z);
+            return result > 0 && Weight > 0 ? result / Weight : 0;
+        }
+    };
+
+    /*! Edge collapse candidate structure. */
+    struct collapse
+    {
+        u32 From;     /*! Removed vertex. */
+        u32 To;       /*! Vertex, removed one is collapsed to. */
+        double Cost;  /*! Collapse quadric error. */
+    };
+
+    /*!*
+     * Evaluate collapse attribute (normals deviation) error function.
+     * Error is squared collapsed edge length, scaled by normals deviation (0 for same normals, 1 for orthogonal ones),
+     * so it is comparable with quadric (squared distance) error.
+     *
+     * \param From - removed vertex.
+     * \param To - vertex, removed one is collapsed to.
+     * \return collapse attribute error.
+     */
+    static double GetAttributeError(const vertex &From, const vertex &To)
+    {
+        // Meshes without normals are simplified by geometric error only.
+        if (From.Normal.Length2() == 0 || To.Normal.Length2() == 0) return 0;
+
+        float normals_deviation = math::Clamp(1 - From.Normal.Dot(To.Normal), 0.0f, 1.0f);
+        return (double)normals_deviation * (To.Position - From.Position).Length2();
+    }
+
+    /*!*
+     * Check if collapse flips any of removed vertex triangles function.
+     *
+     * \param Vertices - mesh vertices.
+     * \param Indices - mesh triangles vertices indices.
+     * \param Adjacency - vertices adjacent triangles lists.
+     * \param From - removed vertex.
+     * \param To - vertex, removed one is collapsed to.
+     * \return wheather any triangle is flipped (or becomes degenerate) or not.
+     */
+    static bool IsCollapseFlipping(const std::vector<vertex> &Vertices, const std::vector<u32> &Indices,
+                                   const vertex_triangles &Adjacency, u32 From, u32 To)
+    {
+        for (u32 i = Adjacency.Offsets[From]; i < Adjacency.Offsets[From + 1]; i++)
+        {
+            const u32 *triangle = &Indices[Adjacency.Triangles[i] * 3];
+            if (triangle[0] == To || triangle[1] == To || triangle[2] == To) continue;
+
+            vec3 P[3], Q[3];
+            for (u32 k = 0; k < 3; k++)
+                P[k] = Vertices[triangle[k]].Position,
+                Q[k] = Vertices[triangle[k] == From ? To : triangle[k]].Position;
+            vec3 old_normal = (P[1] - P[0]).Cross(P[2] - P[0]);
+            vec3 new_normal = (Q[1] - Q[0]).Cross(Q[2] - Q[0]);
+            if (old_normal.Dot(new_normal) <= 0) return true;
+        }
+        return false;
+    }
+}
+
+scl::topology::lod_level scl::topology::SimplifyMesh(const std::vector<vertex> &Vertices, const std::vector<u32> &Indices,
+                                                     size_t TargetIndicesCount, float MaxError)
+{
+    lod_level result {};
+    result.Indices.assign(Indices.begin(), Indices.begin() + Indices.size() / 3 * 3);
+    const size_t vertices_count = Vertices.size();
+    if (result.Indices.size() <= TargetIndicesCount) return result;
+
+    // Vertices on attribute seams (other vertices in same position) and mesh borders are not collapsed.
+    std::vector<bool> is_locked(vertices_count);
+    {
+        std::map<std::tuple<float, float, float>, u32> positions_vertices {};
+        for (u32 v = 0; v < vertices_count; v++)
+        {
+            const vec3 &P = Vertices[v].Position;
+            auto [it, is_inserted] = positions_vertices.emplace(std::make_tuple(P.X, P.Y, P.Z), v);
+            if (!is_inserted) is_locked[v] = is_locked[it->second] = true;
+        }
+
+        std::map<std::pair<u32, u32>, u32> edges_triangles_counts {};
+        for (size_t t = 0; t < result.Indices.size(); t += 3)
+            for (u32 k = 0; k < 3; k++)
+            {
+                u32 a = result.Indices[t + k], b = result.Indices[t + (k + 1) % 3];
+                edges_triangles_counts[{ math::Min(a, b), math::Max(a, b) }]++;
+            }
+        for (const auto &[edge, count] : edges_triangles_counts)
+            if (count == 1) is_locked[edge.first] = is_locked[edge.second] = true;
+    }
+
+    // Vertex quadric is sum of adjacent triangles planes quadrics, weighted by triangles areas.
+    std::vector<quadric> quadrics(vertices_count);
+    for (size_t t = 0; t < result.Indices.size(); t += 3)
+    {
+        const vec3 &P0 = Vertices[result.Indices[t + 0]].Position;
+        const vec3 &P1 = Vertices[result.Indices[t + 1]].Position;
+        const vec3 &P2 = Vertices[result.Indices[t + 2]].Position;
+        vec3 N = (P1 - P0).Cross(P2 - P0);
+        float area = N.Length();
+        if (area == 0) continue;
+
+        N /= area;
+        quadric Q(N, -N.Dot(P0), area);
+        for (u32 k = 0; k < 3; k++)
+            quadrics[result.Indices[t + k]] += Q;
+    }
+
+    // Collapses are done in passes: cheapest independent (not sharing vertices) edges are collapsed each pass.
+    const double max_cost = (double)MaxError * MaxError;
+    double result_cost = 0;
+    std::vector<collapse> collapses {};
+    std::vector<u32> remap(vertices_count);
+    std::vector<bool> is_touched(vertices_count);
+    while (result.Indices.size() > TargetIndicesCount)
+    {
+        vertex_triangles adjacency(result.Indices, vertices_count);
+
+        collapses.clear();
+        for (size_t t = 0; t < result.Indices.size(); t += 3)
+            for (u32 k = 0; k < 3; k++)
+            {
+                u32 a = result.Indices[t + k], b = result.Indices[t + (k + 1) % 3];
+                for (auto [from, to] : { std::make_pair(a, b), std::make_pair(b, a) })
+                    if (!is_locked[from])
+                    {
+                        quadric Q = quadrics[from];
+                        Q += quadrics[to];
+                        collapses.push_back({ from, to, Q.Evaluate(Vertices[to].Position) + GetAttributeError(Vertices[from], Vertices[to]) });
+                    }
+            }
+        std::sort(collapses.begin(), collapses.end(), [](const collapse &A, const collapse &B)
+        {
+            return A.Cost != B.Cost ? A.Cost < B.Cost : A.From != B.From ? A.From < B.From : A.To < B.To;
+        });
+
+        for (u32 v = 0; v < vertices_count; v++) remap[v] = v;
+        std::fill(is_touched.begin(), is_touched.end(), false);
+
+        // Each collapse removes about two triangles.
+        size_t triangles_to_remove = (result.Indices.size() - TargetIndicesCount) / 3;
+        size_t removed_triangles = 0, collapses_count = 0;
+        for (const collapse &c : collapses)
+        {
+            if (c.Cost > max_cost || removed_triangles >= triangles_to_remove) break;
+            if (is_touched[c.From] || is_touched[c.To]) continue;
+            if (IsCollapseFlipping(Vertices, result.Indices, adjacency, c.From, c.To)) continue;
+
+            remap[c.From] = c.To;
+            is_touched[c.From] = is_touched[c.To] = true;
+            quadrics[c.To] += quadrics[c.From];
+            result_cost = math::Max(result_cost, c.Cost);
+            removed_triangles += 2;
+            collapses_count++;
+        }
+        if (collapses_count == 0) break;
+
+        // Remap triangles vertices and remove degenerate triangles.
+        size_t write = 0;
+        for (size_t t = 0; t < result.Indices.size(); t += 3)
+        {
+            u32 a = remap[result.Indices[t + 0]], b = remap[result.Indices[t + 1]], c = remap[result.Indices[t + 2]];
+            if (a == b || b == c || c == a) continue;
+            result.Indices[write++] = a, result.Indices[write++] = b, result.Indices[write++] = c;
+        }
+        result.Indices.resize(write);
+    }
+
+    result.Error = (float)sqrt(result_cost);
+    return result;
+}
+
+std::vector<scl::topology::lod_level> scl::topology::GenerateLods(const trimesh &Mesh, u32 MaxLevelsCount, float Ratio, float MaxError)
+{
+    std::vector<lod_level> lods {};
+    if (Mesh.Vertices.empty()) return lods;
+    lods.reserve(MaxLevelsCount);
+
+    bound_box box {};
+    for (const auto &v : Mesh.Vertices) box.Extend(v.Position);
+    const float max_error = MaxError * box.GetSize().Length();
+
+    const std::vector<u32> *previous_indices = &Mesh.Indices;
+    for (u32 level = 0; level < MaxLevelsCount; level++)
+    {
+        size_t target_indices_count = (size_t)(previous_indices->size() / 3 * Ratio) * 3;
+        if (target_indices_count < 3) break;
+
+        // Each level is simplified from source mesh, so errors are not accumulated.
+        lod_level lod = SimplifyMesh(Mesh.Vertices, Mesh.Indices, target_indices_count, max_error);
+        if (lod.Indices.empty() || lod.Indices.size() > previous_indices->size() * (1 + Ratio) / 2) break;
+
+        OptimizeVertexCache(lod.Indices, Mesh.Vertices.size());
+        lods.push_back(std::move(lod));
+        previous_indices = &lods.back().Indices;
+    }
+    return lods;
+}
@@ -0,0 +1,51 @@
+/*!****************************************************************//*!*
+ * \file   mesh_simplifier.h
+ * \brief  Topology object triangles mesh simplification (level of detail generation) functions definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   31 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "trimesh.h"
+
+namespace scl::topology
+{
+    /*! Mesh level of detail (simplified triangles over same vertices) structure. */
+    struct lod_level
+    {
+        std::vector<u32> Indices {};  /*! Simplified mesh triangles vertices indices. */
+        float Error {};               /*! Maximum geometric deviation from source mesh (in mesh space units). */
+    };
+
+    /*!*
+     * Simplify triangles mesh using quadric error metric edge collapses function.
+     * Vertices are collapsed to their neighbours (no new vertices are created), so simplified triangles
+     * could be drawn with source vertices. Mesh borders and attribute seams (split vertices in same position,
+     * e.g. texture coordinates or hard normals seams) are locked. Normals deviation of collapsed vertices is added to
+     * collapse error, so smooth shading is not distorted by collapses over curved normals.
+     * Simplification is deterministic: same mesh always produces same result.
+     *
+     * \param Vertices - mesh vertices.
+     * \param Indices - mesh triangles vertices indices.
+     * \param TargetIndicesCount - count of indices to reduce mesh to.
+     * \param MaxError - maximum allowed geometric deviation (in mesh space units).
+     * \return simplified mesh level of detail.
+     */
+    lod_level SimplifyMesh(const std::vector<vertex> &Vertices, const std::vector<u32> &Indices,
+                           size_t TargetIndicesCount, float MaxError);
+
+    /*!*
+     * Generate mesh levels of detail chain function.
+     * Each next level has (at most) specified ratio of previous level triangles. Generation stops
+     * if level could not be reduced enough without exceeding maximum error.
+     *
+     * \param Mesh - triangles mesh to generate levels of detail of.
+     * \param MaxLevelsCount - maximum count of generated levels (source mesh is not counted).
+     * \param Ratio - next to previous level triangles count ratio.
+     * \param MaxError - maximum allowed geometric deviation, relative to mesh bound box diagonal.
+     * \return generated levels of detail (from most to least detailed).
+     */
+    std::vector<lod_level> GenerateLods(const trimesh &Mesh, u32 MaxLevelsCount = 4, float Ratio = 0.5f, float MaxError = 0.05f);
+}
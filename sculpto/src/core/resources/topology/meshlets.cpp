@@ -0,0 +1,107 @@
+/*!****************************************************************//*!*
+ * \file   meshlets.cpp
+ * \brief  Topology object triangles mesh clusters (meshlets) building and culling functions implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "meshlets.h"
+
+namespace scl::topology
+{
+    /*!*
+     * Evaluate meshlet bound sphere and normals cone function.
+     *
+     * \param Vertices - mesh vertices.
+     * \param Indices - mesh triangles vertices indices.
+     * \param Meshlet - meshlet to evaluate bounds of.
+     * \return None.
+     */
+    static void EvaluateMeshletBounds(const std::vector<vertex> &Vertices, const std::vector<u32> &Indices, meshlet &Meshlet)
+    {
+        bound_box box {};
+        vec3 axis {};
+        for (u32 i = Meshlet.FirstIndex; i < Meshlet.FirstIndex + Meshlet.IndicesCount; i += 3)
+        {
+            const vec3 &P0 = Vertices[Indices[i + 0]].Position;
+            const vec3 &P1 = Vertices[Indices[i + 1]].Position;
+            const vec3 &P2 = Vertices[Indices[i + 2]].Position;
+            box.Extend(P0), box.Extend(P1), box.Extend(P2);
+            axis += (P1 - P0).Cross(P2 - P0);
+        }
+
+        Meshlet.Center = box.GetCenter();
+        Meshlet.Radius = 0;
+        for (u32 i = Meshlet.FirstIndex; i < Meshlet.FirstIndex + Meshlet.IndicesCount; i++)
+            Meshlet.Radius = math::Max(Meshlet.Radius, (Vertices[Indices[i]].Position - Meshlet.Center).Length());
+
+        // Cone, containing all triangles normals. Meshlets with wide cones (more than hemisphere) are never back face culled.
+        Meshlet.ConeCutoff = 1;
+        if (axis.Length2() == 0) return;
+        Meshlet.ConeAxis = axis.Normalized();
+
+        float min_dot = 1;
+        for (u32 i = Meshlet.FirstIndex; i < Meshlet.FirstIndex + Meshlet.IndicesCount; i += 3)
+        {
+            const vec3 &P0 = Vertices[Indices[i + 0]].Position;
+            vec3 N = (Vertices[Indices[i + 1]].Position - P0).Cross(Vertices[Indices[i + 2]].Position - P0);
+            if (N.Length2() == 0) continue;
+            min_dot = math::Min(min_dot, Meshlet.ConeAxis.Dot(N.Normalized()));
+        }
+        if (min_dot > 0) Meshlet.ConeCutoff = sqrt(1 - min_dot * min_dot);
+    }
+}
+
+std::vector<scl::topology::meshlet> scl::topology::BuildMeshlets(const std::vector<vertex> &Vertices, const std::vector<u32> &Indices,
+                                                                 u32 MaxVertices, u32 MaxTriangles)
+{
+    std::vector<meshlet> meshlets {};
+    const u32 indices_count = (u32)(Indices.size() / 3 * 3);
+    if (indices_count == 0) return meshlets;
+
+    // Vertex is in current meshlet, if it was marked with current meshlet index.
+    std::vector<u32> vertices_meshlets(Vertices.size(), ~0u);
+    meshlet current {};
+    u32 current_vertices_count = 0;
+    auto finish_meshlet = [&]()
+    {
+        EvaluateMeshletBounds(Vertices, Indices, current);
+        meshlets.push_back(current);
+        current = meshlet {};
+        current_vertices_count = 0;
+    };
+
+    for (u32 i = 0; i < indices_count; i += 3)
+    {
+        const u32 a = Indices[i + 0], b = Indices[i + 1], c = Indices[i + 2];
+        const u32 meshlet_index = (u32)meshlets.size();
+        u32 new_vertices_count = (vertices_meshlets[a] != meshlet_index) +
+                                 (vertices_meshlets[b] != meshlet_index && b != a) +
+                                 (vertices_meshlets[c] != meshlet_index && c != a && c != b);
+
+        if (current_vertices_count + new_vertices_count > MaxVertices || current.IndicesCount / 3 + 1 > MaxTriangles)
+        {
+            finish_meshlet();
+            new_vertices_count = 1 + (b != a) + (c != a && c != b);
+        }
+
+        if (current.IndicesCount == 0) current.FirstIndex = i;
+        vertices_meshlets[a] = vertices_meshlets[b] = vertices_meshlets[c] = (u32)meshlets.size();
+        current_vertices_count += new_vertices_count;
+        current.IndicesCount += 3;
+    }
+    finish_meshlet();
+    return meshlets;
+}
+
+bool scl::topology::IsMeshletVisible(const meshlet &Meshlet, const frustum &Frustum, const vec3 &CameraPosition, bool IsBackfaceCulling)
+{
+    if (!Frustum.Intersects(Meshlet.Center, Meshlet.Radius)) return false;
+    if (!IsBackfaceCulling || Meshlet.ConeCutoff >= 1) return true;
+
+    // Meshlet is back facing, if camera is inside of cone, opposite to normals cone, shifted to cover bound sphere.
+    vec3 view = Meshlet.Center - CameraPosition;
+    return view.Dot(Meshlet.ConeAxis) < Meshlet.ConeCutoff * view.Length() + Meshlet.Radius;
+}
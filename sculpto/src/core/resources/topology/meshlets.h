@@ -0,0 +1,56 @@
+/*!****************************************************************//*!*
+ * \file   meshlets.h
+ * \brief  Topology object triangles mesh clusters (meshlets) building and culling functions definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "trimesh.h"
+
+namespace scl::topology
+{
+    /*! Meshlets building limits. */
+    static constexpr u32 MESHLET_MAX_VERTICES = 64;
+    static constexpr u32 MESHLET_MAX_TRIANGLES = 124;
+
+    /*!*
+     * Triangles mesh cluster (meshlet) structure.
+     * Meshlet is continuous range of mesh indices, so visible meshlets could be drawn from mesh index buffer directly.
+     */
+    struct meshlet
+    {
+        u32 FirstIndex {};     /*! Meshlet first index in mesh indices. */
+        u32 IndicesCount {};   /*! Meshlet indices count. */
+        vec3 Center {};        /*! Meshlet bound sphere center. */
+        float Radius {};       /*! Meshlet bound sphere radius. */
+        vec3 ConeAxis {};      /*! Meshlet triangles normals cone axis. */
+        float ConeCutoff { 1 };  /*! Meshlet triangles normals cone cutoff (sine of cone half angle, 1 if meshlet could not be back face culled). */
+    };
+
+    /*!*
+     * Split triangles mesh to meshlets function.
+     * Triangles are taken in indices order (which is expected to be vertex cache optimized), so mesh indices are not changed.
+     *
+     * \param Vertices - mesh vertices.
+     * \param Indices - mesh triangles vertices indices.
+     * \param MaxVertices - maximum count of unique vertices in meshlet.
+     * \param MaxTriangles - maximum count of triangles in meshlet.
+     * \return built meshlets.
+     */
+    std::vector<meshlet> BuildMeshlets(const std::vector<vertex> &Vertices, const std::vector<u32> &Indices,
+                                       u32 MaxVertices = MESHLET_MAX_VERTICES, u32 MaxTriangles = MESHLET_MAX_TRIANGLES);
+
+    /*!*
+     * Check if meshlet could be visible function.
+     *
+     * \param Meshlet - meshlet to check.
+     * \param Frustum - camera frustum in mesh space.
+     * \param CameraPosition - camera position in mesh space.
+     * \param IsBackfaceCulling - wheather meshlets, facing away from camera, should be culled.
+     * \return wheather meshlet is visible or not.
+     */
+    bool IsMeshletVisible(const meshlet &Meshlet, const frustum &Frustum, const vec3 &CameraPosition, bool IsBackfaceCulling);
+}
@@ -18,7 +18,7 @@ scl::topology::points::points() : basis(mesh_type::POINTS)
 scl::topology::points::points(const std::vector<vertex_point> &Points) : basis(mesh_type::POINTS)
 {
     Vertices = Points;
-    Indices.resize(Points.size());
+    Indices.reserve(Points.size());
     for (int i = 0; i < Points.size(); i++)
         Indices.push_back(i);
 }
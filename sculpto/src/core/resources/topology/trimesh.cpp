@@ -8,14 +8,22 @@
 
 #include "sclpch.h"
 #include "trimesh.h"
+#include "vertex_triangles.h"
+#include "utilities/thread_pool/thread_pool.h"
+
+namespace scl::topology
+{
+    /*! Count of triangles (or vertices) processed by single thread at once. */
+    static constexpr size_t PARALLEL_CHUNK_SIZE = 16 * 1024;
+}
 
 scl::topology::trimesh::trimesh(const std::vector<vertex> &Vertices, const std::vector<u32> &Indieces) :
-    basis(mesh_type::TRIANGLES, Vertices, Indices)
+    basis(mesh_type::TRIANGLES, Vertices, Indieces)
 {
 }
 
-scl::topology::trimesh::trimesh(const std::vector<vertex> &&Vertices, const std::vector<u32> &&Indieces) :
-    basis(mesh_type::TRIANGLES, Vertices, Indices)
+scl::topology::trimesh::trimesh(std::vector<vertex> &&Vertices, std::vector<u32> &&Indieces) :
+    basis(mesh_type::TRIANGLES, std::move(Vertices), std::move(Indieces))
 {
 }
 
@@ -32,64 +40,109 @@ void scl::topology::trimesh::EvaluateBoundBox()
 
 void scl::topology::trimesh::EvaluateNormals()
 {
-    for (INT i = 0; i < Indices.size(); i += 3)
+    const size_t triangles_count = Indices.size() / 3;
+    if (triangles_count == 0) return;
+
+    // Triangle cross product length is its doubled area, so sum of them is area weighted.
+    std::vector<vec3> triangles_normals(triangles_count);
+    thread_pool::Get().ParallelFor(triangles_count, PARALLEL_CHUNK_SIZE, [&](size_t Begin, size_t End)
     {
-        vec3 A = Vertices[Indices[i + 1]].Position - Vertices[Indices[i]].Position;
-        vec3 B = Vertices[Indices[i + 2]].Position - Vertices[Indices[i]].Position;
-        vec3 N = A.Cross(B).Normalized();
-
-        Vertices[Indices[i + 0]].Normal = vec3(Vertices[Indices[i + 0]].Normal + N).Normalized();
-        Vertices[Indices[i + 1]].Normal = vec3(Vertices[Indices[i + 1]].Normal + N).Normalized();
-        Vertices[Indices[i + 2]].Normal = vec3(Vertices[Indices[i + 2]].Normal + N).Normalized();
-    }
+        for (size_t t = Begin; t < End; t++)
+        {
+            const vec3 &P0 = Vertices[Indices[t * 3 + 0]].Position;
+            vec3 A = Vertices[Indices[t * 3 + 1]].Position - P0;
+            vec3 B = Vertices[Indices[t * 3 + 2]].Position - P0;
+            triangles_normals[t] = A.Cross(B);
+        }
+    });
+
+    // Each vertex gathers its triangles values, so no synchronization between threads is needed.
+    vertex_triangles adjacency(Indices, Vertices.size());
+    thread_pool::Get().ParallelFor(Vertices.size(), PARALLEL_CHUNK_SIZE, [&](size_t Begin, size_t End)
+    {
+        for (size_t v = Begin; v < End; v++)
+        {
+            vec3 N {};
+            for (u32 i = adjacency.Offsets[v]; i < adjacency.Offsets[v + 1]; i++)
+                N += triangles_normals[adjacency.Triangles[i]];
+            if (N.Length2() > 0) Vertices[v].Normal = N.Normalized();
+        }
+    });
 }
 
 void scl::topology::trimesh::EvaluateTangentSpace()
 {
-    bool is_ok = true;
-    for (INT i = 0; i < Indices.size() && is_ok; i += 3)
-        is_ok = EvaluateTriangleTangentSpace(Vertices[Indices[i + 0]],
-                                             Vertices[Indices[i + 1]],
-                                             Vertices[Indices[i + 2]]);
-    if (is_ok)
-        for (auto &V : Vertices) EvaluateVertexOrthoganalTBNBasis(V);
-    else
-        for (auto &V : Vertices)
+    const size_t triangles_count = Indices.size() / 3;
+
+    // Triangles tangent spaces, weighted by triangles areas (zero for degenerate texture coordinates).
+    std::vector<vec3> triangles_tangents(triangles_count), triangles_bitangents(triangles_count);
+    thread_pool::Get().ParallelFor(triangles_count, PARALLEL_CHUNK_SIZE, [&](size_t Begin, size_t End)
+    {
+        for (size_t t = Begin; t < End; t++)
         {
-            vec3 N = V.Normal;
-
-            if (N.Z > N.X && N.Z > N.Y || N.Y > N.X && N.Y > N.Z)
-                /*! Z or Y dominant axes */
-                V.Tangent = vec3(1, 0, 0);
-            else
-                /*! X dominant axis */
-                V.Tangent = vec3(0, 1, 0);
-            V.Bitangent = N.Cross(V.Tangent).Normalized();
-            V.Tangent = V.Bitangent.Cross(N).Normalized();
+            const vertex &P0 = Vertices[Indices[t * 3 + 0]];
+            const vertex &P1 = Vertices[Indices[t * 3 + 1]];
+            const vertex &P2 = Vertices[Indices[t * 3 + 2]];
+
+            vec3 T, B;
+            if (!EvaluateTriangleTangentSpace(P0, P1, P2, T, B)) continue;
+            float area = (P1.Position - P0.Position).Cross(P2.Position - P0.Position).Length();
+            triangles_tangents[t] = T * area;
+            triangles_bitangents[t] = B * area;
         }
+    });
+
+    vertex_triangles adjacency(Indices, Vertices.size());
+    thread_pool::Get().ParallelFor(Vertices.size(), PARALLEL_CHUNK_SIZE, [&](size_t Begin, size_t End)
+    {
+        for (size_t v = Begin; v < End; v++)
+        {
+            vertex &V = Vertices[v];
+            V.Tangent = V.Bitangent = vec3 {};
+            for (u32 i = adjacency.Offsets[v]; i < adjacency.Offsets[v + 1]; i++)
+                V.Tangent += triangles_tangents[adjacency.Triangles[i]],
+                V.Bitangent += triangles_bitangents[adjacency.Triangles[i]];
+
+            if (V.Tangent.Length2() > 0 && V.Bitangent.Length2() > 0) EvaluateVertexOrthoganalTBNBasis(V);
+            else                                                      EvaluateVertexDefaultTangentSpace(V);
+        }
+    });
 }
 
-bool scl::topology::trimesh::EvaluateTriangleTangentSpace(vertex &P0, vertex &P1, vertex &P2)
+bool scl::topology::trimesh::EvaluateTriangleTangentSpace(const vertex &P0, const vertex &P1, const vertex &P2,
+                                                          vec3 &OutTangent, vec3 &OutBitangent)
 {
     float s1 = P1.TexCoords.X - P0.TexCoords.X;
     float s2 = P2.TexCoords.X - P0.TexCoords.X;
     float t1 = P1.TexCoords.Y - P0.TexCoords.Y;
     float t2 = P2.TexCoords.Y - P0.TexCoords.Y;
     float det = s1 * t2 - s2 * t1;
+    if (det == 0) return false;
 
-    if (det != 0)
-    {
-        vec3 E1 = P1.Position - P0.Position;
-        vec3 E2 = P2.Position - P0.Position;
-        vec3 T = ((E1 * t2 - E2 * t1) / det).Normalized();
-        vec3 B = ((E2 * s1 - E1 * s2) / det).Normalized();
-
-        P0.Tangent += T; P0.Bitangent += B;
-        P1.Tangent += T; P1.Bitangent += B;
-        P2.Tangent += T; P2.Bitangent += B;
-        return true;
-    }
-    return false;
+    vec3 E1 = P1.Position - P0.Position;
+    vec3 E2 = P2.Position - P0.Position;
+    vec3 T = (E1 * t2 - E2 * t1) / det;
+    vec3 B = (E2 * s1 - E1 * s2) / det;
+    if (T.Length2() == 0 || B.Length2() == 0) return false;
+
+    OutTangent = T.Normalized();
+    OutBitangent = B.Normalized();
+    return true;
+}
+
+void scl::topology::trimesh::EvaluateVertexDefaultTangentSpace(vertex &P)
+{
+    vec3 N = P.Normal;
+    float x = std::abs(N.X), y = std::abs(N.Y), z = std::abs(N.Z);
+
+    if (z > x && z > y || y > x && y > z)
+        /*! Z or Y dominant axes */
+        P.Tangent = vec3(1, 0, 0);
+    else
+        /*! X dominant axis */
+        P.Tangent = vec3(0, 1, 0);
+    P.Bitangent = N.Cross(P.Tangent).Normalized();
+    P.Tangent = P.Bitangent.Cross(N).Normalized();
 }
 
 void scl::topology::trimesh::EvaluateVertexOrthoganalTBNBasis(vertex &P)
@@ -29,12 +29,18 @@ namespace scl::topology
         trimesh(const std::vector<vertex> &Vertices, const std::vector<u32> &Indieces);
 
         /*!*
-         * Topology object triangles mesh default cconstructor.
+         * Topology object triangles mesh constructor, taking ownership of vertices and indices.
          *
          * \param Vertices - triangle mesh vertices.
          * \param Indieces - triangle mesh vertices indices.
          */
-        trimesh(const std::vector<vertex> &&Vertices, const std::vector<u32> &&Indieces);
+        trimesh(std::vector<vertex> &&Vertices, std::vector<u32> &&Indieces);
+
+        /*! Topology object triangles mesh default copy and move constructors and assignment operators. */
+        trimesh(const trimesh &Other) = default;
+        trimesh(trimesh &&Other) noexcept = default;
+        trimesh &operator=(const trimesh &Other) = default;
+        trimesh &operator=(trimesh &&Other) noexcept = default;
 
         /*! Topology object triangles mesh default destructor. */
         ~trimesh() override = default;
@@ -49,6 +55,8 @@ namespace scl::topology
 
         /*!*
          * Topology object mesh vertices normals evaluation function.
+         * Vertex normal is sum of adjacent triangles normals, weighted by triangles areas,
+         * normalized once. Large meshes are processed in parallel.
          *
          * \param None.
          * \return None.
@@ -57,7 +65,10 @@ namespace scl::topology
 
         /*!*
          * Topology object mesh vertices tangent space evaluation function.
-         * 
+         * Vertex tangent and bitangent are sums of adjacent triangles ones, weighted by triangles areas.
+         * Triangles with degenerate texture coordinates are skipped, vertices without any valid triangle
+         * get tangent space, built from normal only. Large meshes are processed in parallel.
+         *
          * \param None.
          * \return None.
          */
@@ -67,9 +78,20 @@ namespace scl::topology
          * Evaluate tangent space of single triangle function.
          *
          * \param P0, P1, P2 - triangle vertices.
+         * \param OutTangent - triangle normalized tangent.
+         * \param OutBitangent - triangle normalized bitangent.
+         * \return wheather triangle texture coordinates are not degenerate (and tangent space is evaluated) or not.
+         */
+        static bool EvaluateTriangleTangentSpace(const vertex &P0, const vertex &P1, const vertex &P2,
+                                                 vec3 &OutTangent, vec3 &OutBitangent);
+
+        /*!*
+         * Evaluate vertex tangent space from its normal only (for vertices without texture coordinates) function.
+         *
+         * \param P - vertex to evaluate tangent space of.
          * \return None.
          */
-        static bool EvaluateTriangleTangentSpace(vertex &P0, vertex &P1, vertex &P2);
+        static void EvaluateVertexDefaultTangentSpace(vertex &P);
 
         /*!*
          * Evaluate orthoganal tangent space basis of vertex function.
@@ -0,0 +1,43 @@
+/*!****************************************************************//*!*
+ * \file   vertex_triangles.h
+ * \brief  Topology object vertices adjacent triangles lists structure implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   31 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl::topology
+{
+    /*! Vertices adjacent triangles lists (packed to single array) structure. */
+    struct vertex_triangles
+    {
+        std::vector<u32> Offsets {};    /*! Vertex triangles list begining in triangles array (vertices count + 1 elements). */
+        std::vector<u32> Triangles {};  /*! Triangles indices, grouped by vertices. */
+
+        /*! Vertex adjacent triangles count getter function. */
+        u32 GetCount(u32 Vertex) const { return Offsets[Vertex + 1] - Offsets[Vertex]; }
+
+        /*!*
+         * Vertices adjacent triangles lists constructor.
+         *
+         * \param Indices - triangles vertices indices.
+         * \param VerticesCount - count of vertices.
+         */
+        vertex_triangles(const std::vector<u32> &Indices, size_t VerticesCount) :
+            Offsets(VerticesCount + 1), Triangles(Indices.size() / 3 * 3)
+        {
+            for (size_t i = 0; i < Triangles.size(); i++)
+                Offsets[Indices[i] + 1]++;
+            for (size_t v = 0; v < VerticesCount; v++)
+                Offsets[v + 1] += Offsets[v];
+
+            std::vector<u32> next(Offsets.begin(), Offsets.end() - 1);
+            for (size_t i = 0; i < Triangles.size(); i++)
+                Triangles[next[Indices[i]]++] = (u32)(i / 3);
+        }
+    };
+}
@@ -0,0 +1,22 @@
+/*!****************************************************************//*!*
+ * \file   prefab.cpp
+ * \brief  Scene object template (prefab) class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   29 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "prefab.h"
+
+void scl::prefab::InsertComponents(entt::registry &Registry, const std::vector<entt::entity> &Entities) const
+{
+    for (const auto &component : Components)
+        component->Insert(Registry, Entities);
+}
+
+scl::shared<scl::prefab> scl::prefab::Create(const std::string &Name)
+{
+    return CreateShared<prefab>(Name);
+}
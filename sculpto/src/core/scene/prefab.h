@@ -0,0 +1,121 @@
+/*!****************************************************************//*!*
+ * \file   prefab.h
+ * \brief  Scene object template (prefab) class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   29 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include <entt.hpp>
+
+#include "base.h"
+#include "core/components/name_component.h"
+#include "core/components/transform_component.h"
+
+namespace scl
+{
+    /*!*
+     * Scene object template (prefab) class.
+     * Stores components, copied to each instantiated scene object. Heavy resources (meshes, materials)
+     * are held by shared pointers, so all instances reference the same data.
+     * Name and transform are per instance components and are set on instantiation.
+     * Instances are named after prefab with 1-based instance number ("<prefab name> 1", "<prefab name> 2", ...),
+     * numbered separately in each scene.
+     */
+    class prefab
+    {
+        friend class scene;
+
+    private: /*! Prefab data. */
+        /*! Prefab component interface. */
+        struct component_template
+        {
+            virtual ~component_template() = default;
+
+            /*!*
+             * Assign component copy to each entity in range function.
+             *
+             * \param Registry - registry to insert components to.
+             * \param Entities - entities to assign components to.
+             * \return None.
+             */
+            virtual void Insert(entt::registry &Registry, const std::vector<entt::entity> &Entities) const = 0;
+        };
+
+        /*! Prefab single component type class. */
+        template <typename T>
+        struct typed_component_template : public component_template
+        {
+            T Value; /*! Component value, copied to instances. */
+
+            template <typename... Targs>
+            typed_component_template(Targs&&... Args) : Value(std::forward<Targs>(Args)...) {}
+
+            void Insert(entt::registry &Registry, const std::vector<entt::entity> &Entities) const override
+            {
+                Registry.insert<T>(Entities.begin(), Entities.end(), Value);
+            }
+        };
+
+        std::string Name {};                                       /*! Prefab name (instances are named after it). */
+        std::optional<transform_component> Transform {};           /*! Default instances transform. */
+        std::vector<unique<component_template>> Components {};     /*! Shared instances components. */
+
+    public: /*! Prefab getter/setter functions. */
+        /*! Prefab name getter function. */
+        const std::string &GetName() const { return Name; }
+        /*! Prefab default transform getter function. */
+        const std::optional<transform_component> &GetTransform() const { return Transform; }
+
+    private: /*! Prefab methods. */
+        /*!*
+         * Assign prefab components to each entity in range function.
+         *
+         * \param Registry - registry to insert components to.
+         * \param Entities - entities to assign components to.
+         * \return None.
+         */
+        void InsertComponents(entt::registry &Registry, const std::vector<entt::entity> &Entities) const;
+
+    public:
+        /*!*
+         * Prefab constructor.
+         *
+         * \param Name - prefab name.
+         */
+        prefab(const std::string &Name) : Name(Name) {}
+
+        /*! Prefab default destructor. */
+        ~prefab() = default;
+
+        /*!*
+         * Add component to prefab function.
+         * Transform component becomes default transform of instances, which could be overriden on instantiation.
+         *
+         * \tparam component to add to prefab.
+         * \param Args - component constructor arguments.
+         * \return this prefab.
+         */
+        template <typename T, typename... Targs>
+        prefab &AddComponent(Targs&&... Args)
+        {
+            static_assert(!std::is_same_v<T, name_component>, "Prefab instances names are generated from prefab name.");
+
+            if constexpr (std::is_same_v<T, transform_component>)
+                Transform.emplace(std::forward<Targs>(Args)...);
+            else
+                Components.push_back(CreateUnique<typed_component_template<T>>(std::forward<Targs>(Args)...));
+            return *this;
+        }
+
+        /*!*
+         * Prefab creation function.
+         *
+         * \param Name - prefab name.
+         * \return created prefab pointer.
+         */
+        static shared<prefab> Create(const std::string &Name);
+    };
+}
@@ -36,10 +36,74 @@ scl::scene::scene()
             ViewportHeight = Event.GetHeight();
         return false;
     });
+
+    Registry.on_destroy<mesh_component>().connect<&scene::OnSpatialObjectDestroy>(*this);
+    Registry.on_destroy<transform_component>().connect<&scene::OnSpatialObjectDestroy>(*this);
+    Registry.on_construct<name_component>().connect<&scene_name_index::OnNameConstruct>(NameIndex);
+    Registry.on_update<name_component>().connect<&scene_name_index::OnNameUpdate>(NameIndex);
+    Registry.on_destroy<name_component>().connect<&scene_name_index::OnNameDestroy>(NameIndex);
 }
 
 scl::scene::~scene()
 {
+    Registry.on_destroy<mesh_component>().disconnect<&scene::OnSpatialObjectDestroy>(*this);
+    Registry.on_destroy<transform_component>().disconnect<&scene::OnSpatialObjectDestroy>(*this);
+    Registry.on_construct<name_component>().disconnect<&scene_name_index::OnNameConstruct>(NameIndex);
+    Registry.on_update<name_component>().disconnect<&scene_name_index::OnNameUpdate>(NameIndex);
+    Registry.on_destroy<name_component>().disconnect<&scene_name_index::OnNameDestroy>(NameIndex);
+}
+
+void scl::scene::OnSpatialObjectDestroy(entt::registry &Registry, entt::entity Entity)
+{
+    auto proxy_it = SpatialProxies.find(Entity);
+    if (proxy_it == SpatialProxies.end()) return;
+
+    SpatialIndex.Remove(proxy_it->second.Proxy);
+    SpatialProxies.erase(proxy_it);
+}
+
+scl::shared<scl::scene_snapshot> scl::scene::Snapshot() const
+{
+    return scene_snapshot::Create(*this);
+}
+
+void scl::scene::Restore(const scene_snapshot &Snapshot)
+{
+    // Destruction signals remove objects from name and spatial indices, construction ones fill name index back.
+    Registry.clear();
+    Registry.assign(Snapshot.Entities.begin(), Snapshot.Entities.end(), Snapshot.ReleasedEntities);
+    for (const auto &pool : Snapshot.Pools)
+        pool->Restore(Registry);
+    EnviromentAmbient = Snapshot.EnviromentAmbient;
+}
+
+void scl::scene::UpdateSpatialIndex()
+{
+    for (auto &&[entity, mesh, transform] : Registry.group<mesh_component>(entt::get<transform_component>).each())
+    {
+        // Meshes without geometry yet (e.g. loading asynchronously) have empty box, which would never pass culling, so they are deferred.
+        auto proxy_it = SpatialProxies.find(entity);
+        if (mesh.Mesh == nullptr || mesh.Mesh->BoundBox.IsEmpty())
+        {
+            if (proxy_it != SpatialProxies.end()) OnSpatialObjectDestroy(Registry, entity);
+            continue;
+        }
+
+        const bound_box &mesh_bound_box = mesh.Mesh->BoundBox;
+        if (proxy_it == SpatialProxies.end())
+        {
+            int proxy = SpatialIndex.Insert(entity, mesh_bound_box.Transformed(transform));
+            SpatialProxies.emplace(entity, spatial_proxy { proxy, transform.Version, mesh.Mesh.get(), mesh_bound_box });
+        }
+        else if (proxy_it->second.TransformVersion != transform.Version || proxy_it->second.Mesh != mesh.Mesh.get() ||
+                 !(proxy_it->second.MeshBoundBox.Min == mesh_bound_box.Min && proxy_it->second.MeshBoundBox.Max == mesh_bound_box.Max))
+        {
+            SpatialIndex.Move(proxy_it->second.Proxy, mesh_bound_box.Transformed(transform));
+            proxy_it->second.TransformVersion = transform.Version;
+            proxy_it->second.Mesh = mesh.Mesh.get();
+            proxy_it->second.MeshBoundBox = mesh_bound_box;
+        }
+    }
 }
 
 void scl::scene::CallUpdate()
@@ -78,6 +142,11 @@ void scl::scene::Render()
     if (primary_camera->GetViewportWidth() != ViewportWidth || primary_camera->GetViewportHeight() != ViewportHeight)
         primary_camera->Resize(ViewportWidth, ViewportHeight);
 
+    UpdateSpatialIndex();
+    frustum camera_frustum(primary_camera->GetViewProjection());
+    frustum shadow_frustum {};
+    bool is_shadow_frustum = false;
+
     renderer::StartPipeline(*primary_camera, EnviromentAmbient);
     {
         for (auto &&[entity, point_light, transform] : Registry.group<point_light_component>(entt::get<transform_component>).each())
@@ -87,8 +156,13 @@ void scl::scene::Render()
         {
             vec3 direction = transform.AnglesMatr.TransformVector(vec3 { 0, -1, 0 });
             vec3 at = transform.Position + direction;
+            matr4 view_projection = matr4::View(transform.Position, at, { 0, 1, 0 }) * directional_light.GetProjection();
             renderer::SubmitDirectionalLight(direction, directional_light.Color * directional_light.Strength, directional_light.GetIsShadow(),
-                                             matr4::View(transform.Position, at, { 0, 1, 0 }) * directional_light.GetProjection(), directional_light.GetShadowMap());
+                                             view_projection, directional_light.GetShadowMap());
+
+            // Only first directional light is used by renderer.
+            if (!is_shadow_frustum && directional_light.GetIsShadow())
+                shadow_frustum = frustum(view_projection), is_shadow_frustum = true;
         }
 
         for (auto &&[entity, spot_light, transform] : Registry.group<spot_light_component>(entt::get<transform_component>).each())
@@ -101,8 +175,19 @@ void scl::scene::Render()
         for (auto &&[entity, skybox_mesh] : Registry.view<skybox_component>().each())
             if (skybox_mesh.SkyboxMesh != nullptr) renderer::Submit(skybox_mesh.SkyboxMesh, transform_component());
 
-        for (auto &&[entity, mesh, transform] : Registry.group<mesh_component>(entt::get<transform_component>).each())
-            if (mesh.Mesh != nullptr) renderer::Submit(mesh, transform);
+        // Submit only meshes, visible by camera, and meshes outside of camera frustum, but casting shadows into it
+        SpatialIndex.QueryFrustum(camera_frustum, [&](scene_object_handle Entity)
+        {
+            auto [mesh, transform] = Registry.get<mesh_component, transform_component>(Entity);
+            renderer::Submit(mesh, transform);
+        });
+        if (is_shadow_frustum)
+            SpatialIndex.QueryFrustum(shadow_frustum, [&](scene_object_handle Entity)
+            {
+                auto [mesh, transform] = Registry.get<mesh_component, transform_component>(Entity);
+                if (!camera_frustum.Intersects(mesh.Mesh->BoundBox.Transformed(transform)))
+                    renderer::SubmitShadowCaster(mesh, transform);
+            });
     }
     renderer::EndPipeline();
 }
@@ -116,11 +201,33 @@ scl::scene_object scl::scene::CreateObject(const std::string &Name)
 
 scl::scene_object scl::scene::CreaetOrGetObject(const std::string &Name)
 {
-    for (auto &&[entity, name] : Registry.view<name_component>().each())
-        if (name.Name == Name) return scene_object { entity, this };
+    scene_object_handle found_object = NameIndex.Find(Name);
+    if (found_object != entt::null) return scene_object { found_object, this };
     return this->CreateObject(Name);
 }
 
+std::vector<scl::scene_object_handle> scl::scene::Instantiate(const prefab &Prefab, size_t Count, const std::vector<transform_component> &Transforms)
+{
+    SCL_CORE_ASSERT(Transforms.empty() || Transforms.size() == Count, "Prefab \"{}\" instances and transforms count mismatch ({} and {}).",
+                    Prefab.GetName(), Count, Transforms.size());
+
+    std::vector<scene_object_handle> objects(Count);
+    Registry.create(objects.begin(), objects.end());
+
+    // Only name and transform are unique per instance.
+    u32 &instances_count = PrefabsInstancesCounts[Prefab.GetName()];
+    std::vector<name_component> names {};
+    names.reserve(Count);
+    for (size_t i = 0; i < Count; i++)
+        names.emplace_back(std::format("{} {}", Prefab.GetName(), ++instances_count));
+    Registry.insert<name_component>(objects.begin(), objects.end(), names.begin());
+
+    if (!Transforms.empty())            Registry.insert<transform_component>(objects.begin(), objects.end(), Transforms.begin());
+    else if (Prefab.GetTransform())     Registry.insert<transform_component>(objects.begin(), objects.end(), *Prefab.GetTransform());
+    Prefab.InsertComponents(Registry, objects);
+    return objects;
+}
+
 scl::scene_object scl::scene::GetSceneObject(scene_object_handle SceneObjectHandle)
 {
     return scene_object { SceneObjectHandle, this };
@@ -132,3 +239,26 @@ void scl::scene::RemoveObject(scene_object &Object)
     Object.Entity = entt::null;
     Object.Scene = nullptr;
 }
+
+void scl::scene::Clear()
+{
+    // Destruction signals remove objects from name and spatial indices.
+    Registry.clear();
+}
+
+scl::scene_object scl::scene::PickObject(const ray &Ray, float MaxDistance)
+{
+    UpdateSpatialIndex();
+
+    scene_object_handle nearest_object = entt::null;
+    float nearest_distance = MaxDistance;
+    SpatialIndex.QueryRay(Ray, MaxDistance, [&](scene_object_handle Entity)
+    {
+        auto [mesh, transform] = Registry.get<mesh_component, transform_component>(Entity);
+
+        float distance;
+        if (Ray.Intersect(mesh.Mesh->BoundBox.Transformed(transform), nearest_distance, distance) && distance < nearest_distance)
+            nearest_distance = distance, nearest_object = Entity;
+    });
+    return nearest_object == entt::null ? scene_object {} : scene_object { nearest_object, this };
+}
@@ -11,6 +11,10 @@
 #include <entt.hpp>
 
 #include "scene_scrtipts_system.h"
+#include "scene_bvh.h"
+#include "scene_name_index.h"
+#include "scene_snapshot.h"
+#include "prefab.h"
 
 namespace scl
 {
@@ -21,14 +25,13 @@ namespace scl
     class shader;
     class mesh;
 
-    using scene_object_handle = entt::entity;
-
     /*! Scene class. */
     class scene
     {
         friend class scene_object;
         friend class scene_serializer;
         friend class scene_hierarchy_window;
+        friend class scene_snapshot;
 
     private: /*! Scene data. */
         entt::registry Registry {}; /*! Container for all components.
@@ -41,6 +44,20 @@ namespace scl
         vec3    EnviromentAmbient { 0.1f };    /*! Scene enviroment ambient color. */
         float   UpdateDelay {};                /*! Scene scripts update call timer. */
 
+        /*! Scene object, placed to spatial index, data structure. */
+        struct spatial_proxy
+        {
+            int Proxy { scene_bvh::NULL_NODE };  /*! Scene object leaf in spatial index. */
+            u32 TransformVersion {};             /*! Scene object transform version, leaf was updated with. */
+            const mesh *Mesh {};                 /*! Scene object mesh, leaf was updated with. */
+            bound_box MeshBoundBox {};           /*! Scene object mesh bound box, leaf was updated with (mesh could grow after attachment). */
+        };
+
+        scene_bvh SpatialIndex {};                                                /*! Scene meshes spatial index. */
+        std::unordered_map<scene_object_handle, spatial_proxy> SpatialProxies {}; /*! Scene objects spatial index leaves. */
+        scene_name_index NameIndex {};                                            /*! Scene objects by name search index. */
+        std::unordered_map<std::string, u32> PrefabsInstancesCounts {};           /*! Count of created instances by prefab name (used for instances naming). */
+
     public: /*! Scene getter/setter functions. */
         /*! Scene viewport id gette function. */
         int GetViewportId() const { return ViewportId; }
@@ -51,6 +68,10 @@ namespace scl
         void SetViewportId(int ViewportId) { this->ViewportId = ViewportId; }
         /*! Scene enviroment ambient color setter function. */
         void SetEnviromentAmbient(const vec3 &EnviromentAmbient) { this->EnviromentAmbient = EnviromentAmbient; }
+        /*! Scene meshes spatial index getter function. */
+        const scene_bvh &GetSpatialIndex() const { return SpatialIndex; }
+        /*! Scene objects by name search index getter function. */
+        const scene_name_index &GetNameIndex() const { return NameIndex; }
 
     private:  /*! Scene methods. */
         /*!*
@@ -61,6 +82,15 @@ namespace scl
          */
         void CallUpdate();
 
+        /*!*
+         * Remove scene object from spatial index (called on mesh or transform component destruction) function.
+         *
+         * \param Registry - scene registry.
+         * \param Entity - scene object entity.
+         * \return None.
+         */
+        void OnSpatialObjectDestroy(entt::registry &Registry, entt::entity Entity);
+
     public:
         /*! Scene default constructor. */
         scene();
@@ -100,6 +130,17 @@ namespace scl
          */
         scene_object CreaetOrGetObject(const std::string &Name);
 
+        /*!*
+         * Create multiple scene objects from prefab function.
+         * All objects are created and get their components with single bulk operation per component type.
+         *
+         * \param Prefab - prefab to create objects from.
+         * \param Count - count of objects to create.
+         * \param Transforms - per object transforms (prefab default transform is used if empty).
+         * \return created scene objects handles.
+         */
+        std::vector<scene_object_handle> Instantiate(const prefab &Prefab, size_t Count, const std::vector<transform_component> &Transforms = {});
+
         /*!*
          * Get scene object by its handle function.
          * 
@@ -109,5 +150,49 @@ namespace scl
         scene_object GetSceneObject(scene_object_handle SceneObjectHandle);
 
         void RemoveObject(scene_object &Object);
+
+        /*!*
+         * Remove all scene objects function.
+         * Scene settings are kept, name and spatial indices are cleared.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Clear();
+
+        /*!*
+         * Capture scene state (all objects and engine components) function.
+         *
+         * \param None.
+         * \return created scene snapshot.
+         */
+        shared<scene_snapshot> Snapshot() const;
+
+        /*!*
+         * Restore scene state from snapshot function.
+         * All current scene objects are removed, snapshot objects are recreated with same handles.
+         *
+         * \param Snapshot - snapshot to restore scene state from.
+         * \return None.
+         */
+        void Restore(const scene_snapshot &Snapshot);
+
+        /*!*
+         * Synchronize spatial index with scene objects meshes and transforms function.
+         * Only objects with changed transform or mesh are updated.
+         *
+         * \param None.
+         * \return None.
+         */
+        void UpdateSpatialIndex();
+
+        /*!*
+         * Find nearest scene object, which mesh bound box intersects ray, function.
+         *
+         * \param Ray - ray to intersect objects with.
+         * \param MaxDistance - maximal distance along ray.
+         * \return found scene object (invalid if nothing found).
+         */
+        scene_object PickObject(const ray &Ray, float MaxDistance = 1000.0f);
     };
 }
@@ -0,0 +1,208 @@
+/*!****************************************************************//*!*
+ * \file   scene_bvh.cpp
+ * \brief  Scene objects dynamic bound volumes hierarchy (AABB tree) class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   28 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "scene_bvh.h"
+
+int scl::scene_bvh::AllocateNode()
+{
+    if (FreeList == NULL_NODE)
+    {
+        Nodes.emplace_back();
+        return (int)Nodes.size() - 1;
+    }
+
+    int node_index = FreeList;
+    FreeList = Nodes[node_index].Parent;
+    Nodes[node_index] = node {};
+    return node_index;
+}
+
+void scl::scene_bvh::FreeNode(int Node)
+{
+    Nodes[Node].Parent = FreeList;
+    Nodes[Node].Height = -1;
+    FreeList = Node;
+}
+
+void scl::scene_bvh::InsertLeaf(int Leaf)
+{
+    if (Root == NULL_NODE)
+    {
+        Root = Leaf;
+        Nodes[Root].Parent = NULL_NODE;
+        return;
+    }
+
+    // Find best sibling for new leaf, using surface area heuristic
+    const bound_box &leaf_box = Nodes[Leaf].Box;
+    int index = Root;
+    while (!Nodes[index].IsLeaf())
+    {
+        const node &n = Nodes[index];
+        float area = n.Box.GetSurfaceArea();
+        float combined_area = bound_box::Union(n.Box, leaf_box).GetSurfaceArea();
+
+        // Cost of creating new parent for this node and new leaf and
+        // minimum cost of pushing leaf further down the tree.
+        float cost = 2 * combined_area;
+        float inheritance_cost = 2 * (combined_area - area);
+
+        auto child_cost = [&](int Child)
+        {
+            const node &c = Nodes[Child];
+            float united_area = bound_box::Union(c.Box, leaf_box).GetSurfaceArea();
+            return (c.IsLeaf() ? united_area : united_area - c.Box.GetSurfaceArea()) + inheritance_cost;
+        };
+        float cost_left = child_cost(n.Left);
+        float cost_right = child_cost(n.Right);
+
+        if (cost < cost_left && cost < cost_right) break;
+        index = cost_left < cost_right ? n.Left : n.Right;
+    }
+    int sibling = index;
+
+    // Create new parent for sibling and leaf
+    int old_parent = Nodes[sibling].Parent;
+    int new_parent = AllocateNode();
+    Nodes[new_parent].Parent = old_parent;
+    Nodes[new_parent].Box = bound_box::Union(Nodes[Leaf].Box, Nodes[sibling].Box);
+    Nodes[new_parent].Height = Nodes[sibling].Height + 1;
+    Nodes[new_parent].Left = sibling;
+    Nodes[new_parent].Right = Leaf;
+    Nodes[sibling].Parent = new_parent;
+    Nodes[Leaf].Parent = new_parent;
+
+    if (old_parent == NULL_NODE)                  Root = new_parent;
+    else if (Nodes[old_parent].Left == sibling)   Nodes[old_parent].Left = new_parent;
+    else                                          Nodes[old_parent].Right = new_parent;
+
+    FixUpwards(Nodes[Leaf].Parent);
+}
+
+void scl::scene_bvh::RemoveLeaf(int Leaf)
+{
+    if (Leaf == Root)
+    {
+        Root = NULL_NODE;
+        return;
+    }
+
+    int parent = Nodes[Leaf].Parent;
+    int grand_parent = Nodes[parent].Parent;
+    int sibling = Nodes[parent].Left == Leaf ? Nodes[parent].Right : Nodes[parent].Left;
+
+    // Replace parent with sibling
+    if (grand_parent == NULL_NODE)
+    {
+        Root = sibling;
+        Nodes[sibling].Parent = NULL_NODE;
+        FreeNode(parent);
+        return;
+    }
+
+    if (Nodes[grand_parent].Left == parent) Nodes[grand_parent].Left = sibling;
+    else                                    Nodes[grand_parent].Right = sibling;
+    Nodes[sibling].Parent = grand_parent;
+    FreeNode(parent);
+    FixUpwards(grand_parent);
+}
+
+void scl::scene_bvh::FixUpwards(int Node)
+{
+    while (Node != NULL_NODE)
+    {
+        Node = Balance(Node);
+
+        node &n = Nodes[Node];
+        n.Height = 1 + math::Max(Nodes[n.Left].Height, Nodes[n.Right].Height);
+        n.Box = bound_box::Union(Nodes[n.Left].Box, Nodes[n.Right].Box);
+        Node = n.Parent;
+    }
+}
+
+int scl::scene_bvh::Balance(int A)
+{
+    node &a = Nodes[A];
+    if (a.IsLeaf() || a.Height < 2) return A;
+
+    // Node C is higher child, node B is lower one.
+    int B = a.Left, C = a.Right;
+    int balance = Nodes[C].Height - Nodes[B].Height;
+    if (balance >= -1 && balance <= 1) return A;
+    if (balance < -1) std::swap(B, C);
+
+    // Rotate C up: A becomes its child, lower grandchild of C moves to A in place of C.
+    node &b = Nodes[B];
+    node &c = Nodes[C];
+    int F = c.Left, G = c.Right;
+    if (Nodes[F].Height < Nodes[G].Height) std::swap(F, G);
+
+    c.Left = A;
+    c.Parent = a.Parent;
+    a.Parent = C;
+    if (c.Parent == NULL_NODE)               Root = C;
+    else if (Nodes[c.Parent].Left == A)      Nodes[c.Parent].Left = C;
+    else                                     Nodes[c.Parent].Right = C;
+
+    // Keep higher grandchild under C
+    node &high = Nodes[F];
+    node &low = Nodes[G];
+    c.Right = F;
+    high.Parent = C;
+    if (a.Left == C) a.Left = G;
+    else             a.Right = G;
+    low.Parent = A;
+
+    a.Box = bound_box::Union(b.Box, low.Box);
+    a.Height = 1 + math::Max(b.Height, low.Height);
+    c.Box = bound_box::Union(a.Box, high.Box);
+    c.Height = 1 + math::Max(a.Height, high.Height);
+    return C;
+}
+
+int scl::scene_bvh::Insert(scene_object_handle Object, const bound_box &Box)
+{
+    int proxy = AllocateNode();
+    Nodes[proxy].Box = Box.Enlarged(FAT_MARGIN);
+    Nodes[proxy].Object = Object;
+    Nodes[proxy].Height = 0;
+    InsertLeaf(proxy);
+    LeavesCount++;
+    return proxy;
+}
+
+void scl::scene_bvh::Remove(int Proxy)
+{
+    SCL_CORE_ASSERT(Proxy >= 0 && Proxy < Nodes.size() && Nodes[Proxy].IsLeaf(), "Invalid BVH proxy {}.", Proxy);
+
+    RemoveLeaf(Proxy);
+    FreeNode(Proxy);
+    LeavesCount--;
+}
+
+bool scl::scene_bvh::Move(int Proxy, const bound_box &Box)
+{
+    SCL_CORE_ASSERT(Proxy >= 0 && Proxy < Nodes.size() && Nodes[Proxy].IsLeaf(), "Invalid BVH proxy {}.", Proxy);
+
+    // Small movement inside enlarged box requires no changes.
+    if (Nodes[Proxy].Box.Contains(Box)) return false;
+
+    RemoveLeaf(Proxy);
+    Nodes[Proxy].Box = Box.Enlarged(FAT_MARGIN);
+    InsertLeaf(Proxy);
+    return true;
+}
+
+void scl::scene_bvh::Clear()
+{
+    Nodes.clear();
+    Root = FreeList = NULL_NODE;
+    LeavesCount = 0;
+}
@@ -0,0 +1,225 @@
+/*!****************************************************************//*!*
+ * \file   scene_bvh.h
+ * \brief  Scene objects dynamic bound volumes hierarchy (AABB tree) class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   28 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include <entt.hpp>
+
+#include "base.h"
+
+namespace scl
+{
+    using scene_object_handle = entt::entity;
+
+    /*!*
+     * Scene objects dynamic bound volumes hierarchy class.
+     * Each leaf stores enlarged (fat) bound box of scene object, so small movements require no tree changes,
+     * bigger ones reinsert only moved leaf. Tree is kept balanced with AVL-like rotations.
+     */
+    class scene_bvh
+    {
+    public: /*! Scene BVH data. */
+        /*! Tree null node index. */
+        static constexpr int NULL_NODE = -1;
+
+        /*! Margin, leaves bound boxes are enlarged with. */
+        static constexpr float FAT_MARGIN = 0.1f;
+
+    private:
+        /*! Tree node structure. */
+        struct node
+        {
+            bound_box Box {};                              /*! Node bound box (enlarged for leaves). */
+            scene_object_handle Object { entt::null };     /*! Leaf scene object handle. */
+            int Parent { NULL_NODE };                      /*! Parent node index (next free node index for free nodes). */
+            int Left { NULL_NODE };                        /*! Left child node index. */
+            int Right { NULL_NODE };                       /*! Right child node index. */
+            int Height { -1 };                             /*! Node subtree height (0 for leaves, -1 for free nodes). */
+
+            /*! Is node tree leaf flag getter function. */
+            bool IsLeaf() const { return Left == NULL_NODE; }
+        };
+
+        std::vector<node> Nodes {};      /*! Tree nodes pool. */
+        int Root { NULL_NODE };          /*! Tree root node index. */
+        int FreeList { NULL_NODE };      /*! First free node in pool index. */
+        u32 LeavesCount {};              /*! Tree leaves count. */
+
+    public: /*! Scene BVH getter/setter functions. */
+        /*! Tree leaves count getter function. */
+        u32 GetLeavesCount() const { return LeavesCount; }
+        /*! Tree height getter function. */
+        int GetHeight() const { return Root == NULL_NODE ? 0 : Nodes[Root].Height; }
+        /*! Leaf (enlarged) bound box getter function. */
+        const bound_box &GetBoundBox(int Proxy) const { return Nodes[Proxy].Box; }
+        /*! Leaf scene object getter function. */
+        scene_object_handle GetObject(int Proxy) const { return Nodes[Proxy].Object; }
+
+    private: /*! Scene BVH methods. */
+        int AllocateNode();
+        void FreeNode(int Node);
+        void InsertLeaf(int Leaf);
+        void RemoveLeaf(int Leaf);
+        int Balance(int Node);
+
+        /*!*
+         * Recalculate bound boxes and heights of all leaf ancestors (with tree balancing) function.
+         *
+         * \param Node - first node to fix.
+         * \return None.
+         */
+        void FixUpwards(int Node);
+
+    public:
+        /*!*
+         * Insert scene object to tree function.
+         *
+         * \param Object - scene object handle.
+         * \param Box - scene object world space bound box.
+         * \return created leaf (proxy) index.
+         */
+        int Insert(scene_object_handle Object, const bound_box &Box);
+
+        /*!*
+         * Remove scene object from tree function.
+         *
+         * \param Proxy - scene object leaf index.
+         * \return None.
+         */
+        void Remove(int Proxy);
+
+        /*!*
+         * Update scene object bound box function.
+         * If new box is still inside leaf enlarged box, tree is not changed.
+         *
+         * \param Proxy - scene object leaf index.
+         * \param Box - scene object new world space bound box.
+         * \return wheather tree was changed or not.
+         */
+        bool Move(int Proxy, const bound_box &Box);
+
+        /*!*
+         * Remove all scene objects from tree function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Clear();
+
+        /*!*
+         * Visit all tree nodes, satisfying predicate, and call function for leaves function.
+         *
+         * \param NodeTest - function, called for node bound box, returning wheather node subtree should be visited.
+         * \param Callback - function, called for each visited leaf with its scene object handle.
+         * \return None.
+         */
+        template <typename Ttest, typename Tcallback>
+        void Query(Ttest NodeTest, Tcallback Callback) const
+        {
+            if (Root == NULL_NODE) return;
+
+            std::vector<int> stack {};
+            stack.reserve(64);
+            stack.push_back(Root);
+            while (!stack.empty())
+            {
+                const node &n = Nodes[stack.back()];
+                stack.pop_back();
+
+                if (!NodeTest(n.Box)) continue;
+                if (n.IsLeaf())
+                {
+                    Callback(n.Object);
+                    continue;
+                }
+                stack.push_back(n.Left);
+                stack.push_back(n.Right);
+            }
+        }
+
+        /*!*
+         * Find all scene objects, overlapping bound box function.
+         *
+         * \param Box - box to check overlap with.
+         * \param Callback - function, called for each found scene object handle.
+         * \return None.
+         */
+        template <typename Tcallback>
+        void QueryBox(const bound_box &Box, Tcallback Callback) const
+        {
+            Query([&](const bound_box &NodeBox) { return NodeBox.Intersects(Box); }, Callback);
+        }
+
+        /*!*
+         * Find all scene objects, overlapping sphere function.
+         *
+         * \param Center - sphere center.
+         * \param Radius - sphere radius.
+         * \param Callback - function, called for each found scene object handle.
+         * \return None.
+         */
+        template <typename Tcallback>
+        void QuerySphere(const vec3 &Center, float Radius, Tcallback Callback) const
+        {
+            Query([&](const bound_box &NodeBox) { return NodeBox.IntersectsSphere(Center, Radius); }, Callback);
+        }
+
+        /*!*
+         * Find all scene objects, intersecting ray function.
+         *
+         * \param Ray - ray to intersect with.
+         * \param MaxDistance - maximal distance along ray.
+         * \param Callback - function, called for each found scene object handle.
+         * \return None.
+         */
+        template <typename Tcallback>
+        void QueryRay(const ray &Ray, float MaxDistance, Tcallback Callback) const
+        {
+            float distance;
+            Query([&](const bound_box &NodeBox) { return Ray.Intersect(NodeBox, MaxDistance, distance); }, Callback);
+        }
+
+        /*!*
+         * Find all scene objects, visible in frustum, function.
+         * Subtrees, fully inside frustum, are reported without further tests.
+         *
+         * \param Frustum - frustum to test objects with.
+         * \param Callback - function, called for each found scene object handle.
+         * \return None.
+         */
+        template <typename Tcallback>
+        void QueryFrustum(const frustum &Frustum, Tcallback Callback) const
+        {
+            if (Root == NULL_NODE) return;
+
+            std::vector<std::pair<int, bool>> stack {};
+            stack.reserve(64);
+            stack.emplace_back(Root, false);
+            while (!stack.empty())
+            {
+                auto [index, is_inside] = stack.back();
+                stack.pop_back();
+
+                const node &n = Nodes[index];
+                if (!is_inside)
+                {
+                    frustum::test_result result = Frustum.Test(n.Box);
+                    if (result == frustum::test_result::OUTSIDE) continue;
+                    is_inside = result == frustum::test_result::INSIDE;
+                }
+                if (n.IsLeaf())
+                {
+                    Callback(n.Object);
+                    continue;
+                }
+                stack.emplace_back(n.Left, is_inside);
+                stack.emplace_back(n.Right, is_inside);
+            }
+        }
+    };
+}
@@ -0,0 +1,146 @@
+/*!****************************************************************//*!*
+ * \file   scene_loader.cpp
+ * \brief  Incremental (time-sliced) scene deserialization class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   27 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "scene_loader.h"
+#include "utilities/assets_manager/files_load.h"
+#include "utilities/assets_manager/meshes_load.h"
+
+scl::scene_loader::scene_loader(const shared<scene> &Scene, const std::filesystem::path &InFileName) :
+    Scene(Scene)
+{
+    const std::string root_json_string = assets_manager::LoadFile(InFileName);
+    RootJson = json::parse(root_json_string, nullptr, false);
+    if (RootJson.is_discarded())
+    {
+        SCL_CORE_ERROR("Scene file \"{}\" parsing failed.", InFileName.string());
+        RootJson = json::object();
+        IsSettingsDeserialized = true;
+        return;
+    }
+
+    const auto &objects_json = RootJson.find("objects");
+    if (objects_json == RootJson.end() || !objects_json->is_array()) return;
+    ObjectsCount = objects_json->size();
+
+    // Start reading all referenced models before any object is created, each model only once
+    for (const auto &object_json : *objects_json)
+    {
+        std::string mesh_file_name = scene_serializer::GetMeshFileName(object_json);
+        if (mesh_file_name.empty() || MeshRequests.find(mesh_file_name) != MeshRequests.end()) continue;
+
+        mesh_request &request = MeshRequests[mesh_file_name];
+        request.Source = std::async(std::launch::async, assets_manager::ReadMeshes, std::filesystem::path(mesh_file_name));
+    }
+    SCL_CORE_INFO("Scene \"{}\" loading started ({} object(s), {} model(s)).", InFileName.string(), ObjectsCount, MeshRequests.size());
+}
+
+scl::scene_loader::~scene_loader()
+{
+    // Background jobs futures are waited in their destructors, so loader destruction could block.
+    for (auto &[file_name, request] : MeshRequests)
+        if (request.Source.valid()) request.Source.wait();
+}
+
+void scl::scene_loader::PollMeshRequests()
+{
+    for (auto &[file_name, request] : MeshRequests)
+    {
+        if (request.IsDone || request.Uploader != nullptr || !request.Source.valid()) continue;
+        if (request.Source.wait_for(std::chrono::seconds(0)) != std::future_status::ready) continue;
+
+        shared<assets_manager::mesh_source> source = request.Source.get();
+        if (source == nullptr)
+        {
+            SCL_CORE_ERROR("Model \"{}\" loading failed.", file_name);
+            request.IsDone = true;
+            MeshesLoadedCount++;
+            continue;
+        }
+        request.Uploader = CreateUnique<assets_manager::mesh_uploader>(source);
+    }
+}
+
+void scl::scene_loader::AttachMesh(mesh_request &Request)
+{
+    const shared<mesh> &loaded_mesh = Request.Uploader->GetMesh();
+    for (scene_object_handle target : Request.Targets)
+    {
+        scene_object object = Scene->GetSceneObject(target);
+        if (!object.IsOk()) continue;
+
+        if (object.HasComponent<mesh_component>()) object.GetComponent<mesh_component>().Mesh = loaded_mesh;
+        else                                       object.AddComponent<mesh_component>(loaded_mesh);
+    }
+
+    Request.Uploader.reset();
+    Request.Targets.clear();
+    Request.IsDone = true;
+    MeshesLoadedCount++;
+}
+
+bool scl::scene_loader::Update(float BudgetMs)
+{
+    if (IsLoaded()) return true;
+
+    using clock = std::chrono::high_resolution_clock;
+    const auto start_time = clock::now();
+    auto is_budget_exceeded = [&]()
+    {
+        return std::chrono::duration<float, std::milli>(clock::now() - start_time).count() >= BudgetMs;
+    };
+
+    if (!IsSettingsDeserialized)
+    {
+        scene_serializer::DeserializeSettings(RootJson, Scene);
+        IsSettingsDeserialized = true;
+    }
+
+    // Create scene objects and their components (except meshes, they are attached after load)
+    if (ObjectsDeserializedCount < ObjectsCount)
+    {
+        const json &objects_json = RootJson["objects"];
+        do
+        {
+            const json &object_json = objects_json[ObjectsDeserializedCount++];
+            scene_object object = scene_serializer::DeserializeSceneObject(object_json, Scene);
+
+            auto request = MeshRequests.find(scene_serializer::GetMeshFileName(object_json));
+            if (request != MeshRequests.end())
+                request->second.Targets.push_back(object.GetHandle());
+        } while (ObjectsDeserializedCount < ObjectsCount && !is_budget_exceeded());
+
+        // Meshes could be attached only to existing objects.
+        if (ObjectsDeserializedCount < ObjectsCount) return false;
+    }
+
+    // Upload models, read in background, at least one sub-mesh per frame to guarantee progress
+    PollMeshRequests();
+    for (auto &[file_name, request] : MeshRequests)
+    {
+        if (request.Uploader == nullptr) continue;
+
+        while (!request.Uploader->Step() && !is_budget_exceeded());
+        if (request.Uploader->IsDone()) AttachMesh(request);
+        if (is_budget_exceeded()) break;
+    }
+
+    if (IsLoaded())
+    {
+        RootJson = json {};
+        SCL_CORE_SUCCES("Scene loading finished.");
+        return true;
+    }
+    return false;
+}
+
+scl::shared<scl::scene_loader> scl::scene_loader::Create(const shared<scene> &Scene, const std::filesystem::path &InFileName)
+{
+    return CreateShared<scene_loader>(Scene, InFileName);
+}
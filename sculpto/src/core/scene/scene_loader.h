@@ -0,0 +1,106 @@
+/*!****************************************************************//*!*
+ * \file   scene_loader.h
+ * \brief  Incremental (time-sliced) scene deserialization class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   27 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "scene_serializer.h"
+
+namespace scl
+{
+    /*! Classes declaration. */
+    namespace assets_manager
+    {
+        struct mesh_source;
+        class mesh_uploader;
+    }
+
+    /*!*
+     * Incremental scene loader class.
+     * Parses scene objects and components in main thread, reads referenced models in background,
+     * uploads them to GPU sub-mesh by sub-mesh. All main thread work is limited by per-frame time budget.
+     */
+    class scene_loader
+    {
+    private: /*! Scene loader data. */
+        /*! Model, referenced by scene objects, loading request structure. */
+        struct mesh_request
+        {
+            std::future<shared<assets_manager::mesh_source>> Source {};  /*! Background model reading job. */
+            unique<assets_manager::mesh_uploader> Uploader {};           /*! Model GPU upload state (created after background job finish). */
+            std::vector<scene_object_handle> Targets {};                 /*! Scene objects, to attach loaded mesh to. */
+            bool IsDone {};                                              /*! Flag, showing wheather mesh loaded and attached. */
+        };
+
+        shared<scene> Scene {};                                          /*! Scene to put deserialized data in. */
+        json RootJson {};                                                /*! Scene file root json. */
+        std::unordered_map<std::string, mesh_request> MeshRequests {};   /*! Models loading requests by file name. */
+        size_t ObjectsCount {};                                          /*! Total count of scene objects in scene file. */
+        size_t ObjectsDeserializedCount {};                              /*! Count of already deserialized scene objects. */
+        size_t MeshesLoadedCount {};                                     /*! Count of already loaded and attached models. */
+        bool IsSettingsDeserialized {};                                  /*! Flag, showing wheather scene settings deserialized or not. */
+
+    public: /*! Scene loader getter/setter functions. */
+        /*! Loading scene getter function. */
+        const shared<scene> &GetScene() const { return Scene; }
+        /*! Is scene completely loaded flag getter function. */
+        bool IsLoaded() const { return ObjectsDeserializedCount == ObjectsCount && MeshesLoadedCount == MeshRequests.size(); }
+        /*! Scene loading progress (in range [0;1]) getter function. */
+        float GetProgress() const
+        {
+            size_t total = ObjectsCount + MeshRequests.size();
+            return total == 0 ? 1.0f : (float)(ObjectsDeserializedCount + MeshesLoadedCount) / total;
+        }
+
+    private: /*! Scene loader methods. */
+        /*!*
+         * Check if any background model reading job finished and start its upload function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void PollMeshRequests();
+
+        /*!*
+         * Attach fully uploaded mesh to all its target scene objects function.
+         *
+         * \param Request - loading request of uploaded mesh.
+         * \return None.
+         */
+        void AttachMesh(mesh_request &Request);
+
+    public:
+        /*!*
+         * Scene loader constructor.
+         * Parses scene file and starts background reading of all referenced models.
+         *
+         * \param Scene - scene to put deserialized data in.
+         * \param InFileName - scene file name.
+         */
+        scene_loader(const shared<scene> &Scene, const std::filesystem::path &InFileName);
+
+        /*! Scene loader default destructor. */
+        ~scene_loader();
+
+        /*!*
+         * Continue scene loading function. Should be called each frame until scene is loaded.
+         *
+         * \param BudgetMs - maximal time (in milliseconds), which could be spent on loading this frame.
+         * \return wheather scene is completely loaded or not.
+         */
+        bool Update(float BudgetMs = 4);
+
+        /*!*
+         * Scene loader creation function.
+         *
+         * \param Scene - scene to put deserialized data in.
+         * \param InFileName - scene file name.
+         * \return created scene loader pointer.
+         */
+        static shared<scene_loader> Create(const shared<scene> &Scene, const std::filesystem::path &InFileName);
+    };
+}
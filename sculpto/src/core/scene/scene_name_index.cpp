@@ -0,0 +1,71 @@
+/*!****************************************************************//*!*
+ * \file   scene_name_index.cpp
+ * \brief  Scene objects by name search index class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   29 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "scene_name_index.h"
+#include "core/components/name_component.h"
+
+void scl::scene_name_index::Add(scene_object_handle Object, const std::string &Name)
+{
+    Buckets[StringId(Name)].push_back(entry { Name, Object });
+    ObjectsNames[Object] = Name;
+    SortedNames.emplace(Name, Object);
+}
+
+void scl::scene_name_index::Remove(scene_object_handle Object)
+{
+    auto name_it = ObjectsNames.find(Object);
+    if (name_it == ObjectsNames.end()) return;
+    const std::string &name = name_it->second;
+
+    auto bucket_it = Buckets.find(StringId(name));
+    if (bucket_it != Buckets.end())
+    {
+        std::vector<entry> &chain = bucket_it->second;
+        auto entry_it = std::find_if(chain.begin(), chain.end(), [&](const entry &Entry) { return Entry.Object == Object; });
+        if (entry_it != chain.end()) chain.erase(entry_it);
+        if (chain.empty()) Buckets.erase(bucket_it);
+    }
+    SortedNames.erase({ name, Object });
+    ObjectsNames.erase(name_it);
+}
+
+scl::scene_object_handle scl::scene_name_index::Find(const std::string &Name) const
+{
+    auto bucket_it = Buckets.find(StringId(Name));
+    if (bucket_it == Buckets.end()) return entt::null;
+
+    // Different names could have same string id, so chained names are compared.
+    for (const entry &entry : bucket_it->second)
+        if (entry.Name == Name) return entry.Object;
+    return entt::null;
+}
+
+void scl::scene_name_index::Clear()
+{
+    Buckets.clear();
+    ObjectsNames.clear();
+    SortedNames.clear();
+}
+
+void scl::scene_name_index::OnNameConstruct(entt::registry &Registry, entt::entity Entity)
+{
+    Add(Entity, Registry.get<name_component>(Entity).Name);
+}
+
+void scl::scene_name_index::OnNameUpdate(entt::registry &Registry, entt::entity Entity)
+{
+    Remove(Entity);
+    Add(Entity, Registry.get<name_component>(Entity).Name);
+}
+
+void scl::scene_name_index::OnNameDestroy(entt::registry &Registry, entt::entity Entity)
+{
+    Remove(Entity);
+}
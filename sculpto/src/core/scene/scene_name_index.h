@@ -0,0 +1,101 @@
+/*!****************************************************************//*!*
+ * \file   scene_name_index.h
+ * \brief  Scene objects by name search index class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   29 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include <entt.hpp>
+
+#include "base.h"
+#include "utilities/string/string_id.h"
+
+namespace scl
+{
+    using scene_object_handle = entt::entity;
+
+    /*!*
+     * Scene objects by name search index class.
+     * Names are hashed with CRC32 string id, objects with colliding ids (or equal names) are chained in bucket
+     * in order of addition. Sorted names set allows prefix searches.
+     * Index is kept up to date via registry name component construct/update/destroy signals.
+     */
+    class scene_name_index
+    {
+    private: /*! Scene name index data. */
+        /*! Bucket chain entry structure. */
+        struct entry
+        {
+            std::string Name {};                           /*! Scene object name. */
+            scene_object_handle Object { entt::null };     /*! Scene object handle. */
+        };
+
+        std::unordered_map<string_id, std::vector<entry>> Buckets {};                /*! Objects by name string id chains. */
+        std::unordered_map<scene_object_handle, std::string> ObjectsNames {};        /*! Indexed objects names (to remove outdated names). */
+        std::set<std::pair<std::string, scene_object_handle>> SortedNames {};       /*! Objects sorted by name (for prefix searches). */
+
+    private: /*! Scene name index methods. */
+        /*!*
+         * Add scene object to index function.
+         *
+         * \param Object - scene object handle.
+         * \param Name - scene object name.
+         * \return None.
+         */
+        void Add(scene_object_handle Object, const std::string &Name);
+
+        /*!*
+         * Remove scene object from index function.
+         *
+         * \param Object - scene object handle.
+         * \return None.
+         */
+        void Remove(scene_object_handle Object);
+
+    public:
+        /*! Count of indexed scene objects getter function. */
+        size_t GetSize() const { return ObjectsNames.size(); }
+
+        /*!*
+         * Find first added scene object with specified name function.
+         *
+         * \param Name - name of scene object to find.
+         * \return found scene object handle (entt::null if nothing found).
+         */
+        scene_object_handle Find(const std::string &Name) const;
+
+        /*!*
+         * Find all scene objects, which name starts with specified prefix, function.
+         *
+         * \param Prefix - scene objects name prefix.
+         * \param Callback - function, called for each found scene object (in names alphabetic order) with its handle and name.
+         * \return None.
+         */
+        template <typename Tcallback>
+        void FindByPrefix(const std::string &Prefix, Tcallback Callback) const
+        {
+            // Search starts from smallest handle (entt::null is the largest one), so objects named exactly as prefix are found too.
+            for (auto it = SortedNames.lower_bound({ Prefix, scene_object_handle {} }); it != SortedNames.end(); ++it)
+            {
+                if (it->first.compare(0, Prefix.size(), Prefix) != 0) break;
+                Callback(it->second, it->first);
+            }
+        }
+
+        /*!*
+         * Remove all scene objects from index function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Clear();
+
+    public: /*! Registry name component signals handlers. */
+        void OnNameConstruct(entt::registry &Registry, entt::entity Entity);
+        void OnNameUpdate(entt::registry &Registry, entt::entity Entity);
+        void OnNameDestroy(entt::registry &Registry, entt::entity Entity);
+    };
+}
@@ -114,6 +114,21 @@ namespace scl
             return Scene->Registry.get<T>(Entity);
         }
 
+        /*!*
+         * Modify object component and notify component update listeners function.
+         * Should be used for components, tracked by scene (e.g. name component for scene name index).
+         *
+         * \tparam component to modify.
+         * \param Func - function, called with component reference to modify it.
+         * \return modified component.
+         */
+        template <typename T, typename Tfunc>
+        decltype(auto) PatchComponent(Tfunc Func)
+        {
+            SCL_CORE_ASSERT(HasComponent<T>(), "Scene object don't have \"{}\" component!", typeid(T).name());
+            return Scene->Registry.patch<T>(Entity, Func);
+        }
+
         /*!*
          * Remove component from scene object function.
          * 
@@ -75,6 +75,11 @@ void scl::to_json(json &Json, const spot_light_component &SpotLightComponent)
     Json["outer_cutoff_angle"] = SpotLightComponent.GetOuterCutoff();
 }
 
+void scl::to_json(json &Json, const mesh_component &MeshComponent)
+{
+    Json["file_name"] = MeshComponent.Mesh != nullptr ? MeshComponent.Mesh->FileName : "";
+}
+
 bool scl::from_json(const json &Json, name_component &NameComponent)
 {
     const auto &name = Json.find("name");
@@ -191,6 +196,7 @@ void scl::scene_serializer::SerializeObject(json &Json, const scene_object &Scen
     SerializeComponent<point_light_component>(Json, SceneObject);
     SerializeComponent<directional_light_component>(Json, SceneObject);
     SerializeComponent<spot_light_component>(Json, SceneObject);
+    SerializeComponent<mesh_component>(Json, SceneObject);
 }
 
 void scl::scene_serializer::DeserializeObject(const json &Json, scene_object &SceneObject)
@@ -237,17 +243,13 @@ void scl::scene_serializer::Serialize(const shared<scene> &Scene, const std::fil
     SCL_CORE_INFO("Scene saved to file \"{}\".", OutFileName.string());
 }
 
-void scl::scene_serializer::Deserialize(shared<scene> &Scene, const std::filesystem::path &InFileName)
+void scl::scene_serializer::DeserializeSettings(const json &RootJson, shared<scene> &Scene)
 {
-    const std::string root_json_string = assets_manager::LoadFile(InFileName);
-    const json root_json = json::parse(root_json_string);
-
-    const auto &gui_json = root_json.find("gui");
-    const auto &render_json = root_json.find("render");
-    const auto &scene_data_json = root_json.find("scene_data");
-    const auto &objects_json = root_json.find("objects");
+    const auto &gui_json = RootJson.find("gui");
+    const auto &render_json = RootJson.find("render");
+    const auto &scene_data_json = RootJson.find("scene_data");
 
-    if (gui_json != root_json.end())
+    if (gui_json != RootJson.end())
     {
         const auto &is_gui_enabled = gui_json->find("is_gui_enabled");
         const auto &is_dockspace = gui_json->find("is_dockspace");
@@ -255,7 +257,7 @@ void scl::scene_serializer::Deserialize(shared<scene> &Scene, const std::filesys
         if (is_gui_enabled != gui_json->end()) application::Get().GuiEnabled = is_gui_enabled->get<bool>();
         if (is_dockspace != gui_json->end()) gui::IsDockspace = is_dockspace->get<bool>();
     }
-    if (render_json != root_json.end())
+    if (render_json != RootJson.end())
     {
         const auto &clear_color = render_json->find("clear_color");
         const auto &is_wireframe = render_json->find("is_wireframe");
@@ -265,7 +267,7 @@ void scl::scene_serializer::Deserialize(shared<scene> &Scene, const std::filesys
         if (is_wireframe != render_json->end()) render_bridge::SetWireframeMode(is_wireframe->get<bool>());
         if (is_vsync != render_json->end()) render_bridge::SetVSync(is_vsync->get<bool>());
     }
-    if (scene_data_json != root_json.end())
+    if (scene_data_json != RootJson.end())
     {
         const auto &viewport_id = scene_data_json->find("viewport_id");
         const auto &enviroment_ambient = scene_data_json->find("enviroment_ambient");
@@ -273,25 +275,67 @@ void scl::scene_serializer::Deserialize(shared<scene> &Scene, const std::filesys
         if (viewport_id != scene_data_json->end()) Scene->SetViewportId(viewport_id->get<int>());
         if (enviroment_ambient != scene_data_json->end()) Scene->SetEnviromentAmbient(enviroment_ambient->get<vec3>());
     }
+}
+
+scl::scene_object scl::scene_serializer::DeserializeSceneObject(const json &ObjectJson, shared<scene> &Scene)
+{
+    scene_object object;
+    const auto &name_json = ObjectJson.find(typeid(name_component).name());
+    if (name_json == ObjectJson.end())
+    {
+        object = Scene->CreateObject();
+    }
+    else
+    {
+        name_component object_name_component { "" };
+        from_json(*name_json, object_name_component);
+        object = Scene->CreaetOrGetObject(object_name_component.Name);
+    }
+
+    DeserializeObject(ObjectJson, object);
+    return object;
+}
+
+std::string scl::scene_serializer::GetMeshFileName(const json &ObjectJson)
+{
+    const auto &mesh_json = ObjectJson.find(typeid(mesh_component).name());
+    if (mesh_json == ObjectJson.end()) return "";
+
+    const auto &file_name = mesh_json->find("file_name");
+    if (file_name == mesh_json->end()) return "";
+
+    // Meshes, created from topology objects has no file to load from.
+    std::string mesh_file_name = file_name->get<std::string>();
+    if (mesh_file_name.empty() || !std::filesystem::exists(mesh_file_name)) return "";
+    return mesh_file_name;
+}
+
+void scl::scene_serializer::Deserialize(shared<scene> &Scene, const std::filesystem::path &InFileName)
+{
+    const std::string root_json_string = assets_manager::LoadFile(InFileName);
+    const json root_json = json::parse(root_json_string);
+
+    DeserializeSettings(root_json, Scene);
+
+    const auto &objects_json = root_json.find("objects");
     if (objects_json != root_json.end())
     {
+        std::unordered_map<std::string, shared<mesh>> loaded_meshes;
         for (const auto &object_json : *objects_json)
         {
-            scene_object object;
-            const auto &name_json = object_json.find(typeid(name_component).name());
-            if (name_json == object_json.end())
-            {
-                object = Scene->CreateObject();
-            }
-            else
-            {
-                name_component object_name_component { "" };
-                from_json(*name_json, object_name_component);
-                object = Scene->CreaetOrGetObject(object_name_component.Name);
-            }
-
-            DeserializeObject(object_json, object);
+            scene_object object = DeserializeSceneObject(object_json, Scene);
+
+            // Objects, referencing same model file, share loaded mesh.
+            std::string mesh_file_name = GetMeshFileName(object_json);
+            if (mesh_file_name.empty()) continue;
+
+            auto loaded_mesh = loaded_meshes.find(mesh_file_name);
+            if (loaded_mesh == loaded_meshes.end())
+                loaded_mesh = loaded_meshes.emplace(mesh_file_name, assets_manager::LoadMeshes(mesh_file_name)).first;
+            if (loaded_mesh->second == nullptr) continue;
+
+            if (object.HasComponent<mesh_component>()) object.GetComponent<mesh_component>().Mesh = loaded_mesh->second;
+            else                                       object.AddComponent<mesh_component>(loaded_mesh->second);
         }
     }
-
 }
@@ -66,6 +66,7 @@ namespace scl
     void to_json(json &Json, const point_light_component       &PointLightComponent);
     void to_json(json &Json, const directional_light_component &DirectionalLightComponent);
     void to_json(json &Json, const spot_light_component        &SpotLightComponent);
+    void to_json(json &Json, const mesh_component              &MeshComponent);
 
     bool from_json(const json &Json, name_component &NameComponent);
     bool from_json(const json &Json, transform_component &TransformComponent);
@@ -77,6 +78,8 @@ namespace scl
     /*! Scene serializer class. */
     class scene_serializer
     {
+        friend class scene_loader;
+
     private: /*! Scene serializer data. */
         weak<scene> Scene;
 
@@ -123,6 +126,32 @@ namespace scl
          */
         static void DeserializeObject(const json &Json, scene_object &SceneObject);
 
+        /*!*
+         * Deserialize scene settings (gui, render and scene data sections) from root json function.
+         *
+         * \param RootJson - scene file root json.
+         * \param Scene - scene to put deserialized data in.
+         * \return None.
+         */
+        static void DeserializeSettings(const json &RootJson, shared<scene> &Scene);
+
+        /*!*
+         * Get or create scene object by its json name and deserialize all its components (except mesh) function.
+         *
+         * \param ObjectJson - scene object json.
+         * \param Scene - scene to put deserialized object in.
+         * \return deserialized scene object.
+         */
+        static scene_object DeserializeSceneObject(const json &ObjectJson, shared<scene> &Scene);
+
+        /*!*
+         * Get file name of model, attached to scene object as mesh component, function.
+         *
+         * \param ObjectJson - scene object json.
+         * \return model file name (empty if object has no mesh, loaded from file).
+         */
+        static std::string GetMeshFileName(const json &ObjectJson);
+
     public:
         /*!*
          * Serialize scene data to file function.
@@ -0,0 +1,69 @@
+/*!****************************************************************//*!*
+ * \file   scene_snapshot.cpp
+ * \brief  Scene state snapshot and snapshots history classes implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   29 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "scene_snapshot.h"
+#include "scene.h"
+#include "core/components/components.h"
+
+scl::scene_snapshot::scene_snapshot(const scene &Scene) :
+    EnviromentAmbient(Scene.EnviromentAmbient)
+{
+    const entt::registry &registry = Scene.Registry;
+    Entities.assign(registry.data(), registry.data() + registry.size());
+    ReleasedEntities = registry.released();
+    AliveEntitiesCount = registry.alive();
+
+    CapturePools<name_component,
+                 transform_component,
+                 mesh_component,
+                 skybox_component,
+                 camera_component,
+                 native_script_component,
+                 point_light_component,
+                 directional_light_component,
+                 spot_light_component>(registry);
+}
+
+scl::shared<scl::scene_snapshot> scl::scene_snapshot::Create(const scene &Scene)
+{
+    return CreateShared<scene_snapshot>(Scene);
+}
+
+scl::scene_snapshot_history::scene_snapshot_history(size_t Capacity) :
+    Snapshots(math::Max<size_t>(Capacity, 1)) {}
+
+void scl::scene_snapshot_history::Push(const shared<scene_snapshot> &Snapshot)
+{
+    Snapshots[Head] = Snapshot;
+    Head = (Head + 1) % Snapshots.size();
+    Count = math::Min(Count + 1, Snapshots.size());
+}
+
+scl::shared<scl::scene_snapshot> scl::scene_snapshot_history::Get(size_t StepsBack) const
+{
+    if (StepsBack >= Count) return nullptr;
+    return Snapshots[(Head + Snapshots.size() - 1 - StepsBack) % Snapshots.size()];
+}
+
+void scl::scene_snapshot_history::Pop(size_t Count)
+{
+    for (Count = math::Min(Count, this->Count); Count > 0; Count--)
+    {
+        Head = (Head + Snapshots.size() - 1) % Snapshots.size();
+        Snapshots[Head].reset();
+        this->Count--;
+    }
+}
+
+void scl::scene_snapshot_history::Clear()
+{
+    for (auto &snapshot : Snapshots) snapshot.reset();
+    Head = Count = 0;
+}
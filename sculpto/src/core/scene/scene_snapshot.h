@@ -0,0 +1,193 @@
+/*!****************************************************************//*!*
+ * \file   scene_snapshot.h
+ * \brief  Scene state snapshot and snapshots history classes definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   29 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include <entt.hpp>
+
+#include "base.h"
+
+namespace scl
+{
+    /*! Classes declaration. */
+    class scene;
+
+    /*!*
+     * Scene state snapshot class.
+     * Stores scene entities identifiers and copies of all engine components pools.
+     * Trivially copyable components are copied with memcpy page by page, other ones are copy constructed,
+     * so heavy shared resources (meshes, frame buffers) are only reference counted, not duplicated.
+     */
+    class scene_snapshot
+    {
+        friend class scene;
+
+    private: /*! Scene snapshot data. */
+        /*! Single component pool snapshot interface. */
+        struct pool_snapshot
+        {
+            virtual ~pool_snapshot() = default;
+
+            /*!*
+             * Put stored components back to registry function.
+             *
+             * \param Registry - registry to put components to.
+             * \return None.
+             */
+            virtual void Restore(entt::registry &Registry) const = 0;
+
+            /*! Stored components count getter function. */
+            virtual size_t GetSize() const = 0;
+        };
+
+        /*! Single component type pool snapshot class. */
+        template <typename T>
+        struct typed_pool_snapshot : public pool_snapshot
+        {
+            std::vector<entt::entity> Entities {};  /*! Entities, owning components. */
+            std::vector<T> Components {};           /*! Components (in entities order). */
+
+            /*!*
+             * Typed pool snapshot constructor.
+             *
+             * \param Registry - registry to copy component pool from.
+             */
+            typed_pool_snapshot(const entt::registry &Registry)
+            {
+                const auto &storage = Registry.storage<T>();
+                const size_t size = storage.size();
+                if (size == 0) return;
+
+                Entities.assign(storage.data(), storage.data() + size);
+                if constexpr (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+                {
+                    // Components are stored in fixed size pages, so they are copied page by page.
+                    constexpr size_t page_size = entt::component_traits<T>::page_size;
+                    Components.resize(size);
+                    for (size_t offset = 0; offset < size; offset += page_size)
+                        memcpy(Components.data() + offset, storage.raw()[offset / page_size],
+                               math::Min(page_size, size - offset) * sizeof(T));
+                }
+                else
+                {
+                    Components.reserve(size);
+                    for (size_t i = 0; i < size; i++)
+                        Components.push_back(storage.get(Entities[i]));
+                }
+            }
+
+            void Restore(entt::registry &Registry) const override
+            {
+                if (!Entities.empty())
+                    Registry.insert<T>(Entities.begin(), Entities.end(), Components.begin());
+            }
+
+            size_t GetSize() const override { return Entities.size(); }
+        };
+
+        std::vector<entt::entity> Entities {};                 /*! Registry entities (both alive and released). */
+        entt::entity ReleasedEntities { entt::null };          /*! Registry released entities list head. */
+        std::vector<unique<pool_snapshot>> Pools {};           /*! Components pools snapshots. */
+        vec3 EnviromentAmbient {};                             /*! Scene enviroment ambient color. */
+        size_t AliveEntitiesCount {};                          /*! Count of alive entities. */
+
+    private: /*! Scene snapshot methods. */
+        /*!*
+         * Copy pools of specified component types function.
+         *
+         * \tparam Tcomponents - components types to copy pools of.
+         * \param Registry - registry to copy pools from.
+         * \return None.
+         */
+        template <typename... Tcomponents>
+        void CapturePools(const entt::registry &Registry)
+        {
+            (Pools.push_back(CreateUnique<typed_pool_snapshot<Tcomponents>>(Registry)), ...);
+        }
+
+    public:
+        /*! Snapshot alive scene objects count getter function. */
+        size_t GetObjectsCount() const { return AliveEntitiesCount; }
+
+        /*!*
+         * Scene snapshot constructor.
+         *
+         * \param Scene - scene to capture state of.
+         */
+        scene_snapshot(const scene &Scene);
+
+        /*! Scene snapshot default destructor. */
+        ~scene_snapshot() = default;
+
+        /*!*
+         * Scene snapshot creation function.
+         *
+         * \param Scene - scene to capture state of.
+         * \return created snapshot pointer.
+         */
+        static shared<scene_snapshot> Create(const scene &Scene);
+    };
+
+    /*!*
+     * Scene snapshots history (ring buffer) class.
+     * Stores up to specified count of latest snapshots, oldest ones are overwritten.
+     */
+    class scene_snapshot_history
+    {
+    private: /*! Scene snapshots history data. */
+        std::vector<shared<scene_snapshot>> Snapshots {};  /*! Snapshots ring buffer. */
+        size_t Head {};                                     /*! Next snapshot to write index. */
+        size_t Count {};                                    /*! Stored snapshots count. */
+
+    public: /*! Scene snapshots history getter/setter functions. */
+        /*! Stored snapshots count getter function. */
+        size_t GetCount() const { return Count; }
+        /*! Maximum stored snapshots count getter function. */
+        size_t GetCapacity() const { return Snapshots.size(); }
+
+    public:
+        /*!*
+         * Scene snapshots history constructor.
+         *
+         * \param Capacity - maximum stored snapshots count.
+         */
+        scene_snapshot_history(size_t Capacity = 16);
+
+        /*!*
+         * Store snapshot in history (overwriting oldest one if history is full) function.
+         *
+         * \param Snapshot - snapshot to store.
+         * \return None.
+         */
+        void Push(const shared<scene_snapshot> &Snapshot);
+
+        /*!*
+         * Get stored snapshot function.
+         *
+         * \param StepsBack - snapshot index, counting from latest one (0 - latest snapshot).
+         * \return snapshot pointer (nullptr if there is no such snapshot in history).
+         */
+        shared<scene_snapshot> Get(size_t StepsBack = 0) const;
+
+        /*!*
+         * Remove latest snapshots from history (e.g. after rewinding to older one) function.
+         *
+         * \param Count - count of snapshots to remove.
+         * \return None.
+         */
+        void Pop(size_t Count = 1);
+
+        /*!*
+         * Remove all snapshots from history function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Clear();
+    };
+}
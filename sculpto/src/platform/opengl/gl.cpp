@@ -9,6 +9,8 @@
 #include "sclpch.h"
 #include "core/application/application.h"
 #include "core/render/primitives/vertex_array.h"
+#include "core/render/primitives/buffer.h"
+#include "core/render/indirect_draw_list.h"
 #include "gl.h"
 
 #ifdef SCL_PLATFORM_WINDOWS
@@ -104,6 +106,13 @@ bool scl::gl::GetVSync() const
     return IsVSync;
 }
 
+bool scl::gl::GetBindlessTexturesSupport() const
+{
+    // Handles, read by draw material index, differ between draws of one multi draw call (are not dynamically uniform),
+    // sampling by such handles is allowed only with NV_gpu_shader5.
+    return GLEW_ARB_bindless_texture && GLEW_NV_gpu_shader5;
+}
+
 void scl::gl::SetClearColor(const vec4 &ClearColor)
 {
     this->ClearColor = ClearColor;
@@ -213,6 +222,9 @@ void scl::gl::CreateContext(const HWND &hAppWnd, int W, int H, bool VSync)
     glEnable(GL_PRIMITIVE_RESTART);
     glPrimitiveRestartIndex(render_context::MESH_RESTART_INDEX);
 
+    // Let driver use as many shader compiler threads as it wants (shader programs are compiled asynchronously).
+    if (GLEW_KHR_parallel_shader_compile) glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+
     // Enable debug callback
 #ifndef SCL_DIST
     glEnable(GL_DEBUG_OUTPUT);
@@ -276,6 +288,82 @@ void scl::gl::DrawIndicesInstanced(const shared<vertex_array> &VertexArray, int
     VertexArray->Unbind();
 }
 
+void scl::gl::DrawIndicesRanges(const shared<vertex_array> &VertexArray, std::span<const index_range> Ranges)
+{
+    static thread_local std::vector<GLsizei> counts {};
+    static thread_local std::vector<const void *> offsets {};
+    counts.resize(Ranges.size());
+    offsets.resize(Ranges.size());
+    for (size_t i = 0; i < Ranges.size(); i++)
+        counts[i] = (GLsizei)Ranges[i].Count,
+        offsets[i] = (const void *)((size_t)Ranges[i].FirstIndex * sizeof(u32));
+
+    VertexArray->Bind();
+    glMultiDrawElements(
+        GetGLPrimitiveType(VertexArray->GetType()),
+        counts.data(),
+        GL_UNSIGNED_INT,
+        offsets.data(),
+        (GLsizei)Ranges.size()
+    );
+    VertexArray->Unbind();
+}
+
+void scl::gl::DrawIndicesIndirect(const shared<vertex_array> &VertexArray, const shared<storage_buffer> &Commands,
+                                  u32 FirstCommand, u32 CommandsCount)
+{
+    if (CommandsCount == 0) return;
+    SCL_CORE_ASSERT((FirstCommand + CommandsCount) * sizeof(draw_indirect_command) <= Commands->GetSize(),
+                    "Draw commands are out of buffer bounds.");
+
+    VertexArray->Bind();
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, (GLuint)Commands->GetHandle());
+    glMultiDrawElementsIndirect(
+        GetGLPrimitiveType(VertexArray->GetType()),
+        GL_UNSIGNED_INT,
+        (const void *)((size_t)FirstCommand * sizeof(draw_indirect_command)),
+        (GLsizei)CommandsCount,
+        0
+    );
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    VertexArray->Unbind();
+}
+
+void scl::gl::Dispatch(u32 GroupsCountX, u32 GroupsCountY, u32 GroupsCountZ)
+{
+    glDispatchCompute(GroupsCountX, GroupsCountY, GroupsCountZ);
+}
+
+void scl::gl::DispatchIndirect(const shared<storage_buffer> &Arguments, u32 Offset)
+{
+    SCL_CORE_ASSERT(Offset % 4 == 0 && Offset + 3 * sizeof(u32) <= Arguments->GetSize(), "Dispatch arguments are out of buffer bounds.");
+
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, (GLuint)Arguments->GetHandle());
+    glDispatchComputeIndirect((GLintptr)Offset);
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+}
+
+void scl::gl::Barrier(u32 Barriers)
+{
+    if (Barriers == BARRIER_ALL)
+    {
+        glMemoryBarrier(GL_ALL_BARRIER_BITS);
+        return;
+    }
+
+    GLbitfield gl_barriers = 0;
+    if (Barriers & BARRIER_STORAGE_BUFFER)   gl_barriers |= GL_SHADER_STORAGE_BARRIER_BIT;
+    if (Barriers & BARRIER_IMAGE_ACCESS)     gl_barriers |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+    if (Barriers & BARRIER_TEXTURE_FETCH)    gl_barriers |= GL_TEXTURE_FETCH_BARRIER_BIT;
+    if (Barriers & BARRIER_CONSTANT_BUFFER)  gl_barriers |= GL_UNIFORM_BARRIER_BIT;
+    if (Barriers & BARRIER_VERTEX_BUFFER)    gl_barriers |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+    if (Barriers & BARRIER_INDEX_BUFFER)     gl_barriers |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+    if (Barriers & BARRIER_INDIRECT_COMMAND) gl_barriers |= GL_COMMAND_BARRIER_BIT;
+    if (Barriers & BARRIER_FRAME_BUFFER)     gl_barriers |= GL_FRAMEBUFFER_BARRIER_BIT;
+    if (Barriers & BARRIER_BUFFER_UPDATE)    gl_barriers |= GL_BUFFER_UPDATE_BARRIER_BIT;
+    if (gl_barriers != 0) glMemoryBarrier(gl_barriers);
+}
+
 /*!*
  * OpenGl Debug output function.
  *
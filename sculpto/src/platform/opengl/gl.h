@@ -17,6 +17,7 @@ namespace scl
 {
     /*! Classes declaration. */
     class shader_program;
+    class shader_variants;
 
     /*! OpenGL context */
     class gl: public render_context
@@ -31,9 +32,10 @@ namespace scl
 
         static shared<shader_program> single_color_material_shader;
         static shared<shader_program> skybox_material_shader;
-        static shared<shader_program> phong_geometry_shader;
+        static shared<shader_variants> phong_geometry_shader_variants;
         static shared<shader_program> phong_lighting_shader;
         static shared<shader_program> shadow_pass_shader;
+        static shared<shader_program> shadow_pass_indirect_shader;
         static shared<shader_program> tone_mapping_pass_shader;
         static shared<shader_program> gaussian_blur_pass_shader;
         static shared<shader_program> texture_add_pass_shader;
@@ -57,6 +59,8 @@ namespace scl
         bool GetDepthTestMode() const override;
         /*! Render virtual syncronisation flag getter function. */
         bool GetVSync() const override;
+        /*! Bindless textures support flag getter function. */
+        bool GetBindlessTexturesSupport() const override;
 
         /*! Frame clear color setter function. */
         void SetClearColor(const vec4 &ClearColor) override;
@@ -136,6 +140,52 @@ namespace scl
          */
         void DrawIndicesInstanced(const shared<vertex_array> &VertexArray, int InstanceCount) override;
 
+        /*!*
+         * Draw ranges of vertices indices function.
+         *
+         * \param VertexArray - mesh, containing vertices and vertex indices to draw.
+         * \param Ranges - ranges of mesh index buffer indices to draw.
+         * \return None.
+         */
+        void DrawIndicesRanges(const shared<vertex_array> &VertexArray, std::span<const index_range> Ranges) override;
+
+        /*!*
+         * Draw vertices by indirect draw commands, read from buffer, with single call function.
+         *
+         * \param VertexArray - mesh, containing vertices and vertex indices to draw.
+         * \param Commands - buffer, containing draw indirect commands.
+         * \param FirstCommand - first drawn command index in buffer.
+         * \param CommandsCount - drawn commands count.
+         * \return None.
+         */
+        void DrawIndicesIndirect(const shared<vertex_array> &VertexArray, const shared<storage_buffer> &Commands,
+                                 u32 FirstCommand, u32 CommandsCount) override;
+
+        /*!*
+         * Dispatch compute work groups of currently bound compute shader program function.
+         *
+         * \param GroupsCountX, GroupsCountY, GroupsCountZ - work groups count by each dimension.
+         * \return None.
+         */
+        void Dispatch(u32 GroupsCountX, u32 GroupsCountY, u32 GroupsCountZ) override;
+
+        /*!*
+         * Dispatch compute work groups of currently bound compute shader program with groups count, read from buffer, function.
+         *
+         * \param Arguments - buffer, containing three u32 work groups counts.
+         * \param Offset - arguments offset in buffer in bytes.
+         * \return None.
+         */
+        void DispatchIndirect(const shared<storage_buffer> &Arguments, u32 Offset) override;
+
+        /*!*
+         * Wait for shaders memory writes to become visible to specified accesses function.
+         *
+         * \param Barriers - accesses, following writes (BARRIER_* bits).
+         * \return None.
+         */
+        void Barrier(u32 Barriers) override;
+
     public: /*! Sculpto library built-in backend API specific rendering objects getter function. */
         /*! OpenGL specific single color material shader getter function. */
         shared<shader_program> GetSingleColorMaterialShader() const override;
@@ -143,10 +193,14 @@ namespace scl
         shared<shader_program> GetSkyboxMaterialShader() const override;
         /*! OpenGL specific phong lighint model shader for geometry pass getter function. */
         shared<shader_program> GetPhongGeometryShader() const override;
+        /*! OpenGL specific phong lighint model shader for geometry pass variants getter function. */
+        shared<shader_variants> GetPhongGeometryShaderVariants() const override;
         /*! OpenGL specific phong lighint model shader for lighting pass getter function. */
         shared<shader_program> GetPhongLightingShader() const override;
         /*! OpenGL specific shadow pass shader getter function. */
         shared<shader_program> GetShadowPassShader() const override;
+        /*! OpenGL specific shadow pass shader for indirect draws getter function. */
+        shared<shader_program> GetShadowPassIndirectShader() const override;
         /*! OpenGL specific full viewport mesh with tone mapping shader. */
         shared<shader_program> GetToneMappingPassShader() const override;
         /*! OpenGL specific gaussian blur pass shader getter function. */
@@ -73,6 +73,92 @@ void scl::gl_constant_buffer::Free()
     }
 }
 
+scl::gl_storage_buffer::gl_storage_buffer(const void *Data, u32 Size)
+{
+    this->Size = Size;
+
+    glGenBuffers(1, &Id);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, Id);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, Size, Data, GL_DYNAMIC_DRAW);
+    if (Data == nullptr)
+    {
+        u32 zero = 0;
+        glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    }
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    SCL_CORE_SUCCES("OpenGL Storage buffer with id {} and size {} created.", Id, Size);
+}
+
+scl::gl_storage_buffer::~gl_storage_buffer()
+{
+    Free();
+}
+
+void scl::gl_storage_buffer::Bind(u32 BindingPoint) const
+{
+    this->BindingPoint = BindingPoint;
+    this->IsBound = true;
+    if (Id != 0) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BindingPoint, Id);
+}
+
+void scl::gl_storage_buffer::Unbind() const
+{
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BindingPoint, 0);
+    this->BindingPoint = 0;
+    this->IsBound = false;
+}
+
+void scl::gl_storage_buffer::Update(const void *Data, u32 Size)
+{
+    Update(0, Data, Size);
+}
+
+void scl::gl_storage_buffer::Update(u32 Offset, const void *Data, u32 Size)
+{
+    if (Id == 0 || Size == 0) return;
+
+    Reserve(Offset + Size);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, Id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, Offset, Size, Data);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void scl::gl_storage_buffer::Reserve(u32 Size)
+{
+    if (Id == 0 || Size <= this->Size) return;
+
+    // Capacity grows geometrically, so buffer, growing by small steps, is reallocated rarely.
+    u32 new_size = math::Max(Size, this->Size + this->Size / 2);
+    GLuint new_id {};
+    glGenBuffers(1, &new_id);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, new_id);
+    glBufferData(GL_COPY_WRITE_BUFFER, new_size, nullptr, GL_DYNAMIC_DRAW);
+    if (this->Size > 0)
+    {
+        glBindBuffer(GL_COPY_READ_BUFFER, Id);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, this->Size);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glDeleteBuffers(1, &Id);
+
+    SCL_CORE_INFO("OpenGL Storage buffer with id {} grown from {} to {} bytes (new id {}).", Id, this->Size, new_size, new_id);
+    Id = new_id, this->Size = new_size;
+    if (IsBound) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BindingPoint, Id);
+}
+
+void scl::gl_storage_buffer::Free()
+{
+    if (Id != 0)
+    {
+        glDeleteBuffers(1, &Id);
+
+        SCL_CORE_INFO("OpenGL Storage buffer with id {} freed.", Id);
+        Id = 0, BindingPoint = 0, IsBound = false, Size = 0;
+    }
+}
+
 scl::gl_vertex_buffer::gl_vertex_buffer(u32 Count, const vertex_layout &VertexLayout) :
     vertex_buffer(VertexLayout)
 {
@@ -80,7 +166,7 @@ scl::gl_vertex_buffer::gl_vertex_buffer(u32 Count, const vertex_layout &VertexLa
 
     glGenBuffers(1, &Id);
     glBindBuffer(GL_ARRAY_BUFFER, Id);
-    glBufferData(GL_ARRAY_BUFFER, Count, nullptr, GL_DYNAMIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, (u64)Count * VertexLayout.GetSize(), nullptr, GL_DYNAMIC_DRAW);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
     SCL_CORE_SUCCES("OpenGL Vertex buffer with id {} and {} verices created.", Id, Count);
@@ -126,6 +212,17 @@ void scl::gl_vertex_buffer::Update(const void *Vertices, u32 Count)
     }
 }
 
+void scl::gl_vertex_buffer::Update(u32 FirstVertex, const void *Vertices, u32 Count)
+{
+    if (Id != 0 && Count > 0)
+    {
+        SCL_CORE_ASSERT(FirstVertex + Count <= this->VerticesCount, "Updated vertices range exceeds buffer.");
+
+        const u64 stride = VertexLayout.GetSize();
+        glNamedBufferSubData(Id, (GLintptr)(FirstVertex * stride), (GLsizeiptr)(Count * stride), Vertices);
+    }
+}
+
 void scl::gl_vertex_buffer::Free()
 {
     if (Id != 0)
@@ -175,6 +272,17 @@ void scl::gl_index_buffer::Update(u32 *Indices, u32 Count)
     }
 }
 
+void scl::gl_index_buffer::Update(u32 FirstIndex, const u32 *Indices, u32 Count)
+{
+    if (Id != 0 && Count > 0)
+    {
+        SCL_CORE_ASSERT(FirstIndex + Count <= this->IndicesCount, "Updated indices range exceeds buffer.");
+
+        // Buffer is updated without binding, so index buffer of currently bound vertex array is not changed.
+        glNamedBufferSubData(Id, (GLintptr)FirstIndex * sizeof(u32), (GLsizeiptr)Count * sizeof(u32), Indices);
+    }
+}
+
 void scl::gl_index_buffer::Free()
 {
     if (Id != 0)
@@ -79,6 +79,86 @@ namespace scl
         void Free() override;
     };
 
+    /*! Storage (shader storage) buffer class. */
+    class gl_storage_buffer : public storage_buffer
+    {
+    private: /*! Storage buffer data. */
+        mutable u32 BindingPoint {};
+        mutable bool IsBound {};
+        GLuint Id {};
+        u32 Size {};
+
+    public:
+        /*! Backend api render primitive hadnle getter function. */
+        render_primitive::handle GetHandle() const override { return Id; }
+
+        /*! Storage buffer size getter function. */
+        u32 GetSize() const override { return Size; }
+
+        /*!*
+         * Storage buffer filled with data constructor.
+         *
+         * \param Data - buffer data pointer (nullptr to fill buffer with zeros).
+         * \param Size - buffer data size.
+         */
+        gl_storage_buffer(const void *Data, u32 Size);
+
+        /*! Storage buffer default destructor. */
+        ~gl_storage_buffer() override;
+
+        /*!*
+         * Bind buffer to shader storage binding point function.
+         *
+         * \param BindingPoint - shader storage block binding point.
+         * \return None.
+         */
+        void Bind(u32 BindingPoint) const override;
+
+        /*!*
+         * Unbind buffer from shader storage binding point function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Unbind() const override;
+
+        /*!*
+         * Update buffer data from its begining function.
+         *
+         * \param Data - buffer data pointer.
+         * \param Size - buffer data size (buffer grows if it is exceeded).
+         * \return None.
+         */
+        void Update(const void *Data, u32 Size) override;
+
+        /*!*
+         * Update buffer data range function.
+         *
+         * \param Offset - updated range offset in bytes.
+         * \param Data - range data pointer.
+         * \param Size - range data size (buffer grows if it is exceeded).
+         * \return None.
+         */
+        void Update(u32 Offset, const void *Data, u32 Size) override;
+
+        /*!*
+         * Make buffer size at least specified one function.
+         * Buffer is reallocated and its data is copied on GPU side.
+         *
+         * \param Size - required buffer size in bytes.
+         * \return None.
+         */
+        void Reserve(u32 Size) override;
+
+        /*!*
+         * Clear buffer from GPU memory function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void Free() override;
+    };
+
     /*! Vertex bufer interface. */
     class gl_vertex_buffer : public vertex_buffer
     {
@@ -140,6 +220,16 @@ namespace scl
          */
         void Update(const void *Vertices, u32 Count) override;
 
+        /*!*
+         * Update range of buffer vertices function.
+         *
+         * \param FirstVertex - first updated vertex index.
+         * \param Vertices - verices array.
+         * \param Count - length of vertices array (range should not exceed buffer).
+         * \return None.
+         */
+        void Update(u32 FirstVertex, const void *Vertices, u32 Count) override;
+
         /*!*
          * Clear buffer from GPU memory function.
          *
@@ -199,6 +289,16 @@ namespace scl
          */
         void Update(u32 *Indices, u32 Count) override;
 
+        /*!*
+         * Update range of buffer indices function.
+         *
+         * \param FirstIndex - first updated index.
+         * \param Indices - array of indices.
+         * \param Count - length of indices array (range should not exceed buffer).
+         * \return None.
+         */
+        void Update(u32 FirstIndex, const u32 *Indices, u32 Count) override;
+
         /*!*
          * Clear buffer from GPU memory function.
          *
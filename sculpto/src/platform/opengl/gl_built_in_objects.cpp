@@ -11,13 +11,15 @@
 #include "gl.h"
 #include "core/resources/mesh.h"
 #include "core/render/primitives/shader.h"
+#include "core/render/shader_variants.h"
 #include "utilities/assets_manager/shaders_load.h"
 
 scl::shared<scl::shader_program> scl::gl::single_color_material_shader {};
 scl::shared<scl::shader_program> scl::gl::skybox_material_shader {};
-scl::shared<scl::shader_program> scl::gl::phong_geometry_shader {};
+scl::shared<scl::shader_variants> scl::gl::phong_geometry_shader_variants {};
 scl::shared<scl::shader_program> scl::gl::phong_lighting_shader {};
 scl::shared<scl::shader_program> scl::gl::shadow_pass_shader {};
+scl::shared<scl::shader_program> scl::gl::shadow_pass_indirect_shader {};
 scl::shared<scl::shader_program> scl::gl::tone_mapping_pass_shader {};
 scl::shared<scl::shader_program> scl::gl::gaussian_blur_pass_shader {};
 scl::shared<scl::shader_program> scl::gl::texture_add_pass_shader {};
@@ -38,9 +40,18 @@ scl::shared<scl::shader_program> scl::gl::GetSkyboxMaterialShader() const
 
 scl::shared<scl::shader_program> scl::gl::GetPhongGeometryShader() const
 {
-    if (phong_geometry_shader == nullptr)
-        phong_geometry_shader = assets_manager::LoadShader("assets/shaders/lib/phong_geometry_pass.glsl");
-    return phong_geometry_shader;
+    return GetPhongGeometryShaderVariants()->GetVariant(0);
+}
+
+scl::shared<scl::shader_variants> scl::gl::GetPhongGeometryShaderVariants() const
+{
+    // Features names order matches render_context::PHONG_FEATURE_* bits.
+    if (phong_geometry_shader_variants == nullptr)
+        phong_geometry_shader_variants = shader_variants::Create("assets/shaders/lib/phong_geometry_pass.glsl",
+                                                                 { "MATERIAL_DIFFUSE_MAP", "MATERIAL_SPECULAR_MAP",
+                                                                   "MATERIAL_EMISSION_MAP", "MATERIAL_NORMAL_MAP", "INDIRECT_DRAW",
+                                                                   "MATERIAL_STORAGE" });
+    return phong_geometry_shader_variants;
 }
 
 scl::shared<scl::shader_program> scl::gl::GetPhongLightingShader() const
@@ -57,6 +68,13 @@ scl::shared<scl::shader_program> scl::gl::GetShadowPassShader() const
     return shadow_pass_shader;
 }
 
+scl::shared<scl::shader_program> scl::gl::GetShadowPassIndirectShader() const
+{
+    if (shadow_pass_indirect_shader == nullptr)
+        shadow_pass_indirect_shader = assets_manager::LoadShader("assets/shaders/lib/shadow_pass.glsl", { "INDIRECT_DRAW" });
+    return shadow_pass_indirect_shader;
+}
+
 scl::shared<scl::shader_program> scl::gl::GetToneMappingPassShader() const
 {
     if (tone_mapping_pass_shader == nullptr)
@@ -9,6 +9,83 @@
 #include "sclpch.h"
 #include "gl_shader.h"
 
+namespace scl
+{
+    /*! Program binary cache constants. */
+    static constexpr char PROGRAM_BINARY_MAGIC[8] = "SCLPROG";
+    static constexpr u32 PROGRAM_BINARY_VERSION = 2;
+    static const std::filesystem::path PROGRAM_BINARY_CACHE_FOLDER = "cache/shaders";
+
+    /*! Program binary cache file header structure. */
+    struct program_binary_header
+    {
+        char Magic[8];        /*! File format magic string. */
+        u32 Version;          /*! File format version. */
+        u32 BinaryFormat;     /*! OpenGL program binary format. */
+        u64 SourcesHash;      /*! Hash of shaders sources and driver, binary was created for. */
+        u64 BinarySize;       /*! Program binary size in bytes. */
+        u64 BinaryHash;       /*! Program binary hash (to detect corrupted files). */
+    };
+
+    /*! Programs creation statistics (for cold and warm startup comparison). */
+    static u32 CompiledProgramsCount {}, CachedProgramsCount {};
+    static double CompiledProgramsTime {}, CachedProgramsTime {};
+
+    /*!*
+     * Check if program binaries could be retrieved and loaded function.
+     *
+     * \param None.
+     * \return wheather program binaries are supported by driver.
+     */
+    static bool IsProgramBinarySupported()
+    {
+        static const bool is_supported = []()
+        {
+            if (!GLEW_ARB_get_program_binary) return false;
+            GLint formats_count {};
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats_count);
+            return formats_count > 0;
+        }();
+        return is_supported;
+    }
+
+    /*!*
+     * Append data to FNV-1a hash function.
+     *
+     * \param Hash - hash to append data to.
+     * \param Data - data to hash.
+     * \return new hash.
+     */
+    static u64 HashAppend(u64 Hash, std::string_view Data)
+    {
+        for (char c : Data)
+            Hash = (Hash ^ (u8)c) * 1099511628211ull;
+        return Hash;
+    }
+
+    /*!*
+     * Get std140 size of uniform block member function.
+     *
+     * \param Type - uniform OpenGL type.
+     * \param MatrixStride - uniform matrix columns stride (for matrix types only).
+     * \return uniform size in bytes (0 if type is not supported).
+     */
+    static u32 GetUniformTypeSize(GLenum Type, GLint MatrixStride)
+    {
+        switch (Type)
+        {
+        case GL_FLOAT:      case GL_INT:      case GL_UNSIGNED_INT:      case GL_BOOL:      return 4;
+        case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2: return 8;
+        case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3: return 12;
+        case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4: return 16;
+        case GL_FLOAT_MAT2: return (u32)MatrixStride * 2;
+        case GL_FLOAT_MAT3: return (u32)MatrixStride * 3;
+        case GL_FLOAT_MAT4: return (u32)MatrixStride * 4;
+        }
+        return 0;
+    }
+}
+
 int scl::gl_shader_program::CurrentlyBoundShaderId {};
 
 constexpr GLenum scl::gl_shader_program::GetGLShaderType(shader_type Type)
@@ -25,19 +102,22 @@ constexpr GLenum scl::gl_shader_program::GetGLShaderType(shader_type Type)
     return GLenum();
 }
 
-bool scl::gl_shader_program::CompileShader(const shader_props &Shader, GLuint &ShaderId)
+GLuint scl::gl_shader_program::SubmitShader(const shader_props &Shader) const
 {
-    if (ShaderId != 0) glDeleteShader(ShaderId);
-    SCL_CORE_ASSERT((ShaderId = glCreateShader(GetGLShaderType(Shader.Type))) != 0,
+    GLuint shader_id {};
+    SCL_CORE_ASSERT((shader_id = glCreateShader(GetGLShaderType(Shader.Type))) != 0,
                     "Error in creation OpenGL shader primitive.");
 
+    const char *source = Shader.Source.c_str();
+    glShaderSource(shader_id, 1, &source, nullptr);
+    glCompileShader(shader_id);
+    return shader_id;
+}
+
+bool scl::gl_shader_program::CheckShader(GLuint ShaderId) const
+{
     int res {};
-    // Temporary object creation to prevent dangling pointer
-    std::string source_str = Shader.Source;
-    const char *source = source_str.c_str();
     char ErrorLog[1000] {};
-    glShaderSource(ShaderId, 1, &source, nullptr);
-    glCompileShader(ShaderId);
     glGetShaderiv(ShaderId, GL_COMPILE_STATUS, &res);
     if (!res)
     {
@@ -45,57 +125,192 @@ bool scl::gl_shader_program::CompileShader(const shader_props &Shader, GLuint &S
         SCL_CORE_ERROR("Error in compiling shader during shader program \"{}\" creation.\nError log:\n{}", DebugName, std::string(ErrorLog));
         return false;
     }
-
     return true;
 }
 
-bool scl::gl_shader_program::CompileProgram(const std::vector<GLuint> &Shaders)
+void scl::gl_shader_program::SubmitProgram(const std::vector<GLuint> &Shaders)
 {
     SCL_CORE_ASSERT((Id = glCreateProgram()) != 0, "Error in creation OpenGL shader program premitive.");
 
-    int res {};
-    char ErrorLog[1000] {};
     for (GLuint shader_id : Shaders) glAttachShader(Id, shader_id);
+    if (IsProgramBinarySupported()) glProgramParameteri(Id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(Id);
+}
+
+bool scl::gl_shader_program::FinishCreation() const
+{
+    if (State != creation_state::PENDING) return State == creation_state::READY;
+
+    // Link status query waits for compilation, shaders are checked only on failure to show their logs.
+    int res {};
+    char ErrorLog[1000] {};
     glGetProgramiv(Id, GL_LINK_STATUS, &res);
     if (!res)
     {
-        glGetProgramInfoLog(Id, sizeof(ErrorLog), &res, ErrorLog);
-        SCL_CORE_ERROR("Error in linking shader program \"{}\".\nError log:\n{}", DebugName, std::string(ErrorLog));
+        bool is_shaders_compiled = true;
+        for (GLuint shader_id : PendingShaders)
+            is_shaders_compiled &= CheckShader(shader_id);
+        if (is_shaders_compiled)
+        {
+            glGetProgramInfoLog(Id, sizeof(ErrorLog), &res, ErrorLog);
+            SCL_CORE_ERROR("Error in linking shader program \"{}\".\nError log:\n{}", DebugName, std::string(ErrorLog));
+        }
+    }
+    State = res ? creation_state::READY : creation_state::FAILED;
+
+    // Linked program does not need its shaders anymore.
+    for (GLuint shader_id : PendingShaders)
+    {
+        glDetachShader(Id, shader_id);
+        glDeleteShader(shader_id);
+    }
+    PendingShaders.clear();
+    if (State == creation_state::FAILED) return false;
+
+    SaveProgramBinary(PendingSourcesHash);
+
+    double time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CreationStartTime).count();
+    CompiledProgramsCount++, CompiledProgramsTime += time;
+    SCL_CORE_SUCCES("OpenGL Shader with id {} compiled in {:.2f} ms (compiled programs: {}, {:.2f} ms total).",
+                    Id, time, CompiledProgramsCount, CompiledProgramsTime);
+    return true;
+}
+
+scl::u64 scl::gl_shader_program::GetSourcesHash(const std::vector<shader_props> &Shaders)
+{
+    // Binary is valid only for driver it was created with, so driver strings are hashed too.
+    u64 hash = 14695981039346656037ull;
+    for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+    {
+        const char *value = (const char *)glGetString(name);
+        hash = HashAppend(hash, value != nullptr ? value : "");
+    }
+    for (const shader_props &shader : Shaders)
+    {
+        hash = HashAppend(hash, std::string_view((const char *)&shader.Type, sizeof(shader.Type)));
+        hash = HashAppend(hash, shader.Source);
+    }
+    return hash;
+}
+
+std::filesystem::path scl::gl_shader_program::GetProgramBinaryPath() const
+{
+    std::string file_name = std::format("{:016x}.sclprog", HashAppend(14695981039346656037ull, DebugName));
+    return PROGRAM_BINARY_CACHE_FOLDER / file_name;
+}
+
+bool scl::gl_shader_program::LoadProgramBinary(u64 SourcesHash)
+{
+    if (!IsProgramBinarySupported()) return false;
+
+    std::filesystem::path file_path = GetProgramBinaryPath();
+    std::error_code error {};
+    u64 file_size = (u64)std::filesystem::file_size(file_path, error);
+    if (error) return false;
+
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    program_binary_header header {};
+    file.read((char *)&header, sizeof(header));
+    if (!file.good() || memcmp(header.Magic, PROGRAM_BINARY_MAGIC, sizeof(header.Magic)) != 0 ||
+        header.Version != PROGRAM_BINARY_VERSION || header.SourcesHash != SourcesHash)
+        return false;
+
+    // Binary size is checked before allocation, so truncated or corrupted file could not request huge buffer.
+    auto discard_file = [&]()
+    {
+        SCL_CORE_WARN("Cached binary of shader program \"{}\" is corrupted, it will be discarded.", DebugName);
+        file.close();
+        std::filesystem::remove(file_path, error);
+        return false;
+    };
+    if (header.BinarySize == 0 || header.BinarySize != file_size - sizeof(header) || header.BinarySize > INT32_MAX)
+        return discard_file();
+
+    std::vector<char> binary(header.BinarySize);
+    file.read(binary.data(), binary.size());
+    if (!file.good() || HashAppend(14695981039346656037ull, std::string_view(binary.data(), binary.size())) != header.BinaryHash)
+        return discard_file();
+
+    // Driver could reject binary (e.g. after update without version string change), so program is checked to be linked.
+    int res {};
+    SCL_CORE_ASSERT((Id = glCreateProgram()) != 0, "Error in creation OpenGL shader program premitive.");
+    glProgramBinary(Id, header.BinaryFormat, binary.data(), (GLsizei)binary.size());
+    glGetProgramiv(Id, GL_LINK_STATUS, &res);
+    if (!res)
+    {
+        SCL_CORE_INFO("Cached binary of shader program \"{}\" was rejected by driver, program will be recompiled.", DebugName);
+        glDeleteProgram(Id), Id = 0;
         return false;
     }
     return true;
 }
 
-bool scl::gl_shader_program::Create(const std::vector<shader_props> &Shaders)
+void scl::gl_shader_program::SaveProgramBinary(u64 SourcesHash) const
 {
-    u32 shaders_count = (u32)Shaders.size();
+    if (!IsProgramBinarySupported() || Id == 0) return;
 
-    // Compile all passed shaders
-    std::vector<GLuint> shaders_ids(shaders_count);
-    for (u32 i = 0; i < shaders_count; i++)
-        if (!CompileShader(Shaders[i], shaders_ids[i])) {
-            // Delete all created shaders
-            for (auto shader_id : shaders_ids)
-                if (shader_id != 0) glDeleteShader(shader_id);
-            return false;
-        }
+    GLint binary_size {};
+    glGetProgramiv(Id, GL_PROGRAM_BINARY_LENGTH, &binary_size);
+    if (binary_size <= 0) return;
 
-    // Compile shader program
-    if (!CompileProgram(shaders_ids))
+    program_binary_header header {};
+    std::vector<char> binary(binary_size);
+    GLenum binary_format {};
+    glGetProgramBinary(Id, binary_size, &binary_size, &binary_format, binary.data());
+    memcpy(header.Magic, PROGRAM_BINARY_MAGIC, sizeof(header.Magic));
+    header.Version = PROGRAM_BINARY_VERSION;
+    header.BinaryFormat = (u32)binary_format;
+    header.SourcesHash = SourcesHash;
+    header.BinarySize = (u64)binary_size;
+    header.BinaryHash = HashAppend(14695981039346656037ull, std::string_view(binary.data(), (size_t)binary_size));
+
+    // File is written under temporary name and renamed after, so partially written file is never read.
+    std::error_code error {};
+    std::filesystem::create_directories(PROGRAM_BINARY_CACHE_FOLDER, error);
+    std::filesystem::path file_path = GetProgramBinaryPath();
+    std::filesystem::path temporary_file_path = file_path;
+    temporary_file_path += ".tmp";
     {
-        // Deatach and delete all created shaders
-        for (auto shader_id : shaders_ids) {
-            if (shader_id != 0) {
-                if (Id != 0) glDetachShader(Id, shader_id);
-                glDeleteShader(shader_id);
-            }
+        std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        file.write((const char *)&header, sizeof(header));
+        file.write(binary.data(), header.BinarySize);
+        if (!file.good())
+        {
+            SCL_CORE_WARN("Binary of shader program \"{}\" could not be cached to file \"{}\".", DebugName, file_path.string());
+            file.close();
+            std::filesystem::remove(temporary_file_path, error);
+            return;
         }
-        if (Id != 0) glDeleteProgram(Id), Id = 0;
-        return false;
     }
+    std::filesystem::rename(temporary_file_path, file_path, error);
+    if (error) std::filesystem::remove(temporary_file_path, error);
+}
 
-    SCL_CORE_SUCCES("OpenGL Shader with id {} created.", Id);
+bool scl::gl_shader_program::Create(const std::vector<shader_props> &Shaders)
+{
+    CreationStartTime = std::chrono::high_resolution_clock::now();
+    PendingSourcesHash = GetSourcesHash(Shaders);
+    if (LoadProgramBinary(PendingSourcesHash))
+    {
+        double time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CreationStartTime).count();
+        CachedProgramsCount++, CachedProgramsTime += time;
+        SCL_CORE_SUCCES("OpenGL Shader with id {} created from cached binary in {:.2f} ms (cached programs: {}, {:.2f} ms total).",
+                        Id, time, CachedProgramsCount, CachedProgramsTime);
+        State = creation_state::READY;
+        return true;
+    }
+
+    // All stages compilation and program linking are submitted before any status query,
+    // so driver compiles them (and other submitted programs) concurrently.
+    PendingShaders.clear();
+    for (const shader_props &shader : Shaders)
+        PendingShaders.push_back(SubmitShader(shader));
+    SubmitProgram(PendingShaders);
+    State = creation_state::PENDING;
+
+    if (!GLEW_KHR_parallel_shader_compile) return FinishCreation();
     return true;
 }
 
@@ -137,9 +352,69 @@ scl::gl_shader_program::~gl_shader_program()
     Free();
 }
 
+bool scl::gl_shader_program::IsReady() const
+{
+    SwapUpdatedProgram();
+    if (State == creation_state::PENDING && GLEW_KHR_parallel_shader_compile)
+    {
+        int is_completed {};
+        glGetProgramiv(Id, GL_COMPLETION_STATUS_KHR, &is_completed);
+        if (!is_completed) return false;
+    }
+    return FinishCreation();
+}
+
+bool scl::gl_shader_program::GetUniformBlockLayout(const std::string &BlockName, uniform_block_layout &OutLayout) const
+{
+    SwapUpdatedProgram();
+    if (!FinishCreation()) return false;
+
+    GLuint block_index = glGetUniformBlockIndex(Id, BlockName.c_str());
+    if (block_index == GL_INVALID_INDEX) return false;
+
+    GLint block_size {}, uniforms_count {};
+    glGetActiveUniformBlockiv(Id, block_index, GL_UNIFORM_BLOCK_DATA_SIZE, &block_size);
+    glGetActiveUniformBlockiv(Id, block_index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &uniforms_count);
+    OutLayout = uniform_block_layout((u32)block_size);
+    if (uniforms_count == 0) return true;
+
+    std::vector<GLint> indices(uniforms_count);
+    glGetActiveUniformBlockiv(Id, block_index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices.data());
+    std::vector<GLuint> uniform_indices(indices.begin(), indices.end());
+    std::vector<GLint> offsets(uniforms_count), types(uniforms_count), sizes(uniforms_count), array_strides(uniforms_count), matrix_strides(uniforms_count);
+    glGetActiveUniformsiv(Id, uniforms_count, uniform_indices.data(), GL_UNIFORM_OFFSET, offsets.data());
+    glGetActiveUniformsiv(Id, uniforms_count, uniform_indices.data(), GL_UNIFORM_TYPE, types.data());
+    glGetActiveUniformsiv(Id, uniforms_count, uniform_indices.data(), GL_UNIFORM_SIZE, sizes.data());
+    glGetActiveUniformsiv(Id, uniforms_count, uniform_indices.data(), GL_UNIFORM_ARRAY_STRIDE, array_strides.data());
+    glGetActiveUniformsiv(Id, uniforms_count, uniform_indices.data(), GL_UNIFORM_MATRIX_STRIDE, matrix_strides.data());
+
+    GLint max_name_length {};
+    glGetProgramiv(Id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+    std::vector<char> name_buffer(math::Max(max_name_length, 1));
+    for (GLint i = 0; i < uniforms_count; i++)
+    {
+        GLsizei name_length {};
+        glGetActiveUniformName(Id, uniform_indices[i], (GLsizei)name_buffer.size(), &name_length, name_buffer.data());
+        std::string name(name_buffer.data(), name_length);
+        u32 size = GetUniformTypeSize(types[i], matrix_strides[i]);
+        if (sizes[i] == 1)
+        {
+            OutLayout.AddElement({ name, (u32)offsets[i], size });
+            continue;
+        }
+
+        // Arrays of basic types are reported as single uniform named by its first element.
+        if (name.ends_with("[0]")) name.resize(name.size() - 3);
+        for (GLint j = 0; j < sizes[i]; j++)
+            OutLayout.AddElement({ std::format("{}[{}]", name, j), (u32)(offsets[i] + j * array_strides[i]), size });
+    }
+    return true;
+}
+
 void scl::gl_shader_program::Bind() const
 {
-    if (glIsProgram(Id))
+    SwapUpdatedProgram();
+    if (FinishCreation() && glIsProgram(Id))
     {
         glUseProgram(Id);
         gl_shader_program::CurrentlyBoundShaderId = Id;
@@ -152,17 +427,50 @@ void scl::gl_shader_program::Unbind() const
     CurrentlyBoundShaderId = 0;
 }
 
-void scl::gl_shader_program::Update(const std::vector<shader_props> &Shaders)
+void scl::gl_shader_program::SwapUpdatedProgram() const
 {
-    Free();
-    Create(Shaders);
+    if (UpdatedProgram == nullptr) return;
+    if (!UpdatedProgram->IsReady())
+    {
+        if (UpdatedProgram->State == creation_state::PENDING) return;
+        SCL_CORE_WARN("OpenGL Shader \"{}\" update failed, previous version is kept.", DebugName);
+        UpdatedProgram.reset();
+        return;
+    }
+
+    // Previous program creation data (even if it is still compiling) is moved to updated program object and freed with it.
+    GLuint previous_id = Id;
+    std::swap(Id, UpdatedProgram->Id);
+    std::swap(State, UpdatedProgram->State);
+    std::swap(PendingShaders, UpdatedProgram->PendingShaders);
+    std::swap(PendingSourcesHash, UpdatedProgram->PendingSourcesHash);
+    std::swap(CreationStartTime, UpdatedProgram->CreationStartTime);
+
+    // Object stays same, so its users keep it, but cached locations are requeried for new program.
+    for (auto &[name, location] : VariablesLocations)
+        location = glGetUniformLocation(Id, name.c_str());
+    ShaderNotBindedErrorAlreadyShown = false;
+    if (CurrentlyBoundShaderId == (int)previous_id)
+        glUseProgram(Id), CurrentlyBoundShaderId = Id;
+    UpdatedProgram.reset();
     SCL_CORE_INFO("OpenGL Shader with id {} updated.", Id);
 }
 
+void scl::gl_shader_program::Update(const std::vector<shader_props> &Shaders)
+{
+    // Compilation of new program is only submitted (if parallel compilation is supported), previous version is used until it is ready.
+    // Update, requested while previous one is still compiling, replaces it.
+    UpdatedProgram = CreateUnique<gl_shader_program>(Shaders, DebugName);
+    SwapUpdatedProgram();
+}
+
 void scl::gl_shader_program::Free()
 {
+    UpdatedProgram.reset();
     VariablesLocations.clear();
     ShaderNotBindedErrorAlreadyShown = false;
+    PendingShaders.clear();
+    State = creation_state::FAILED;
 
     if (Id == 0) return;
 
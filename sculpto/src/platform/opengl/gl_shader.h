@@ -17,7 +17,21 @@ namespace scl
     class gl_shader_program : public shader_program
     {
     private: /*! Shader program data. */
-        GLuint Id {};
+        /*! Shader program creation state enum. */
+        enum class creation_state
+        {
+            READY,   /*! Program is linked successfully. */
+            PENDING, /*! Program shaders compilation and linking are submitted but not checked yet. */
+            FAILED,  /*! Program compilation or linking failed. */
+        };
+
+        /*! Creation data is mutable, because updated program replaces it on readiness check or binding. */
+        mutable GLuint Id {};
+        mutable creation_state State { creation_state::FAILED };
+        mutable std::vector<GLuint> PendingShaders {};
+        mutable u64 PendingSourcesHash {};
+        mutable std::chrono::high_resolution_clock::time_point CreationStartTime {};
+        mutable unique<gl_shader_program> UpdatedProgram {};
         mutable std::unordered_map<std::string, int> VariablesLocations {};
         mutable bool ShaderNotBindedErrorAlreadyShown {};
         static int CurrentlyBoundShaderId;
@@ -32,24 +46,85 @@ namespace scl
         constexpr static GLenum GetGLShaderType(shader_type Type);
 
         /*!*
-         * Compile shader_props from source code function.
+         * Submit shader compilation from source code function.
+         * Compilation status is not queried, so driver could compile shaders in parallel.
          * 
-         * \param Source - shader_props source
-         * \param ShaderId shader_props OpenGL id.
+         * \param Shader - shader properties (type and source).
+         * \return shader OpenGL id.
+         */
+        GLuint SubmitShader(const shader_props &Shader) const;
+
+        /*!*
+         * Check shader compilation status (and log compilation errors) function.
+         *
+         * \param ShaderId - shader OpenGL id.
          * \return success flag.
          */
-        bool CompileShader(const shader_props &Shader, GLuint &ShaderId);
+        bool CheckShader(GLuint ShaderId) const;
 
         /*!*
-         * Compile all shaders and create shader_props program function.
+         * Create shader program and submit its linking function.
+         * Link status is not queried, so driver could link program in parallel.
          * 
          * \param Shaders - array of shaders id's to attach to shader_props program.
+         * \return None.
+         */
+        void SubmitProgram(const std::vector<GLuint> &Shaders);
+
+        /*!*
+         * Check submitted shader program compilation and linking status, release its shaders and cache its binary function.
+         * Waits for compilation if it is not finished.
+         *
+         * \param None.
          * \return success flag.
          */
-        bool CompileProgram(const std::vector<GLuint> &Shaders);
+        bool FinishCreation() const;
+
+        /*!*
+         * Replace program by updated one if its creation is finished function.
+         * Updated program creation status is polled without waiting if KHR_parallel_shader_compile is supported.
+         *
+         * \param None.
+         * \return None.
+         */
+        void SwapUpdatedProgram() const;
+
+        /*!*
+         * Get hash of shaders sources and current driver (vendor, renderer, version) function.
+         *
+         * \param Shaders - shaders array.
+         * \return sources hash.
+         */
+        static u64 GetSourcesHash(const std::vector<shader_props> &Shaders);
+
+        /*!*
+         * Get program binary cache file path function.
+         *
+         * \param None.
+         * \return cache file path (one file per shader program debug name).
+         */
+        std::filesystem::path GetProgramBinaryPath() const;
+
+        /*!*
+         * Create shader program from cached program binary function.
+         *
+         * \param SourcesHash - hash of shaders sources and driver, binary should be created for.
+         * \return success flag (false if there is no valid cached binary).
+         */
+        bool LoadProgramBinary(u64 SourcesHash);
+
+        /*!*
+         * Write linked shader program binary to cache function.
+         *
+         * \param SourcesHash - hash of shaders sources and driver, program was created from.
+         * \return None.
+         */
+        void SaveProgramBinary(u64 SourcesHash) const;
 
         /*!*
          * Create shader_props program from shaders data arary, stored in base shader_props class.
+         * Linked program binary is cached to disk, so next creation from same sources with same driver skips compilation.
+         * If KHR_parallel_shader_compile is supported, compilation is only submitted and finished on first readiness check or binding.
          * 
          * \param Shaders - shaders array.
          * \return success flag.
@@ -76,6 +151,25 @@ namespace scl
         /*! Backend api render primitive hadnle getter function. */
         render_primitive::handle GetHandle() const override { return Id; }
 
+        /*!*
+         * Check if shader program compilation is finished function.
+         * Compilation completion is polled without waiting if KHR_parallel_shader_compile is supported.
+         *
+         * \param None.
+         * \return wheather program is compiled and linked successfully.
+         */
+        bool IsReady() const override;
+
+        /*!*
+         * Get uniform block memory layout, used by linked shader program, function.
+         * Layout is reflected with active uniform block queries, arrays of basic types are expanded to elements.
+         *
+         * \param BlockName - uniform block name.
+         * \param OutLayout[out] - uniform block layout.
+         * \return wheather program has active uniform block with specified name.
+         */
+        bool GetUniformBlockLayout(const std::string &BlockName, uniform_block_layout &OutLayout) const override;
+
         /*!*
          * Shader program default constructor.
          *
@@ -144,8 +238,12 @@ namespace scl
         void Unbind() const override;
 
         /*!*
-         * Update (recompile from dource file).
+         * Update (recompile from dource file) function.
+         * New program is created aside and replaces previous one, when it is ready (on readiness check or binding),
+         * so previous program is used while new one is compiling and kept if new one could not be compiled.
          *
+         * \param Shaders - new shaders array.
+         * \return None.
          */
         void Update(const std::vector<shader_props> &Shaders) override;
 
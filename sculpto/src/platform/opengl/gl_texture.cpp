@@ -9,6 +9,43 @@
 #include "sclpch.h"
 #include "gl_texture.h"
 
+namespace scl
+{
+    /*! Maximal anisotropic filtering degree of mip mapped textures. */
+    static constexpr float TEXTURE_MAX_ANISOTROPY = 16;
+
+    /*!*
+     * Get count of mip levels in full mip chain of texture function.
+     *
+     * \param Width - texture width.
+     * \param Height - texture height.
+     * \return mip levels count.
+     */
+    static int GetMipLevelsCount(int Width, int Height)
+    {
+        int levels_count = 1;
+        for (int size = math::Max(Width, Height); size > 1; size /= 2)
+            levels_count++;
+        return levels_count;
+    }
+}
+
+void scl::gl_texture_2d::ConfigureSampling(int LevelsCount)
+{
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, LevelsCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, LevelsCount - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    if (LevelsCount > 1 && (GLEW_ARB_texture_filter_anisotropic || GLEW_EXT_texture_filter_anisotropic))
+    {
+        float max_anisotropy = 1;
+        glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &max_anisotropy);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, math::Min(max_anisotropy, TEXTURE_MAX_ANISOTROPY));
+    }
+}
+
 void scl::gl_texture_2d::CreateColor(const image &Image, bool IsFloatingPoint)
 {
     // Generate texture primitive
@@ -24,17 +61,60 @@ void scl::gl_texture_2d::CreateColor(const image &Image, bool IsFloatingPoint)
         (c == 3 ? GL_RGB8   : c == 4 ? GL_RGBA8   : GL_R8  );
     GLenum format = c == 3 ? GL_RGB : c == 4 ? GL_RGBA : GL_RED;
     GLenum type = IsFloatingPoint ? GL_FLOAT : GL_UNSIGNED_BYTE;
-    glTexStorage2D(GL_TEXTURE_2D, 1, internal_format, w, h);
+    InternalFormat = internal_format;
+
+    // Storage for all mip levels should be allocated before generating them.
+    // Textures without pixels are render targets, which are never minified.
+    int levels_count = Image.GetRawData() != nullptr ? GetMipLevelsCount(w, h) : 1;
+    glTexStorage2D(GL_TEXTURE_2D, levels_count, internal_format, w, h);
     if (Image.GetRawData() != nullptr)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
         glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, format, type, Image.GetRawData());
-    glGenerateMipmap(GL_TEXTURE_2D);
-    
-    // Configure texture sampling.
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+    if (levels_count > 1)
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+    ConfigureSampling(levels_count);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void scl::gl_texture_2d::CreateLevels(const texture_data &Data)
+{
+    SCL_CORE_ASSERT(!Data.Levels.empty(), "Texture could not be created without mip levels.");
+
+    glGenTextures(1, &Id);
+    SCL_CORE_ASSERT(Id != 0, "Error in creation OpenGL texture primitive.");
+    glBindTexture(GL_TEXTURE_2D, Id);
+
+    int c = Data.ComponentsCount;
+    GLenum internal_format {};
+    switch (Data.Compression)
+    {
+    case scl::texture_compression::NONE: internal_format = c == 3 ? GL_RGB8 : c == 4 ? GL_RGBA8 : c == 2 ? GL_RG8 : GL_R8; break;
+    case scl::texture_compression::BC1:  internal_format = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;  break;
+    case scl::texture_compression::BC3:  internal_format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+    case scl::texture_compression::BC5:  internal_format = GL_COMPRESSED_RG_RGTC2;           break;
+    }
+    GLenum format = c == 3 ? GL_RGB : c == 4 ? GL_RGBA : c == 2 ? GL_RG : GL_RED;
+    InternalFormat = internal_format;
+
+    int levels_count = (int)Data.Levels.size();
+    glTexStorage2D(GL_TEXTURE_2D, levels_count, internal_format, Data.Levels[0].Width, Data.Levels[0].Height);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int i = 0; i < levels_count; i++)
+    {
+        const texture_level &level = Data.Levels[i];
+        if (Data.Compression == texture_compression::NONE)
+            glTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, level.Width, level.Height, format, GL_UNSIGNED_BYTE, level.Data.data());
+        else
+            glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, level.Width, level.Height, internal_format,
+                                      (GLsizei)level.Data.size(), level.Data.data());
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
+    ConfigureSampling(levels_count);
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
@@ -42,6 +122,7 @@ void scl::gl_texture_2d::CreateDepth(const image &Image)
 {
     glCreateTextures(GL_TEXTURE_2D, 1, &Id);
     glBindTexture(GL_TEXTURE_2D, Id);
+    InternalFormat = GL_DEPTH_COMPONENT;
     glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, Image.GetWidth(), Image.GetHeight(),
                  0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
 
@@ -68,6 +149,15 @@ scl::gl_texture_2d::gl_texture_2d(const image &Image, texture_type Type)
     SCL_CORE_ASSERT(0, "Unknown texture type.");
 }
 
+scl::gl_texture_2d::gl_texture_2d(const texture_data &Data)
+{
+    this->Width = Data.Levels.empty() ? 0 : Data.Levels[0].Width;
+    this->Height = Data.Levels.empty() ? 0 : Data.Levels[0].Height;
+
+    this->CreateLevels(Data);
+    SCL_CORE_SUCCES("OpenGL Color Texture with id {} and {} mip levels created.", Id, Data.Levels.size());
+}
+
 scl::gl_texture_2d::~gl_texture_2d()
 {
     Free();
@@ -88,14 +178,59 @@ void scl::gl_texture_2d::Unbind() const
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void scl::gl_texture_2d::BindImage(u32 Unit, texture_image_access Access, int Level) const
+{
+    if (Id == 0) return;
+
+    switch (InternalFormat)
+    {
+    case GL_R8: case GL_RG8: case GL_RGBA8: case GL_R16F: case GL_RGBA16F: break;
+    default:
+        SCL_CORE_WARN("OpenGL Texture with id {} has format, unsupported by image load/store, and could not be bound as image.", Id);
+        return;
+    }
+
+    GLenum access = Access == texture_image_access::READ  ? GL_READ_ONLY  :
+                    Access == texture_image_access::WRITE ? GL_WRITE_ONLY : GL_READ_WRITE;
+    glBindImageTexture(Unit, Id, Level, GL_FALSE, 0, access, InternalFormat);
+}
+
+scl::u64 scl::gl_texture_2d::GetBindlessHandle() const
+{
+    if (Id == 0 || !GLEW_ARB_bindless_texture) return 0;
+
+    // Handle stays resident until texture is freed (or recreated by update).
+    if (BindlessHandle == 0)
+    {
+        BindlessHandle = glGetTextureHandleARB(Id);
+        glMakeTextureHandleResidentARB(BindlessHandle);
+    }
+    return BindlessHandle;
+}
+
 void scl::gl_texture_2d::Free()
 {
     if (Id == 0) return;
 
+    if (BindlessHandle != 0)
+    {
+        glMakeTextureHandleNonResidentARB(BindlessHandle);
+        BindlessHandle = 0;
+    }
     glDeleteTextures(1, &Id);
     Id = 0;
 }
 
+void scl::gl_texture_2d::Update(const texture_data &Data)
+{
+    Free();
+    this->Width = Data.Levels.empty() ? 0 : Data.Levels[0].Width;
+    this->Height = Data.Levels.empty() ? 0 : Data.Levels[0].Height;
+
+    this->CreateLevels(Data);
+    SCL_CORE_INFO("OpenGL Color Texture with id {} and {} mip levels updated.", Id, Data.Levels.size());
+}
+
 scl::image scl::gl_texture_2d::GetImage()
 {
     // TODO: Load image raw data from GPU and create image container from it.
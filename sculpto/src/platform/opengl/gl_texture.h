@@ -19,10 +19,14 @@ namespace scl
     private: /*! OpenGL texture data. */
         mutable u32 Slot {};
         GLuint Id {};
+        GLenum InternalFormat {};
+        mutable GLuint64 BindlessHandle {};
 
     public: /*! OpenGL texture getter/setter functions. */
         /*! Backend api render primitive hadnle getter function. */
         render_primitive::handle GetHandle() const override { return Id; }
+        /*! Texture bindless handle getter function. */
+        u64 GetBindlessHandle() const override;
 
     private:
         /*!*
@@ -34,6 +38,23 @@ namespace scl
          */
         void CreateColor(const image &Image, bool IsFloatingPoint);
 
+        /*!*
+         * Create OpenGL color texture from prepared mip levels function.
+         *
+         * \param Data - texture mip levels data.
+         * \return None.
+         */
+        void CreateLevels(const texture_data &Data);
+
+        /*!*
+         * Configure currently bound color texture sampling function.
+         * Mip mapped textures are sampled with trilinear and (if supported) anisotropic filtering.
+         *
+         * \param LevelsCount - count of texture mip levels.
+         * \return None.
+         */
+        static void ConfigureSampling(int LevelsCount);
+
         /*!*
          * Create OpenGL depth texture function.
          * 
@@ -52,6 +73,13 @@ namespace scl
          */
         gl_texture_2d(const image &Image, texture_type Type);
 
+        /*!*
+         * OpenGL color texture constructor by prepared mip levels.
+         *
+         * \param Data - texture mip levels data (could be block compressed).
+         */
+        gl_texture_2d(const texture_data &Data);
+
         /*! Texture default destructor. */
         ~gl_texture_2d() override;
 
@@ -71,6 +99,16 @@ namespace scl
          */
         void Unbind() const override;
 
+        /*!*
+         * Bind texture mip level as image for shaders load/store operations function.
+         *
+         * \param Unit - image unit to bind texture to.
+         * \param Access - shaders access type.
+         * \param Level - bound mip level.
+         * \return None.
+         */
+        void BindImage(u32 Unit, texture_image_access Access, int Level = 0) const override;
+
         /*!*
          * Unload texture from GPU memory function.
          *
@@ -86,5 +124,13 @@ namespace scl
          * \return texture image.
          */
         image GetImage() override;
+
+        /*!*
+         * Replace texture content with new mip levels function.
+         *
+         * \param Data - new texture mip levels data (could be block compressed).
+         * \return None.
+         */
+        void Update(const texture_data &Data) override;
     };
 }
@@ -25,17 +25,25 @@
 #include <format>
 #include <mutex>
 #include <future>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstring>
 #include <typeinfo>
+#include <typeindex>
 #include <stdio.h>
 
 #include <string>
 #include <vector>
+#include <array>
 #include <map>
 #include <unordered_map>
 #include <set>
 #include <queue>
+#include <optional>
+#include <tuple>
+#include <span>
 
 /*! Detect SCL platform. */
 #include "core/application/platform_detection.h"
@@ -41,6 +41,9 @@
 #include "core/resources/topology/cone.h"
 #include "core/resources/topology/points.h"
 #include "core/resources/topology/full_screen_quad.h"
+#include "core/resources/topology/mesh_optimizer.h"
+#include "core/resources/topology/mesh_simplifier.h"
+#include "core/resources/topology/meshlets.h"
 #include "core/resources/materials/material.h"
 #include "core/resources/materials/material_phong.h"
 #include "core/resources/materials/material_single_color.h"
@@ -49,11 +52,19 @@
 #include "core/resources/skybox.h"
 
 #include "core/render/render_bridge.h"
+#include "core/render/shader_variants.h"
+#include "core/render/geometry_arena.h"
+#include "core/render/indirect_draw_list.h"
 #include "core/render/renderer.h"
 
 /*! Scene module */
 #include "core/scene/scene.h"
 #include "core/scene/scene_serializer.h"
+#include "core/scene/scene_loader.h"
+#include "core/scene/scene_bvh.h"
+#include "core/scene/scene_name_index.h"
+#include "core/scene/scene_snapshot.h"
+#include "core/scene/prefab.h"
 #include "core/scene/scene_object.h"
 #include "core/scene/scene_object_behaviour.h"
 #include "core/components/components.h"
@@ -63,3 +74,13 @@
 #include "utilities/assets_manager/shaders_load.h"
 #include "utilities/assets_manager/textures_load.h"
 #include "utilities/assets_manager/meshes_load.h"
+#include "utilities/assets_manager/async_load.h"
+#include "utilities/assets_manager/asset_registry.h"
+#include "utilities/assets_manager/mapped_file.h"
+#include "utilities/assets_manager/meshes_cook.h"
+#include "utilities/assets_manager/textures_cook.h"
+#include "utilities/assets_manager/file_watcher.h"
+#include "utilities/assets_manager/hot_reload.h"
+#include "utilities/image/image_mips.h"
+#include "utilities/image/image_compress.h"
+#include "utilities/thread_pool/thread_pool.h"
@@ -0,0 +1,92 @@
+/*!****************************************************************//*!*
+ * \file   asset_registry.cpp
+ * \brief  Assets manager loaded assets registry (cache) class implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "asset_registry.h"
+
+scl::u64 scl::assets_manager::asset_registry::GetContentHashLocked(const std::filesystem::path &FilePath)
+{
+    std::error_code error {};
+    std::filesystem::path canonical_path = std::filesystem::weakly_canonical(FilePath, error);
+    std::filesystem::file_time_type write_time = std::filesystem::last_write_time(canonical_path, error);
+    if (error) return 0;
+
+    file_entry &entry = Files[canonical_path.string()];
+    if (entry.ContentHash != 0 && entry.WriteTime == write_time) return entry.ContentHash;
+
+    // FNV-1a hash of whole file content.
+    std::ifstream file(canonical_path, std::ios::binary);
+    u64 hash = 14695981039346656037ull;
+    char buffer[64 * 1024];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+        for (std::streamsize i = 0; i < file.gcount(); i++)
+            hash = (hash ^ (u8)buffer[i]) * 1099511628211ull;
+
+    entry.ContentHash = hash != 0 ? hash : 1;
+    entry.WriteTime = write_time;
+    return entry.ContentHash;
+}
+
+scl::u64 scl::assets_manager::asset_registry::GetContentHash(const std::filesystem::path &FilePath)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    return GetContentHashLocked(FilePath);
+}
+
+scl::shared<void> scl::assets_manager::asset_registry::FindAsset(std::type_index Type, const std::filesystem::path &FilePath, u64 Variant, bool IsCounted)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    u64 hash = GetContentHashLocked(FilePath);
+    auto entry = Assets.find({ Type, hash, Variant });
+    shared<void> asset = hash != 0 && entry != Assets.end() ? entry->second.Asset.lock() : nullptr;
+
+    if (IsCounted)
+    {
+        if (asset != nullptr) Stats[Type].Hits++;
+        else                  Stats[Type].Misses++;
+    }
+    return asset;
+}
+
+void scl::assets_manager::asset_registry::AddAsset(std::type_index Type, const std::filesystem::path &FilePath, const shared<void> &Asset, size_t Bytes, u64 Variant)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    u64 hash = GetContentHashLocked(FilePath);
+    if (hash == 0 || Asset == nullptr) return;
+    Assets[{ Type, hash, Variant }] = asset_entry { Asset, Bytes };
+}
+
+scl::assets_manager::asset_registry::stats scl::assets_manager::asset_registry::GetStats(std::type_index Type) const
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    auto type_stats = Stats.find(Type);
+    stats result = type_stats != Stats.end() ? type_stats->second : stats {};
+    for (const auto &[key, entry] : Assets)
+        if (std::get<0>(key) == Type && !entry.Asset.expired())
+            result.ResidentCount++, result.ResidentBytes += entry.Bytes;
+    return result;
+}
+
+void scl::assets_manager::asset_registry::CollectGarbage()
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    for (auto it = Assets.begin(); it != Assets.end();)
+        if (it->second.Asset.expired()) it = Assets.erase(it);
+        else                            ++it;
+}
+
+scl::assets_manager::asset_registry &scl::assets_manager::asset_registry::Get()
+{
+    static asset_registry global_registry {};
+    return global_registry;
+}
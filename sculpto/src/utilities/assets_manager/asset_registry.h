@@ -0,0 +1,178 @@
+/*!****************************************************************//*!*
+ * \file   asset_registry.h
+ * \brief  Assets manager loaded assets registry (cache) class defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl::assets_manager
+{
+    /*!*
+     * Loaded assets registry class.
+     * Assets are keyed by type and content hash of their source file, so same file, referenced by different paths
+     * (or different files with same content), is loaded only once. Assets of same type, created from same file
+     * differently (e.g. textures of different usage), are distinguished by variant. Files content hashes are cached by canonical path
+     * and recomputed only after file modification.
+     * Registry holds only weak references, so unused assets are freed as usual.
+     * All functions are thread safe.
+     */
+    class asset_registry
+    {
+    public: /*! Asset registry data. */
+        /*! Single asset type registry statistics structure. */
+        struct stats
+        {
+            size_t Hits {};           /*! Count of lookups, which found loaded asset. */
+            size_t Misses {};         /*! Count of lookups, which found nothing. */
+            size_t ResidentCount {};  /*! Count of alive registered assets. */
+            size_t ResidentBytes {};  /*! Approximate memory size of alive registered assets. */
+        };
+
+    private:
+        /*! Source file content hash cache entry structure. */
+        struct file_entry
+        {
+            u64 ContentHash {};                                /*! File content hash. */
+            std::filesystem::file_time_type WriteTime {};      /*! File last write time, hash was computed for. */
+        };
+
+        /*! Registered asset entry structure. */
+        struct asset_entry
+        {
+            std::weak_ptr<void> Asset {};   /*! Registered asset weak reference. */
+            size_t Bytes {};                /*! Asset approximate memory size. */
+        };
+
+        /*! Asset key (asset type, source file content hash and asset variant). */
+        using asset_key = std::tuple<std::type_index, u64, u64>;
+
+        mutable std::mutex Mutex {};                                  /*! Registry access mutex. */
+        std::unordered_map<std::string, file_entry> Files {};         /*! Files content hashes by canonical path. */
+        std::map<asset_key, asset_entry> Assets {};                   /*! Assets by type and content hash. */
+        std::unordered_map<std::type_index, stats> Stats {};          /*! Lookups statistics by asset type. */
+
+    private: /*! Asset registry methods. */
+        /*!*
+         * Get file content hash (using cache) function. Mutex should be locked.
+         *
+         * \param FilePath - file path.
+         * \return file content hash (0 if file does not exist).
+         */
+        u64 GetContentHashLocked(const std::filesystem::path &FilePath);
+
+        /*!*
+         * Find alive asset and update lookups statistics function.
+         *
+         * \param Type - asset type.
+         * \param FilePath - asset source file path.
+         * \param Variant - asset variant.
+         * \param IsCounted - flag, showing wheather lookup should be counted in statistics.
+         * \return found asset (nullptr if nothing found).
+         */
+        shared<void> FindAsset(std::type_index Type, const std::filesystem::path &FilePath, u64 Variant, bool IsCounted);
+
+        /*!*
+         * Register loaded asset function.
+         *
+         * \param Type - asset type.
+         * \param FilePath - asset source file path.
+         * \param Asset - asset to register.
+         * \param Bytes - asset approximate memory size.
+         * \param Variant - asset variant.
+         * \return None.
+         */
+        void AddAsset(std::type_index Type, const std::filesystem::path &FilePath, const shared<void> &Asset, size_t Bytes, u64 Variant);
+
+    public:
+        /*!*
+         * Get file content hash function.
+         *
+         * \param FilePath - file path.
+         * \return file content hash (0 if file does not exist).
+         */
+        u64 GetContentHash(const std::filesystem::path &FilePath);
+
+        /*!*
+         * Find loaded asset by its source file function.
+         *
+         * \tparam T - asset type.
+         * \param FilePath - asset source file path.
+         * \param Variant - asset variant (e.g. texture usage).
+         * \return found asset (nullptr if asset is not loaded or already freed).
+         */
+        template <typename T>
+        shared<T> Find(const std::filesystem::path &FilePath, u64 Variant = 0)
+        {
+            return std::static_pointer_cast<T>(FindAsset(typeid(T), FilePath, Variant, true));
+        }
+
+        /*!*
+         * Check if asset is loaded without counting lookup in statistics function.
+         *
+         * \tparam T - asset type.
+         * \param FilePath - asset source file path.
+         * \param Variant - asset variant (e.g. texture usage).
+         * \return wheather asset is loaded and alive or not.
+         */
+        template <typename T>
+        bool Contains(const std::filesystem::path &FilePath, u64 Variant = 0)
+        {
+            return FindAsset(typeid(T), FilePath, Variant, false) != nullptr;
+        }
+
+        /*!*
+         * Register loaded asset function.
+         *
+         * \tparam T - asset type.
+         * \param FilePath - asset source file path.
+         * \param Asset - asset to register.
+         * \param Bytes - asset approximate memory size (for statistics).
+         * \param Variant - asset variant (e.g. texture usage).
+         * \return None.
+         */
+        template <typename T>
+        void Add(const std::filesystem::path &FilePath, const shared<T> &Asset, size_t Bytes, u64 Variant = 0)
+        {
+            AddAsset(typeid(T), FilePath, Asset, Bytes, Variant);
+        }
+
+        /*!*
+         * Get asset type registry statistics function.
+         *
+         * \tparam T - asset type.
+         * \param None.
+         * \return asset type statistics.
+         */
+        template <typename T>
+        stats GetStats() const { return GetStats(typeid(T)); }
+
+        /*!*
+         * Get asset type registry statistics function.
+         *
+         * \param Type - asset type.
+         * \return asset type statistics.
+         */
+        stats GetStats(std::type_index Type) const;
+
+        /*!*
+         * Remove entries of already freed assets function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void CollectGarbage();
+
+        /*!*
+         * Global assets registry getter function.
+         *
+         * \param None.
+         * \return global assets registry.
+         */
+        static asset_registry &Get();
+    };
+}
@@ -0,0 +1,182 @@
+/*!****************************************************************//*!*
+ * \file   async_load.cpp
+ * \brief  Assets manager asynchronous assets load functions implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "async_load.h"
+#include "meshes_load.h"
+#include "textures_load.h"
+#include "asset_registry.h"
+#include "core/resources/mesh.h"
+#include "core/render/primitives/texture.h"
+#include "utilities/thread_pool/thread_pool.h"
+
+namespace scl::assets_manager
+{
+    /*! Asynchronous asset load job interface. */
+    struct async_load_job
+    {
+        virtual ~async_load_job() = default;
+
+        /*!*
+         * Continue asset loading function. Called from main thread.
+         *
+         * \param IsBudgetExceeded - function, returning wheather per-frame upload budget is exceeded.
+         * \return wheather loading finished or not.
+         */
+        virtual bool Update(const std::function<bool()> &IsBudgetExceeded) = 0;
+    };
+
+    /*! Texture asynchronous load job. */
+    struct texture_load_job : public async_load_job
+    {
+        std::filesystem::path FileName {};      /*! Texture image file name. */
+        std::future<shared<texture_source>> Image {}; /*! Texture image decoding job. */
+        asset_promise<texture_2d> Promise {};   /*! Loading texture promise. */
+
+        bool Update(const std::function<bool()> &IsBudgetExceeded) override
+        {
+            if (Image.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+            shared<texture_source> texture_image = Image.get();
+            Promise.Resolve(texture_image != nullptr ? CreateTexture(FileName, *texture_image) : nullptr);
+            return true;
+        }
+    };
+
+    /*! Model asynchronous load job. */
+    struct mesh_load_job : public async_load_job
+    {
+        std::future<shared<mesh_source>> SourceRead {};                          /*! Model reading job. */
+        shared<mesh_source> Source {};                                           /*! Read model data. */
+        std::unordered_map<std::string, std::future<shared<texture_source>>> Images {};   /*! Texture images decoding jobs. */
+        unique<mesh_uploader> Uploader {};                                       /*! Model GPU upload state. */
+        asset_promise<mesh> Promise {};                                          /*! Loading mesh promise. */
+
+        bool Update(const std::function<bool()> &IsBudgetExceeded) override
+        {
+            if (Uploader == nullptr)
+            {
+                if (Source == nullptr)
+                {
+                    if (SourceRead.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+                    Source = SourceRead.get();
+                    if (Source == nullptr)
+                    {
+                        Promise.Resolve(nullptr);
+                        return true;
+                    }
+
+                    // All model texture images (except already loaded ones) are decoded in parallel.
+                    for (const auto &[file_name, texture_image] : Source->Images)
+                    {
+                        texture_usage usage = Source->GetTextureUsage(file_name);
+                        if (!asset_registry::Get().Contains<texture_2d>(file_name, (u64)usage))
+                            Images.emplace(file_name, thread_pool::Get().Submit([file_name, usage]() { return ReadTextureSource(file_name, usage); }));
+                    }
+                }
+
+                for (const auto &[file_name, texture_image] : Images)
+                    if (texture_image.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+                for (auto &[file_name, texture_image] : Images)
+                    Source->Images[file_name] = texture_image.get();
+                Images.clear();
+                Uploader = CreateUnique<mesh_uploader>(Source);
+            }
+
+            while (!Uploader->Step() && !IsBudgetExceeded());
+            if (!Uploader->IsDone()) return false;
+
+            asset_registry::Get().Add(Source->FileName, Uploader->GetMesh(), Source->GetTopologyBytes());
+            Promise.Resolve(Uploader->GetMesh());
+            return true;
+        }
+    };
+
+    /*! Function asynchronous job. */
+    struct function_job : public async_load_job
+    {
+        std::future<std::function<void()>> Result {}; /*! Worker thread job, returning function to finish job in main thread. */
+
+        bool Update(const std::function<bool()> &IsBudgetExceeded) override
+        {
+            if (Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+            std::function<void()> finish = Result.get();
+            if (finish) finish();
+            return true;
+        }
+    };
+
+    /*! Not finished asynchronous load jobs (accessed only from main thread). */
+    static std::vector<unique<async_load_job>> AsyncLoadJobs {};
+}
+
+scl::assets_manager::asset_handle<scl::mesh> scl::assets_manager::LoadMeshesAsync(const std::filesystem::path &ModelFilePath)
+{
+    unique<mesh_load_job> job = CreateUnique<mesh_load_job>();
+    if (shared<mesh> loaded_mesh = asset_registry::Get().Find<mesh>(ModelFilePath))
+    {
+        job->Promise.Resolve(loaded_mesh);
+        return job->Promise.GetHandle();
+    }
+
+    job->SourceRead = thread_pool::Get().Submit([ModelFilePath]() { return ReadMeshesTopology(ModelFilePath); });
+    asset_handle<mesh> handle = job->Promise.GetHandle();
+    AsyncLoadJobs.push_back(std::move(job));
+    return handle;
+}
+
+scl::assets_manager::asset_handle<scl::texture_2d> scl::assets_manager::LoadTextureAsync(const std::filesystem::path &TextureImageFilePath)
+{
+    unique<texture_load_job> job = CreateUnique<texture_load_job>();
+    if (shared<texture_2d> loaded_texture = asset_registry::Get().Find<texture_2d>(TextureImageFilePath, (u64)texture_usage::COLOR))
+    {
+        job->Promise.Resolve(loaded_texture);
+        return job->Promise.GetHandle();
+    }
+
+    job->FileName = TextureImageFilePath;
+    job->Image = thread_pool::Get().Submit([TextureImageFilePath]() { return ReadTextureSource(TextureImageFilePath); });
+    asset_handle<texture_2d> handle = job->Promise.GetHandle();
+    AsyncLoadJobs.push_back(std::move(job));
+    return handle;
+}
+
+void scl::assets_manager::RunAsync(const std::function<std::function<void()>()> &Job)
+{
+    unique<function_job> job = CreateUnique<function_job>();
+    job->Result = thread_pool::Get().Submit(Job);
+    AsyncLoadJobs.push_back(std::move(job));
+}
+
+void scl::assets_manager::UpdateAsyncLoads(float BudgetMs)
+{
+    if (AsyncLoadJobs.empty()) return;
+
+    using clock = std::chrono::high_resolution_clock;
+    const auto start_time = clock::now();
+    auto is_budget_exceeded = [&]()
+    {
+        return std::chrono::duration<float, std::milli>(clock::now() - start_time).count() >= BudgetMs;
+    };
+
+    // Finished jobs are removed in place, jobs after budget exceeding are only kept.
+    size_t kept_count = 0;
+    for (size_t i = 0; i < AsyncLoadJobs.size(); i++)
+    {
+        bool is_finished = (i == 0 || !is_budget_exceeded()) && AsyncLoadJobs[i]->Update(is_budget_exceeded);
+        if (!is_finished) AsyncLoadJobs[kept_count++] = std::move(AsyncLoadJobs[i]);
+    }
+    AsyncLoadJobs.resize(kept_count);
+}
+
+size_t scl::assets_manager::GetAsyncLoadsCount()
+{
+    return AsyncLoadJobs.size();
+}
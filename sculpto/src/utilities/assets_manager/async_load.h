@@ -0,0 +1,156 @@
+/*!****************************************************************//*!*
+ * \file   async_load.h
+ * \brief  Assets manager asynchronous assets load functions defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl { class mesh; class texture_2d; }
+
+namespace scl::assets_manager
+{
+    /*! Asynchronously loading asset status enum. */
+    enum class asset_status
+    {
+        LOADING, /*! Asset is still loading. */
+        READY,   /*! Asset is loaded and could be used. */
+        FAILED,  /*! Asset loading failed. */
+    };
+
+    /*! Asynchronously loading asset shared state structure. */
+    template <typename T>
+    struct asset_state
+    {
+        asset_status Status { asset_status::LOADING };                       /*! Asset loading status. */
+        shared<T> Asset {};                                                  /*! Loaded asset (nullptr while loading). */
+        std::vector<std::function<void(const shared<T> &)>> Callbacks {};    /*! Functions to call on load finish. */
+    };
+
+    /*!*
+     * Asynchronously loading asset handle class.
+     * Handle state is changed only from main (render context owning) thread, so it could be checked without synchronization.
+     */
+    template <typename T>
+    class asset_handle
+    {
+        template <typename Tasset> friend class asset_promise;
+
+    private: /*! Asset handle data. */
+        shared<asset_state<T>> State {};
+
+        /*!*
+         * Asset handle constructor by shared state.
+         *
+         * \param State - asset shared state.
+         */
+        asset_handle(const shared<asset_state<T>> &State) : State(State) {}
+
+    public: /*! Asset handle getter/setter functions. */
+        /*! Asset loading status getter function. */
+        asset_status GetStatus() const { return State ? State->Status : asset_status::FAILED; }
+        /*! Is asset loaded flag getter function. */
+        bool IsReady() const { return GetStatus() == asset_status::READY; }
+        /*! Is asset loading failed flag getter function. */
+        bool IsFailed() const { return GetStatus() == asset_status::FAILED; }
+        /*! Loaded asset getter function. Returns nullptr while asset is not ready. */
+        shared<T> Get() const { return State ? State->Asset : nullptr; }
+
+    public:
+        /*! Asset handle default constructor. */
+        asset_handle() = default;
+
+        /*!*
+         * Add function to call on asset load finish (immediately if already finished) function.
+         * Function is called from main thread with loaded asset (nullptr if loading failed).
+         *
+         * \param Callback - function to call.
+         * \return this asset handle.
+         */
+        asset_handle &OnLoad(const std::function<void(const shared<T> &)> &Callback)
+        {
+            if (GetStatus() == asset_status::LOADING) State->Callbacks.push_back(Callback);
+            else                                      Callback(Get());
+            return *this;
+        }
+    };
+
+    /*! Asynchronously loading asset result setting class. */
+    template <typename T>
+    class asset_promise
+    {
+    private: /*! Asset promise data. */
+        shared<asset_state<T>> State { CreateShared<asset_state<T>>() };
+
+    public:
+        /*! Asset handle, connected to promise getter function. */
+        asset_handle<T> GetHandle() const { return asset_handle<T>(State); }
+
+        /*!*
+         * Finish asset loading function.
+         *
+         * \param Asset - loaded asset (nullptr if loading failed).
+         * \return None.
+         */
+        void Resolve(const shared<T> &Asset)
+        {
+            State->Asset = Asset;
+            State->Status = Asset != nullptr ? asset_status::READY : asset_status::FAILED;
+            for (const auto &callback : State->Callbacks)
+                callback(Asset);
+            State->Callbacks.clear();
+        }
+    };
+
+    /*!*
+     * Start asynchronous model (all meshes with materials) loading function.
+     * Model reading and texture images decoding are performed in worker threads (all images in parallel),
+     * meshes and textures are uploaded to GPU during UpdateAsyncLoads calls.
+     * Should be called from main thread.
+     *
+     * \param ModelFilePath - model file path.
+     * \return loading mesh handle.
+     */
+    asset_handle<mesh> LoadMeshesAsync(const std::filesystem::path &ModelFilePath);
+
+    /*!*
+     * Start asynchronous texture loading function.
+     * Image is decoded in worker thread, uploaded to GPU during UpdateAsyncLoads calls.
+     * Should be called from main thread.
+     *
+     * \param TextureImageFilePath - texture image file path.
+     * \return loading texture handle.
+     */
+    asset_handle<texture_2d> LoadTextureAsync(const std::filesystem::path &TextureImageFilePath);
+
+    /*!*
+     * Start asynchronous job function.
+     * Job is run in worker thread, function, returned by it, is called from main thread during UpdateAsyncLoads calls.
+     * Should be called from main thread.
+     *
+     * \param Job - function to run in worker thread (returns function to finish job in main thread or empty function).
+     * \return None.
+     */
+    void RunAsync(const std::function<std::function<void()>()> &Job);
+
+    /*!*
+     * Upload asynchronously loaded assets to GPU function.
+     * Called from main thread each frame. At least one upload step is performed per call to guarantee progress.
+     *
+     * \param BudgetMs - maximum time in milliseconds to spend on uploads.
+     * \return None.
+     */
+    void UpdateAsyncLoads(float BudgetMs = 4);
+
+    /*!*
+     * Count of not finished asynchronous assets loads getter function.
+     *
+     * \param None.
+     * \return loading assets count.
+     */
+    size_t GetAsyncLoadsCount();
+}
@@ -0,0 +1,196 @@
+/*!****************************************************************//*!*
+ * \file   file_watcher.cpp
+ * \brief  Assets manager directories changes watcher class implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#ifndef SCL_PLATFORM_WINDOWS
+#   include <sys/inotify.h>
+#   include <poll.h>
+#   include <unistd.h>
+#endif /*! !SCL_PLATFORM_WINDOWS */
+
+#include "file_watcher.h"
+
+namespace scl::assets_manager
+{
+    /*! Watching thread wake up period (to check stop flag and new directories). */
+    static constexpr int FILE_WATCHER_WAIT_TIMEOUT_MS = 100;
+}
+
+scl::assets_manager::file_watcher::file_watcher()
+{
+    Worker = std::thread([this]() { WorkerLoop(); });
+}
+
+scl::assets_manager::file_watcher::~file_watcher()
+{
+    IsStopping = true;
+    if (Worker.joinable()) Worker.join();
+}
+
+void scl::assets_manager::file_watcher::AddDirectory(const std::filesystem::path &DirectoryPath)
+{
+    std::error_code error {};
+    std::string directory = std::filesystem::weakly_canonical(DirectoryPath, error).string();
+    if (error || !std::filesystem::is_directory(directory, error)) return;
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Directories.insert(directory).second)
+        NewDirectories.push_back(directory);
+}
+
+void scl::assets_manager::file_watcher::AddChange(const std::filesystem::path &FilePath)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    ChangedFiles.insert(FilePath.lexically_normal().string());
+    LastChangeTime = std::chrono::steady_clock::now();
+}
+
+std::vector<std::string> scl::assets_manager::file_watcher::PopChanges(float DebounceMs)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (ChangedFiles.empty() ||
+        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - LastChangeTime).count() < DebounceMs)
+        return {};
+
+    std::vector<std::string> changes(ChangedFiles.begin(), ChangedFiles.end());
+    ChangedFiles.clear();
+    return changes;
+}
+
+#ifdef SCL_PLATFORM_WINDOWS
+
+void scl::assets_manager::file_watcher::WorkerLoop()
+{
+    /*! Watched directory structure. */
+    struct watched_directory
+    {
+        std::filesystem::path Path {};               /*! Directory path. */
+        HANDLE Handle { INVALID_HANDLE_VALUE };      /*! Directory handle. */
+        OVERLAPPED Overlapped {};                    /*! Pending changes read state. */
+        DWORD Buffer[4096] {};                       /*! Changes notifications buffer. */
+    };
+
+    const DWORD notify_filter = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME;
+    std::vector<unique<watched_directory>> directories {};
+    std::vector<HANDLE> events {};
+
+    while (!IsStopping)
+    {
+        // Open newly added directories and start reading their changes.
+        std::vector<std::string> new_directories {};
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            std::swap(new_directories, NewDirectories);
+        }
+        for (const std::string &path : new_directories)
+        {
+            if (directories.size() == MAXIMUM_WAIT_OBJECTS)
+            {
+                SCL_CORE_WARN("Too many watched directories, directory \"{}\" is not watched.", path);
+                continue;
+            }
+
+            unique<watched_directory> directory = CreateUnique<watched_directory>();
+            directory->Path = path;
+            directory->Handle = CreateFileW(directory->Path.c_str(), FILE_LIST_DIRECTORY,
+                                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                                            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+            if (directory->Handle == INVALID_HANDLE_VALUE) continue;
+
+            directory->Overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+            ReadDirectoryChangesW(directory->Handle, directory->Buffer, sizeof(directory->Buffer), FALSE, notify_filter,
+                                  nullptr, &directory->Overlapped, nullptr);
+            events.push_back(directory->Overlapped.hEvent);
+            directories.push_back(std::move(directory));
+        }
+
+        if (events.empty())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(FILE_WATCHER_WAIT_TIMEOUT_MS));
+            continue;
+        }
+
+        DWORD wait_result = WaitForMultipleObjects((DWORD)events.size(), events.data(), FALSE, FILE_WATCHER_WAIT_TIMEOUT_MS);
+        if (wait_result < WAIT_OBJECT_0 || wait_result >= WAIT_OBJECT_0 + events.size()) continue;
+
+        watched_directory &directory = *directories[wait_result - WAIT_OBJECT_0];
+        DWORD bytes_count {};
+        if (GetOverlappedResult(directory.Handle, &directory.Overlapped, &bytes_count, FALSE) && bytes_count != 0)
+        {
+            const u8 *notification = (const u8 *)directory.Buffer;
+            while (true)
+            {
+                const FILE_NOTIFY_INFORMATION &info = *(const FILE_NOTIFY_INFORMATION *)notification;
+                AddChange(directory.Path / std::wstring(info.FileName, info.FileNameLength / sizeof(WCHAR)));
+                if (info.NextEntryOffset == 0) break;
+                notification += info.NextEntryOffset;
+            }
+        }
+
+        ResetEvent(directory.Overlapped.hEvent);
+        ReadDirectoryChangesW(directory.Handle, directory.Buffer, sizeof(directory.Buffer), FALSE, notify_filter,
+                              nullptr, &directory.Overlapped, nullptr);
+    }
+
+    for (const unique<watched_directory> &directory : directories)
+    {
+        DWORD bytes_count {};
+        CancelIoEx(directory->Handle, &directory->Overlapped);
+        GetOverlappedResult(directory->Handle, &directory->Overlapped, &bytes_count, TRUE);
+        CloseHandle(directory->Overlapped.hEvent);
+        CloseHandle(directory->Handle);
+    }
+}
+
+#else
+
+void scl::assets_manager::file_watcher::WorkerLoop()
+{
+    int inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify < 0)
+    {
+        SCL_CORE_WARN("File watcher could not be initialised, files changes are not tracked.");
+        return;
+    }
+
+    std::unordered_map<int, std::filesystem::path> directories {};
+    alignas(inotify_event) char buffer[16 * 1024];
+    while (!IsStopping)
+    {
+        // Add watches for newly added directories.
+        std::vector<std::string> new_directories {};
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            std::swap(new_directories, NewDirectories);
+        }
+        for (const std::string &path : new_directories)
+        {
+            int watch = inotify_add_watch(inotify, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+            if (watch >= 0) directories[watch] = path;
+        }
+
+        pollfd poll_fd { inotify, POLLIN, 0 };
+        if (poll(&poll_fd, 1, FILE_WATCHER_WAIT_TIMEOUT_MS) <= 0) continue;
+
+        ssize_t bytes_count {};
+        while ((bytes_count = read(inotify, buffer, sizeof(buffer))) > 0)
+            for (char *notification = buffer; notification < buffer + bytes_count;)
+            {
+                const inotify_event &event = *(const inotify_event *)notification;
+                auto directory = directories.find(event.wd);
+                if (directory != directories.end() && event.len > 0)
+                    AddChange(directory->second / event.name);
+                notification += sizeof(inotify_event) + event.len;
+            }
+    }
+
+    close(inotify);
+}
+
+#endif /*! !SCL_PLATFORM_WINDOWS */
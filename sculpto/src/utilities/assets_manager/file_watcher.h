@@ -0,0 +1,78 @@
+/*!****************************************************************//*!*
+ * \file   file_watcher.h
+ * \brief  Assets manager directories changes watcher class defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl::assets_manager
+{
+    /*!*
+     * Directories changes watcher class.
+     * Directories (not recursively) are watched in background thread, which collects paths of changed files.
+     * Uses ReadDirectoryChangesW on Windows and inotify on other platforms.
+     * All functions are thread safe.
+     */
+    class file_watcher
+    {
+    private: /*! File watcher data. */
+        std::thread Worker {};                                           /*! Watching thread. */
+        std::atomic<bool> IsStopping {};                                 /*! Watching thread stop flag. */
+        mutable std::mutex Mutex {};                                     /*! Directories and changes access mutex. */
+        std::set<std::string> Directories {};                            /*! Watched directories canonical paths. */
+        std::vector<std::string> NewDirectories {};                      /*! Directories, not opened by watching thread yet. */
+        std::set<std::string> ChangedFiles {};                           /*! Changed, but not popped files paths. */
+        std::chrono::steady_clock::time_point LastChangeTime {};         /*! Last file change time. */
+
+    private: /*! File watcher methods. */
+        /*!*
+         * Watching thread main function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void WorkerLoop();
+
+        /*!*
+         * Register file change function. Called from watching thread.
+         *
+         * \param FilePath - changed file path.
+         * \return None.
+         */
+        void AddChange(const std::filesystem::path &FilePath);
+
+    public:
+        /*! File watcher constructor. Starts watching thread. */
+        file_watcher();
+
+        /*! File watcher destructor. Stops watching thread. */
+        ~file_watcher();
+
+        /*! File watchers are not copyable. */
+        file_watcher(const file_watcher &Other) = delete;
+        file_watcher &operator=(const file_watcher &Other) = delete;
+
+        /*!*
+         * Start watching directory function.
+         *
+         * \param DirectoryPath - directory to watch (already watched directories are ignored).
+         * \return None.
+         */
+        void AddDirectory(const std::filesystem::path &DirectoryPath);
+
+        /*!*
+         * Get changed files function.
+         * Changes are returned only if there were no new changes during debounce time, so files, written in several steps
+         * (or several files, saved at once) are reported once.
+         *
+         * \param DebounceMs - time in milliseconds without changes, required to report them.
+         * \return changed files canonical paths (empty if there are no changes or they are not settled yet).
+         */
+        std::vector<std::string> PopChanges(float DebounceMs);
+    };
+}
@@ -18,3 +18,10 @@ std::string scl::assets_manager::LoadFile(const std::filesystem::path &FilePath)
     file_buffer << file.rdbuf();
     return file_buffer.str();
 }
+
+std::filesystem::path scl::assets_manager::GetTemporaryFilePath(const std::filesystem::path &FilePath)
+{
+    std::filesystem::path temporary_file_path = FilePath;
+    temporary_file_path += std::format(".{:x}.tmp", std::hash<std::thread::id> {}(std::this_thread::get_id()));
+    return temporary_file_path;
+}
@@ -19,4 +19,13 @@ namespace scl::assets_manager
      * \return file text string.
      */
     std::string LoadFile(const std::filesystem::path &FilePath);
+
+    /*!*
+     * Get unique (per writing thread) temporary file path for file function.
+     * Files are written under temporary name and renamed after, so concurrent writers of same file do not share temporary file.
+     *
+     * \param FilePath - path of file to write.
+     * eturn temporary file path.
+     */
+    std::filesystem::path GetTemporaryFilePath(const std::filesystem::path &FilePath);
 }
@@ -0,0 +1,216 @@
+/*!****************************************************************//*!*
+ * \file   hot_reload.cpp
+ * \brief  Assets manager shaders and textures hot reload functions implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "hot_reload.h"
+#include "file_watcher.h"
+#include "shaders_load.h"
+#include "asset_registry.h"
+#include "core/render/primitives/shader.h"
+#include "core/render/primitives/texture.h"
+#include "utilities/thread_pool/thread_pool.h"
+
+namespace scl::assets_manager
+{
+    /*! Watched shader program structure. */
+    struct watched_shader
+    {
+        std::weak_ptr<shader_program> Program {};    /*! Watched program. */
+        std::vector<std::string> Files {};           /*! Program source and included files canonical paths. */
+    };
+
+    /*! Watched texture structure. */
+    struct watched_texture
+    {
+        std::weak_ptr<texture_2d> Texture {};                  /*! Watched texture. */
+        std::filesystem::path FilePath {};                     /*! Texture image file path (as it was loaded). */
+        std::string File {};                                   /*! Texture image file canonical path. */
+        texture_usage Usage {};                                /*! Texture usage. */
+        std::future<shared<texture_source>> Reading {};        /*! Changed texture image reading job. */
+        bool IsChangedWhileReading {};                         /*! Wheather image was changed again during reading. */
+    };
+
+    /*! Hot reload state structure. Accessed only from main thread. */
+    struct hot_reload_state
+    {
+#ifdef SCL_DIST
+        bool IsEnabled { false };                                                    /*! Hot reload enable flag. */
+#else
+        bool IsEnabled { true };                                                     /*! Hot reload enable flag. */
+#endif /*! SCL_DIST */
+        unique<file_watcher> Watcher {};                                             /*! Assets directories watcher. */
+        std::map<const void *, watched_shader> Shaders {};                           /*! Watched shaders by program pointer. */
+        std::map<const void *, watched_texture> Textures {};                         /*! Watched textures by texture pointer. */
+        std::unordered_map<std::string, std::vector<const void *>> Dependents {};    /*! Watched assets by file they depend on. */
+    };
+
+    /*! Hot reload state getter function. */
+    static hot_reload_state &GetState()
+    {
+        static hot_reload_state state {};
+        return state;
+    }
+
+    /*!*
+     * Get file canonical path, which is compared with changed files paths, function.
+     *
+     * \param FilePath - file path.
+     * \return file canonical path.
+     */
+    static std::string GetWatchedPath(const std::filesystem::path &FilePath)
+    {
+        std::error_code error {};
+        std::filesystem::path canonical_path = std::filesystem::weakly_canonical(FilePath, error);
+        return (error ? FilePath : canonical_path).lexically_normal().string();
+    }
+
+    /*!*
+     * Add asset dependency on file and start watching file directory function.
+     *
+     * \param State - hot reload state.
+     * \param File - file canonical path.
+     * \param Asset - dependent asset key.
+     * \return None.
+     */
+    static void AddDependency(hot_reload_state &State, const std::string &File, const void *Asset)
+    {
+        State.Dependents[File].push_back(Asset);
+        if (State.Watcher == nullptr) State.Watcher = CreateUnique<file_watcher>();
+        State.Watcher->AddDirectory(std::filesystem::path(File).parent_path());
+    }
+
+    /*!*
+     * Rebuild files to dependent assets map function.
+     * Freed assets are removed from watched ones.
+     *
+     * \param State - hot reload state.
+     * \return None.
+     */
+    static void RebuildDependencies(hot_reload_state &State)
+    {
+        std::erase_if(State.Shaders, [](const auto &Shader) { return Shader.second.Program.expired(); });
+        std::erase_if(State.Textures, [](const auto &Texture) { return Texture.second.Texture.expired(); });
+
+        State.Dependents.clear();
+        for (const auto &[key, shader] : State.Shaders)
+            for (const std::string &file : shader.Files)
+                AddDependency(State, file, key);
+        for (const auto &[key, texture] : State.Textures)
+            AddDependency(State, texture.File, key);
+    }
+
+    /*!*
+     * Start changed texture image reading in worker thread function.
+     *
+     * \param Texture - watched texture.
+     * \return None.
+     */
+    static void ReadTexture(watched_texture &Texture)
+    {
+        SCL_CORE_INFO("Texture \"{}\" changed, reloading.", Texture.FilePath.string());
+        Texture.Reading = thread_pool::Get().Submit([FilePath = Texture.FilePath, Usage = Texture.Usage]()
+        {
+            return ReadTextureSource(FilePath, Usage);
+        });
+    }
+}
+
+void scl::assets_manager::SetHotReload(bool IsEnabled)
+{
+    hot_reload_state &state = GetState();
+    state.IsEnabled = IsEnabled;
+    if (IsEnabled) RebuildDependencies(state);
+    else state.Watcher.reset();
+}
+
+bool scl::assets_manager::GetHotReload()
+{
+    return GetState().IsEnabled;
+}
+
+void scl::assets_manager::WatchShader(const shared<shader_program> &ShaderProgram)
+{
+    hot_reload_state &state = GetState();
+    if (ShaderProgram == nullptr) return;
+
+    watched_shader &shader = state.Shaders[ShaderProgram.get()];
+    shader.Program = ShaderProgram;
+    shader.Files.clear();
+    for (const std::string *file_name : { &ShaderProgram->SingleSourceFileName, &ShaderProgram->VertexShadersourceFileName,
+                                          &ShaderProgram->GeometryShadersourceFileName, &ShaderProgram->PixelShadersourceFileName })
+        if (*file_name != "") shader.Files.push_back(GetWatchedPath(*file_name));
+    for (const std::string &file_name : ShaderProgram->IncludedFileNames)
+        shader.Files.push_back(GetWatchedPath(file_name));
+
+    if (state.IsEnabled) RebuildDependencies(state);
+}
+
+void scl::assets_manager::WatchTexture(const shared<texture_2d> &Texture, const std::filesystem::path &TextureImageFilePath, texture_usage Usage)
+{
+    hot_reload_state &state = GetState();
+    if (Texture == nullptr) return;
+
+    watched_texture &texture = state.Textures[Texture.get()];
+    texture.Texture = Texture;
+    texture.FilePath = TextureImageFilePath;
+    texture.File = GetWatchedPath(TextureImageFilePath);
+    texture.Usage = Usage;
+
+    if (state.IsEnabled) RebuildDependencies(state);
+}
+
+void scl::assets_manager::UpdateHotReload(float DebounceMs)
+{
+    hot_reload_state &state = GetState();
+    if (!state.IsEnabled || state.Watcher == nullptr) return;
+
+    // Upload textures, which images were read since last call.
+    for (auto &[key, texture] : state.Textures)
+    {
+        if (!texture.Reading.valid() || texture.Reading.wait_for(std::chrono::seconds(0)) != std::future_status::ready) continue;
+
+        shared<texture_source> source = texture.Reading.get();
+        shared<texture_2d> updated_texture = texture.Texture.lock();
+        if (source != nullptr && updated_texture != nullptr)
+        {
+            updated_texture->Update(source->Data);
+            asset_registry::Get().Add(texture.FilePath, updated_texture, source->GetBytes(), (u64)source->Usage);
+        }
+        if (texture.IsChangedWhileReading)
+        {
+            texture.IsChangedWhileReading = false;
+            ReadTexture(texture);
+        }
+    }
+
+    std::vector<std::string> changed_files = state.Watcher->PopChanges(DebounceMs);
+    if (changed_files.empty()) return;
+
+    // Each asset is reloaded once, even if several of its files were changed.
+    std::set<const void *> changed_assets {};
+    for (const std::string &file : changed_files)
+        if (auto dependents = state.Dependents.find(file); dependents != state.Dependents.end())
+            changed_assets.insert(dependents->second.begin(), dependents->second.end());
+
+    for (const void *key : changed_assets)
+    {
+        if (auto shader = state.Shaders.find(key); shader != state.Shaders.end())
+        {
+            // Shader update watches it again, so its entry is not used after.
+            if (shared<shader_program> program = shader->second.Program.lock())
+                UpdateShader(program);
+        }
+        else if (auto texture = state.Textures.find(key); texture != state.Textures.end())
+        {
+            // Image, changed during reading, is read again after previous reading result is uploaded.
+            if (texture->second.Reading.valid()) texture->second.IsChangedWhileReading = true;
+            else ReadTexture(texture->second);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/*!****************************************************************//*!*
+ * \file   hot_reload.h
+ * \brief  Assets manager shaders and textures hot reload functions defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+#include "textures_load.h"
+
+namespace scl { class shader_program; class texture_2d; }
+
+namespace scl::assets_manager
+{
+    /*!*
+     * Enable or disable assets hot reload function.
+     * Hot reload is enabled by default in all configurations, except distribution one.
+     *
+     * \param IsEnabled - wheather assets should be reloaded on their files change.
+     * \return None.
+     */
+    void SetHotReload(bool IsEnabled);
+
+    /*!*
+     * Assets hot reload enabled flag getter function.
+     *
+     * \param None.
+     * \return wheather assets are reloaded on their files change.
+     */
+    bool GetHotReload();
+
+    /*!*
+     * Start watching shader program source files function.
+     * Program is rebuilt if any of its source or included files is changed.
+     * Watching program again (after its update) replaces its dependencies.
+     * Should be called from the thread, owning render context.
+     *
+     * \param ShaderProgram - shader program to watch (only weak reference is kept).
+     * \return None.
+     */
+    void WatchShader(const shared<shader_program> &ShaderProgram);
+
+    /*!*
+     * Start watching texture image file function.
+     * Should be called from the thread, owning render context.
+     *
+     * \param Texture - texture to watch (only weak reference is kept).
+     * \param TextureImageFilePath - texture image file path.
+     * \param Usage - texture usage, texture was created for.
+     * \return None.
+     */
+    void WatchTexture(const shared<texture_2d> &Texture, const std::filesystem::path &TextureImageFilePath, texture_usage Usage);
+
+    /*!*
+     * Reload assets, which files were changed, function.
+     * Changed shaders are rebuilt at once, changed textures images are read in worker threads
+     * and uploaded to GPU in one of next calls.
+     * Should be called every frame from the thread, owning render context.
+     *
+     * \param DebounceMs - time in milliseconds without files changes, required to reload changed assets.
+     * \return None.
+     */
+    void UpdateHotReload(float DebounceMs = 200);
+}
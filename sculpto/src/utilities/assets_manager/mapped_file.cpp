@@ -0,0 +1,72 @@
+/*!****************************************************************//*!*
+ * \file   mapped_file.cpp
+ * \brief  Assets manager read only memory mapped file class implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#ifndef SCL_PLATFORM_WINDOWS
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif /*! !SCL_PLATFORM_WINDOWS */
+
+#include "mapped_file.h"
+
+#ifdef SCL_PLATFORM_WINDOWS
+
+scl::assets_manager::mapped_file::mapped_file(const std::filesystem::path &FilePath)
+{
+    File = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (File == INVALID_HANDLE_VALUE) return;
+
+    LARGE_INTEGER file_size {};
+    if (!GetFileSizeEx(File, &file_size) || file_size.QuadPart == 0) return;
+
+    Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (Mapping == nullptr) return;
+
+    Data = (const u8 *)MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    if (Data != nullptr) Size = (size_t)file_size.QuadPart;
+}
+
+scl::assets_manager::mapped_file::~mapped_file()
+{
+    if (Data != nullptr) UnmapViewOfFile(Data);
+    if (Mapping != nullptr) CloseHandle(Mapping);
+    if (File != INVALID_HANDLE_VALUE) CloseHandle(File);
+}
+
+#else
+
+scl::assets_manager::mapped_file::mapped_file(const std::filesystem::path &FilePath)
+{
+    File = open(FilePath.c_str(), O_RDONLY);
+    if (File < 0) return;
+
+    struct stat file_stat {};
+    if (fstat(File, &file_stat) != 0 || file_stat.st_size == 0) return;
+
+    void *data = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+    if (data == MAP_FAILED) return;
+    Data = (const u8 *)data;
+    Size = (size_t)file_stat.st_size;
+}
+
+scl::assets_manager::mapped_file::~mapped_file()
+{
+    if (Data != nullptr) munmap((void *)Data, Size);
+    if (File >= 0) close(File);
+}
+
+#endif /*! !SCL_PLATFORM_WINDOWS */
+
+scl::shared<scl::assets_manager::mapped_file> scl::assets_manager::mapped_file::Create(const std::filesystem::path &FilePath)
+{
+    shared<mapped_file> file = CreateShared<mapped_file>(FilePath);
+    return file->IsOk() ? file : nullptr;
+}
@@ -0,0 +1,59 @@
+/*!****************************************************************//*!*
+ * \file   mapped_file.h
+ * \brief  Assets manager read only memory mapped file class defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl::assets_manager
+{
+    /*! Read only memory mapped file class. */
+    class mapped_file
+    {
+    private: /*! Mapped file data. */
+        const u8 *Data {};    /*! Mapped file content pointer. */
+        size_t Size {};       /*! Mapped file size in bytes. */
+#ifdef SCL_PLATFORM_WINDOWS
+        HANDLE File { INVALID_HANDLE_VALUE };  /*! File handle. */
+        HANDLE Mapping {};                     /*! File mapping object handle. */
+#else
+        int File { -1 };                       /*! File descriptor. */
+#endif /*! !SCL_PLATFORM_WINDOWS */
+
+    public: /*! Mapped file getter/setter functions. */
+        /*! Mapped file content pointer getter function. */
+        const u8 *GetData() const { return Data; }
+        /*! Mapped file size in bytes getter function. */
+        size_t GetSize() const { return Size; }
+        /*! Is file mapped flag getter function. */
+        bool IsOk() const { return Data != nullptr; }
+
+    public:
+        /*!*
+         * Mapped file constructor. Maps whole file to memory.
+         *
+         * \param FilePath - file to map.
+         */
+        mapped_file(const std::filesystem::path &FilePath);
+
+        /*! Mapped file destructor. Unmaps file. */
+        ~mapped_file();
+
+        /*! Mapped files are not copyable. */
+        mapped_file(const mapped_file &Other) = delete;
+        mapped_file &operator=(const mapped_file &Other) = delete;
+
+        /*!*
+         * Mapped file creation function.
+         *
+         * \param FilePath - file to map.
+         * \return mapped file pointer (nullptr if mapping failed).
+         */
+        static shared<mapped_file> Create(const std::filesystem::path &FilePath);
+    };
+}
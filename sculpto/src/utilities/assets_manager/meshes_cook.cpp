@@ -0,0 +1,375 @@
+/*!****************************************************************//*!*
+ * \file   meshes_cook.cpp
+ * \brief  Assets manager precompiled (cooked) binary mesh files functions implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "meshes_cook.h"
+#include "meshes_load.h"
+#include "mapped_file.h"
+#include "files_load.h"
+#include "asset_registry.h"
+#include "core/resources/vertex.h"
+
+namespace scl::assets_manager
+{
+    /*! Cooked mesh file format constants. */
+    static constexpr char COOKED_MESH_MAGIC[8] = "SCLMESH";
+    static constexpr u32 COOKED_MESH_VERSION = 5;
+    static constexpr u64 COOKED_MESH_ALIGNMENT = 4096;
+    static constexpr u32 COOKED_MESH_NO_NAME = ~0u;
+
+    /*! Cooked mesh file header structure. */
+    struct cooked_mesh_header
+    {
+        char Magic[8];           /*! File format magic string. */
+        u32 Version;             /*! File format version. */
+        u32 VertexSize;          /*! Size of vertex structure, file was cooked with. */
+        i64 SourceWriteTime;     /*! Source model file last write time on cooking. */
+        u64 SourceHash;          /*! Source model file content hash on cooking. */
+        u32 SubmeshesCount;      /*! Count of sub-meshes in file. */
+        u32 NamesSize;           /*! Texture file names table size in bytes. */
+        u64 SubmeshesOffset;     /*! Sub-meshes table offset from file begining. */
+        u64 NamesOffset;         /*! Texture file names table offset from file begining. */
+        u32 LodsCount;           /*! Count of all sub-meshes levels of detail. */
+        u32 __dummy;
+        u64 LodsOffset;          /*! Levels of detail table offset from file begining. */
+        u64 DependenciesHash;    /*! Hash of files, read on model import besides model file, contents on cooking. */
+        u32 DependenciesCount;   /*! Count of files, read on model import besides model file. */
+        u32 DependenciesNames;   /*! Offset of first of consecutive dependencies file names in names table. */
+    };
+
+    /*! Cooked mesh file sub-mesh table entry structure. */
+    struct cooked_submesh
+    {
+        u64 VerticesOffset;      /*! Sub-mesh vertices block offset from file begining. */
+        u64 IndicesOffset;       /*! Sub-mesh indices block offset from file begining. */
+        u32 VerticesCount;       /*! Sub-mesh vertices count. */
+        u32 IndicesCount;        /*! Sub-mesh indices count. */
+        float BoundMin[3];       /*! Sub-mesh bound box minimum point. */
+        float BoundMax[3];       /*! Sub-mesh bound box maximum point. */
+        u32 MapsNames[4];        /*! Diffuse, specular, emission and normal maps file names offsets in names table. */
+        u32 FirstLod;            /*! Sub-mesh first level of detail index in levels of detail table. */
+        u32 LodsCount;           /*! Count of sub-mesh levels of detail. */
+        u64 MeshletsOffset;      /*! Sub-mesh meshlets block offset from file begining. */
+        u32 MeshletsCount;       /*! Sub-mesh meshlets count. */
+        u32 __dummy;
+    };
+
+    /*! Cooked mesh file level of detail table entry structure. */
+    struct cooked_lod
+    {
+        u64 IndicesOffset;       /*! Level of detail indices block offset from file begining. */
+        u32 IndicesCount;        /*! Level of detail indices count. */
+        float Error;             /*! Level of detail maximum geometric error. */
+    };
+
+    /*!*
+     * Get file last write time as integer function.
+     *
+     * \param FilePath - file path.
+     * \return file last write time (0 if file is not available).
+     */
+    static i64 GetWriteTime(const std::filesystem::path &FilePath)
+    {
+        std::error_code error {};
+        std::filesystem::file_time_type write_time = std::filesystem::last_write_time(FilePath, error);
+        return error ? 0 : (i64)write_time.time_since_epoch().count();
+    }
+
+    /*!*
+     * Get combined content hash of files function.
+     *
+     * \param FileNames - files names.
+     * \return files content hash (missing files hash as 0).
+     */
+    static u64 GetDependenciesHash(const std::vector<std::string> &FileNames)
+    {
+        u64 hash = 14695981039346656037ull;
+        for (const std::string &file_name : FileNames)
+            hash = (hash ^ asset_registry::Get().GetContentHash(file_name)) * 1099511628211ull;
+        return hash;
+    }
+
+    /*!*
+     * Align offset up to cooked file blocks alignment function.
+     *
+     * \param Offset - offset to align.
+     * \return aligned offset.
+     */
+    static u64 AlignOffset(u64 Offset)
+    {
+        return (Offset + COOKED_MESH_ALIGNMENT - 1) / COOKED_MESH_ALIGNMENT * COOKED_MESH_ALIGNMENT;
+    }
+}
+
+std::filesystem::path scl::assets_manager::GetCookedMeshesPath(const std::filesystem::path &ModelFilePath)
+{
+    std::filesystem::path cooked_file_path = ModelFilePath;
+    cooked_file_path += ".sclmesh";
+    return cooked_file_path;
+}
+
+bool scl::assets_manager::CookMeshes(const std::filesystem::path &ModelFilePath, const mesh_source &Source)
+{
+    const std::string directory_path = ModelFilePath.parent_path().string() + '/';
+
+    // Texture file names are stored relative to model directory, so models could be moved with their cooked files.
+    std::string names {};
+    auto add_name = [&](const std::string &FileName) -> u32
+    {
+        if (FileName.empty()) return COOKED_MESH_NO_NAME;
+        u32 offset = (u32)names.size();
+        names += FileName.starts_with(directory_path) ? FileName.substr(directory_path.size()) : FileName;
+        names += '\0';
+        return offset;
+    };
+
+    cooked_mesh_header header {};
+    memcpy(header.Magic, COOKED_MESH_MAGIC, sizeof(header.Magic));
+    header.Version = COOKED_MESH_VERSION;
+    header.VertexSize = sizeof(vertex);
+    header.SourceWriteTime = GetWriteTime(ModelFilePath);
+    header.SourceHash = asset_registry::Get().GetContentHash(ModelFilePath);
+    header.SubmeshesCount = (u32)Source.SubMeshes.size();
+    header.SubmeshesOffset = sizeof(cooked_mesh_header);
+    header.DependenciesHash = GetDependenciesHash(Source.DependencyFileNames);
+    header.DependenciesCount = (u32)Source.DependencyFileNames.size();
+    header.DependenciesNames = (u32)names.size();
+    for (const std::string &file_name : Source.DependencyFileNames)
+        add_name(std::filesystem::path(file_name).lexically_proximate(ModelFilePath.parent_path()).generic_string());
+
+    // Layout sub-meshes data blocks.
+    std::vector<cooked_submesh> submeshes(Source.SubMeshes.size());
+    std::vector<cooked_lod> lods {};
+    for (size_t i = 0; i < Source.SubMeshes.size(); i++)
+    {
+        const submesh_source &submesh = Source.SubMeshes[i];
+        cooked_submesh &cooked = submeshes[i];
+        cooked.VerticesCount = (u32)submesh.GetVertices().size();
+        cooked.IndicesCount = (u32)submesh.GetIndices().size();
+        cooked.BoundMin[0] = submesh.BoundBox.Min.X, cooked.BoundMin[1] = submesh.BoundBox.Min.Y, cooked.BoundMin[2] = submesh.BoundBox.Min.Z;
+        cooked.BoundMax[0] = submesh.BoundBox.Max.X, cooked.BoundMax[1] = submesh.BoundBox.Max.Y, cooked.BoundMax[2] = submesh.BoundBox.Max.Z;
+        cooked.MapsNames[0] = add_name(submesh.DiffuseMapFileName);
+        cooked.MapsNames[1] = add_name(submesh.SpecularMapFileName);
+        cooked.MapsNames[2] = add_name(submesh.EmissionMapFileName);
+        cooked.MapsNames[3] = add_name(submesh.NormalMapFileName);
+        cooked.FirstLod = (u32)lods.size();
+        cooked.LodsCount = (u32)submesh.Lods.size();
+        for (const auto &lod : submesh.Lods)
+            lods.push_back({ 0, (u32)lod.GetIndices().size(), lod.Error });
+        cooked.MeshletsCount = (u32)submesh.GetMeshlets().size();
+    }
+    header.NamesOffset = header.SubmeshesOffset + submeshes.size() * sizeof(cooked_submesh);
+    header.NamesSize = (u32)names.size();
+    header.LodsOffset = AlignOffset(header.NamesOffset + names.size());
+    header.LodsCount = (u32)lods.size();
+
+    u64 offset = header.LodsOffset + lods.size() * sizeof(cooked_lod);
+    for (size_t i = 0; i < submeshes.size(); i++)
+    {
+        submeshes[i].VerticesOffset = offset = AlignOffset(offset);
+        offset += (u64)submeshes[i].VerticesCount * sizeof(vertex);
+        submeshes[i].IndicesOffset = offset = AlignOffset(offset);
+        offset += (u64)submeshes[i].IndicesCount * sizeof(u32);
+        for (u32 l = submeshes[i].FirstLod; l < submeshes[i].FirstLod + submeshes[i].LodsCount; l++)
+        {
+            lods[l].IndicesOffset = offset = AlignOffset(offset);
+            offset += (u64)lods[l].IndicesCount * sizeof(u32);
+        }
+        submeshes[i].MeshletsOffset = offset = AlignOffset(offset);
+        offset += (u64)submeshes[i].MeshletsCount * sizeof(topology::meshlet);
+    }
+
+    // File is written under temporary name and renamed after, so partially written file is never read.
+    // Temporary name is unique per thread, so same file could be cooked by several pool threads at once.
+    std::filesystem::path cooked_file_path = GetCookedMeshesPath(ModelFilePath);
+    std::filesystem::path temporary_file_path = GetTemporaryFilePath(cooked_file_path);
+    {
+        std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            SCL_CORE_WARN("Cooked mesh file \"{}\" could not be created.", cooked_file_path.string());
+            return false;
+        }
+
+        auto pad_to = [&](u64 Offset)
+        {
+            static const char zeros[COOKED_MESH_ALIGNMENT] {};
+            u64 position = (u64)file.tellp();
+            if (Offset > position) file.write(zeros, Offset - position);
+        };
+
+        file.write((const char *)&header, sizeof(header));
+        file.write((const char *)submeshes.data(), submeshes.size() * sizeof(cooked_submesh));
+        file.write(names.data(), names.size());
+        pad_to(header.LodsOffset);
+        file.write((const char *)lods.data(), lods.size() * sizeof(cooked_lod));
+        for (size_t i = 0; i < submeshes.size(); i++)
+        {
+            std::span<const vertex> vertices = Source.SubMeshes[i].GetVertices();
+            std::span<const u32> indices = Source.SubMeshes[i].GetIndices();
+            pad_to(submeshes[i].VerticesOffset);
+            file.write((const char *)vertices.data(), vertices.size_bytes());
+            pad_to(submeshes[i].IndicesOffset);
+            file.write((const char *)indices.data(), indices.size_bytes());
+            for (u32 l = 0; l < submeshes[i].LodsCount; l++)
+            {
+                std::span<const u32> lod_indices = Source.SubMeshes[i].Lods[l].GetIndices();
+                pad_to(lods[submeshes[i].FirstLod + l].IndicesOffset);
+                file.write((const char *)lod_indices.data(), lod_indices.size_bytes());
+            }
+            std::span<const topology::meshlet> meshlets = Source.SubMeshes[i].GetMeshlets();
+            pad_to(submeshes[i].MeshletsOffset);
+            file.write((const char *)meshlets.data(), meshlets.size_bytes());
+        }
+
+        if (!file.good())
+        {
+            SCL_CORE_WARN("Cooked mesh file \"{}\" writing failed.", cooked_file_path.string());
+            file.close();
+            std::filesystem::remove(temporary_file_path);
+            return false;
+        }
+    }
+
+    std::error_code error {};
+    std::filesystem::rename(temporary_file_path, cooked_file_path, error);
+    if (error)
+    {
+        SCL_CORE_WARN("Cooked mesh file \"{}\" could not be replaced: {}", cooked_file_path.string(), error.message());
+        std::filesystem::remove(temporary_file_path, error);
+        return false;
+    }
+
+    SCL_CORE_INFO("Mesh cooked to file \"{}\" ({} bytes).", cooked_file_path.string(), offset);
+    return true;
+}
+
+scl::shared<scl::assets_manager::mesh_source> scl::assets_manager::ReadCookedMeshes(const std::filesystem::path &ModelFilePath)
+{
+    std::filesystem::path cooked_file_path = GetCookedMeshesPath(ModelFilePath);
+    if (!std::filesystem::exists(cooked_file_path)) return nullptr;
+
+    shared<mapped_file> file = mapped_file::Create(cooked_file_path);
+    if (file == nullptr || file->GetSize() < sizeof(cooked_mesh_header)) return nullptr;
+
+    // Validate file format and its freshness.
+    const u8 *data = file->GetData();
+    const u64 size = file->GetSize();
+    const cooked_mesh_header &header = *(const cooked_mesh_header *)data;
+    if (memcmp(header.Magic, COOKED_MESH_MAGIC, sizeof(header.Magic)) != 0 ||
+        header.Version != COOKED_MESH_VERSION || header.VertexSize != sizeof(vertex))
+    {
+        SCL_CORE_WARN("Cooked mesh file \"{}\" has unsupported format, it will be recooked.", cooked_file_path.string());
+        return nullptr;
+    }
+    if (header.SourceWriteTime != GetWriteTime(ModelFilePath) &&
+        header.SourceHash != asset_registry::Get().GetContentHash(ModelFilePath))
+    {
+        SCL_CORE_INFO("Cooked mesh file \"{}\" is outdated, it will be recooked.", cooked_file_path.string());
+        return nullptr;
+    }
+    if (header.SubmeshesOffset + (u64)header.SubmeshesCount * sizeof(cooked_submesh) > size ||
+        header.NamesOffset + header.NamesSize > size ||
+        header.LodsOffset + (u64)header.LodsCount * sizeof(cooked_lod) > size)
+    {
+        SCL_CORE_WARN("Cooked mesh file \"{}\" is corrupted.", cooked_file_path.string());
+        return nullptr;
+    }
+
+    const cooked_submesh *submeshes = (const cooked_submesh *)(data + header.SubmeshesOffset);
+    const char *names = (const char *)(data + header.NamesOffset);
+    const cooked_lod *lods = (const cooked_lod *)(data + header.LodsOffset);
+    const std::string directory_path = ModelFilePath.parent_path().string() + '/';
+
+    // Files, model was imported with (e.g. glTF buffers), could be changed without model file change.
+    std::vector<std::string> dependency_file_names {};
+    for (u32 i = 0, offset = header.DependenciesNames; i < header.DependenciesCount; i++)
+    {
+        if (offset >= header.NamesSize)
+        {
+            SCL_CORE_WARN("Cooked mesh file \"{}\" is corrupted.", cooked_file_path.string());
+            return nullptr;
+        }
+        size_t name_size = strnlen(names + offset, header.NamesSize - offset);
+        std::string file_name(names + offset, name_size);
+        dependency_file_names.push_back((ModelFilePath.parent_path() / file_name).string());
+        offset += (u32)name_size + 1;
+    }
+    if (header.DependenciesHash != GetDependenciesHash(dependency_file_names))
+    {
+        SCL_CORE_INFO("Cooked mesh file \"{}\" is outdated (model dependencies changed), it will be recooked.", cooked_file_path.string());
+        return nullptr;
+    }
+
+    shared<mesh_source> out_mesh_source = CreateShared<mesh_source>();
+    out_mesh_source->FileName = ModelFilePath.string();
+    out_mesh_source->CookedFile = file;
+    out_mesh_source->DependencyFileNames = std::move(dependency_file_names);
+    out_mesh_source->SubMeshes.resize(header.SubmeshesCount);
+
+    auto get_name = [&](u32 Offset, bool IsNormalMap = false) -> std::string
+    {
+        if (Offset == COOKED_MESH_NO_NAME || Offset >= header.NamesSize) return "";
+        std::string file_name = directory_path + std::string(names + Offset, strnlen(names + Offset, header.NamesSize - Offset));
+        out_mesh_source->Images.emplace(file_name, nullptr);
+        if (IsNormalMap) out_mesh_source->NormalMaps.insert(file_name);
+        return file_name;
+    };
+
+    for (u32 i = 0; i < header.SubmeshesCount; i++)
+    {
+        const cooked_submesh &cooked = submeshes[i];
+        if (cooked.VerticesOffset + (u64)cooked.VerticesCount * sizeof(vertex) > size ||
+            cooked.IndicesOffset + (u64)cooked.IndicesCount * sizeof(u32) > size ||
+            cooked.MeshletsOffset + (u64)cooked.MeshletsCount * sizeof(topology::meshlet) > size)
+        {
+            SCL_CORE_WARN("Cooked mesh file \"{}\" is corrupted.", cooked_file_path.string());
+            return nullptr;
+        }
+
+        submesh_source &submesh = out_mesh_source->SubMeshes[i];
+        submesh.CookedVertices = { (const vertex *)(data + cooked.VerticesOffset), cooked.VerticesCount };
+        submesh.CookedIndices = { (const u32 *)(data + cooked.IndicesOffset), cooked.IndicesCount };
+        submesh.BoundBox = bound_box({ cooked.BoundMin[0], cooked.BoundMin[1], cooked.BoundMin[2] },
+                                     { cooked.BoundMax[0], cooked.BoundMax[1], cooked.BoundMax[2] });
+        submesh.DiffuseMapFileName  = get_name(cooked.MapsNames[0]);
+        submesh.SpecularMapFileName = get_name(cooked.MapsNames[1]);
+        submesh.EmissionMapFileName = get_name(cooked.MapsNames[2]);
+        submesh.NormalMapFileName   = get_name(cooked.MapsNames[3], true);
+
+        if ((u64)cooked.FirstLod + cooked.LodsCount > header.LodsCount)
+        {
+            SCL_CORE_WARN("Cooked mesh file \"{}\" is corrupted.", cooked_file_path.string());
+            return nullptr;
+        }
+        for (u32 l = cooked.FirstLod; l < cooked.FirstLod + cooked.LodsCount; l++)
+        {
+            if (lods[l].IndicesOffset + (u64)lods[l].IndicesCount * sizeof(u32) > size)
+            {
+                SCL_CORE_WARN("Cooked mesh file \"{}\" is corrupted.", cooked_file_path.string());
+                return nullptr;
+            }
+
+            submesh_lod_source &lod = submesh.Lods.emplace_back();
+            lod.CookedIndices = { (const u32 *)(data + lods[l].IndicesOffset), lods[l].IndicesCount };
+            lod.Error = lods[l].Error;
+        }
+
+        submesh.CookedMeshlets = { (const topology::meshlet *)(data + cooked.MeshletsOffset), cooked.MeshletsCount };
+        for (const auto &meshlet : submesh.CookedMeshlets)
+            if ((u64)meshlet.FirstIndex + meshlet.IndicesCount > cooked.IndicesCount)
+            {
+                SCL_CORE_WARN("Cooked mesh file \"{}\" is corrupted.", cooked_file_path.string());
+                return nullptr;
+            }
+    }
+
+    SCL_CORE_INFO("Mesh read from cooked file \"{}\".", cooked_file_path.string());
+    return out_mesh_source;
+}
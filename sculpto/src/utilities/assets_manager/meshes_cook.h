@@ -0,0 +1,47 @@
+/*!****************************************************************//*!*
+ * \file   meshes_cook.h
+ * \brief  Assets manager precompiled (cooked) binary mesh files functions defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl::assets_manager
+{
+    /*! Classes declaration. */
+    struct mesh_source;
+
+    /*!*
+     * Get cooked mesh file path for model file function.
+     *
+     * \param ModelFilePath - source model file path.
+     * \return cooked mesh file path (model file path with ".sclmesh" extension appended).
+     */
+    std::filesystem::path GetCookedMeshesPath(const std::filesystem::path &ModelFilePath);
+
+    /*!*
+     * Write model meshes data to cooked binary mesh file function.
+     * Cooked file stores vertices, indices, levels of detail indices and meshlets in GPU ready layout (page aligned blocks), sub-meshes bound boxes
+     * and materials texture file names (relative to model directory). Textures are not cooked.
+     *
+     * \param ModelFilePath - source model file path.
+     * \param Source - model meshes data, read from source model file.
+     * \return wheather cooked file was written or not.
+     */
+    bool CookMeshes(const std::filesystem::path &ModelFilePath, const mesh_source &Source);
+
+    /*!*
+     * Read model meshes data from cooked binary mesh file function.
+     * Cooked file is memory mapped and sub-meshes vertices and indices point directly to mapped memory.
+     * Cooked file is considered outdated if its source model file was changed since cooking.
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param ModelFilePath - source model file path.
+     * \return read mesh data pointer (nullptr if there is no valid and up to date cooked file).
+     */
+    shared<mesh_source> ReadCookedMeshes(const std::filesystem::path &ModelFilePath);
+}
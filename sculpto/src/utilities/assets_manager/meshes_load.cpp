@@ -9,17 +9,31 @@
 #include "sclpch.h"
 
 #include <assimp/Importer.hpp>
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 #include "meshes_load.h"
+#include "meshes_cook.h"
 #include "shaders_load.h"
 #include "textures_load.h"
+#include "asset_registry.h"
 #include "core/resources/mesh.h"
 #include "core/resources/vertex.h"
 #include "core/resources/materials/material_phong.h"
 #include "core/resources/topology/trimesh.h"
+#include "core/resources/topology/mesh_optimizer.h"
+#include "core/resources/topology/meshlets.h"
 #include "core/render/render_context.h"
+#include "core/render/primitives/texture.h"
+#include "utilities/image/image.h"
+#include "utilities/thread_pool/thread_pool.h"
+
+namespace scl::assets_manager
+{
+    /*! Minimal count of sub-mesh triangles to split it to meshlets. */
+    static constexpr size_t MESHLETS_MIN_TRIANGLES_COUNT = 4 * topology::MESHLET_MAX_TRIANGLES;
+}
 
 void scl::assets_manager::mesh_loader_phong::ProcessNode(aiNode *Node)
 {
@@ -27,9 +41,8 @@ void scl::assets_manager::mesh_loader_phong::ProcessNode(aiNode *Node)
     for (u32 i = 0; i < Node->mNumMeshes; i++)
     {
         aiMesh *mesh = Scene->mMeshes[Node->mMeshes[i]];
-        submesh_props<scl::vertex> generating_submesh_props;
-        GenerateSubmesh(mesh, generating_submesh_props);
-        OutSubmeshes.push_back(generating_submesh_props);
+        submesh_source &generating_submesh_source = OutMeshSource.SubMeshes.emplace_back();
+        GenerateSubmesh(mesh, generating_submesh_source);
     }
 
     // Run processing of all child nodes
@@ -37,83 +50,242 @@ void scl::assets_manager::mesh_loader_phong::ProcessNode(aiNode *Node)
         ProcessNode(Node->mChildren[i]);
 }
 
-void scl::assets_manager::mesh_loader_phong::GenerateSubmesh(aiMesh *Mesh, scl::submesh_props<scl::vertex> &OutSubmeshProps)
+void scl::assets_manager::mesh_loader_phong::GenerateSubmesh(aiMesh *Mesh, submesh_source &OutSubmeshSource)
 {
-    OutSubmeshProps.Topology.Vertices.resize(Mesh->mNumVertices);
+    std::vector<vertex> &vertices = OutSubmeshSource.Topology.Vertices;
+    vertices.resize(Mesh->mNumVertices);
     for (u32 i = 0; i < Mesh->mNumVertices; i++)
     {
-        vertex v;
+        vertex &v = vertices[i];
         v.Position  = { Mesh->mVertices[i].x,   Mesh->mVertices[i].y,   Mesh->mVertices[i].z };
         v.TexCoords = Mesh->mTextureCoords[0] ? vec2 { Mesh->mTextureCoords[0][i].x, Mesh->mTextureCoords[0][i].y } : vec2 {};
-        OutSubmeshProps.Topology.Vertices[i] = v;
+        OutSubmeshSource.BoundBox.Extend(v.Position);
     }
-    
+
+    // Faces are triangulated on import, so indices count is known beforehand.
+    std::vector<u32> &indices = OutSubmeshSource.Topology.Indices;
+    indices.reserve((size_t)Mesh->mNumFaces * 3);
     for (u32 i = 0; i < Mesh->mNumFaces; i++)
     {
         const aiFace &face = Mesh->mFaces[i];
-        for (u32 j = 0; j < face.mNumIndices; j++)
-            OutSubmeshProps.Topology.Indices.push_back(face.mIndices[j]);
+        indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+    }
+
+    OutSubmeshSource.Topology.EvaluateNormals();
+    OutSubmeshSource.Topology.EvaluateTangentSpace();
+    OptimizationReport += topology::OptimizeMesh(OutSubmeshSource.Topology);
+
+    std::vector<topology::lod_level> lods = topology::GenerateLods(OutSubmeshSource.Topology);
+    for (size_t i = 0; i < lods.size(); i++)
+    {
+        if (i >= LodsTrianglesCounts.size()) LodsTrianglesCounts.push_back(0), LodsMaxErrors.push_back(0);
+        LodsTrianglesCounts[i] += lods[i].Indices.size() / 3;
+        LodsMaxErrors[i] = math::Max(LodsMaxErrors[i], lods[i].Error);
+        OutSubmeshSource.Lods.push_back({ std::move(lods[i].Indices), {}, lods[i].Error });
     }
 
-    OutSubmeshProps.Topology.EvaluateNormals();
-    OutSubmeshProps.Topology.EvaluateTangentSpace();
-    OutSubmeshProps.Material = GenerateSubmeshMaterial(Mesh);
+    // Small sub-meshes are drawn whole, their culling would cost more than it saves.
+    if (OutSubmeshSource.Topology.Indices.size() / 3 > MESHLETS_MIN_TRIANGLES_COUNT)
+    {
+        OutSubmeshSource.Meshlets = topology::BuildMeshlets(OutSubmeshSource.Topology.Vertices, OutSubmeshSource.Topology.Indices);
+        MeshletsCount += OutSubmeshSource.Meshlets.size();
+    }
+    GenerateSubmeshMaterial(Mesh, OutSubmeshSource);
 }
 
-scl::shared<scl::material_phong> scl::assets_manager::mesh_loader_phong::GenerateSubmeshMaterial(aiMesh *Mesh)
+void scl::assets_manager::mesh_loader_phong::GenerateSubmeshMaterial(aiMesh *Mesh, submesh_source &OutSubmeshSource)
 {
-    shared<material_phong> mat = material_phong::Create(vec3 { 0.4 }, vec3 { 0 }, 1);
-    if (Mesh->mMaterialIndex < 0) return mat;
+    if (Mesh->mMaterialIndex < 0) return;
+
+    OutSubmeshSource.DiffuseMapFileName  = GenerateTexture(Mesh, aiTextureType_DIFFUSE);
+    OutSubmeshSource.SpecularMapFileName = GenerateTexture(Mesh, aiTextureType_SPECULAR);
+    OutSubmeshSource.EmissionMapFileName = GenerateTexture(Mesh, aiTextureType_EMISSIVE);
+    OutSubmeshSource.NormalMapFileName   = GenerateTexture(Mesh, aiTextureType_NORMALS);
+}
 
+std::string scl::assets_manager::mesh_loader_phong::GenerateTexture(aiMesh *Mesh, int TextureType)
+{
     aiMaterial *ai_mat = Scene->mMaterials[Mesh->mMaterialIndex];
+    if (ai_mat->GetTextureCount((aiTextureType)TextureType) == 0) return "";
+
     aiString path;
-    if (ai_mat->GetTextureCount(aiTextureType_DIFFUSE) > 0)
+    ai_mat->GetTexture((aiTextureType)TextureType, 0, &path);
+    std::string file_name = DirectoryPath + '/' + std::string(path.C_Str());
+
+    // Images are decoded after whole model is read, each only once, even if it is shared between sub-meshes.
+    OutMeshSource.Images.emplace(file_name, nullptr);
+    if (TextureType == aiTextureType_NORMALS) OutMeshSource.NormalMaps.insert(file_name);
+    return file_name;
+}
+
+size_t scl::assets_manager::mesh_source::GetTopologyBytes() const
+{
+    size_t bytes = 0;
+    for (const auto &submesh : SubMeshes)
     {
-        ai_mat->GetTexture(aiTextureType_DIFFUSE, 0, &path);
-        mat->SetDiffuseMapTexture(assets_manager::LoadTexture(DirectoryPath + '/' + std::string(path.C_Str())));
+        bytes += submesh.GetVertices().size_bytes() + submesh.GetIndices().size_bytes();
+        for (const auto &lod : submesh.Lods)
+            bytes += lod.GetIndices().size_bytes();
+        bytes += submesh.GetMeshlets().size_bytes();
     }
-    if (ai_mat->GetTextureCount(aiTextureType_SPECULAR) > 0)
+    return bytes;
+}
+
+scl::assets_manager::mesh_loader_phong::mesh_loader_phong(const aiScene *Scene,
+                                                          const std::string &DirectoryPath,
+                                                          mesh_source &OutMeshSource) :
+    Scene(Scene), DirectoryPath(DirectoryPath), OutMeshSource(OutMeshSource) {}
+
+scl::assets_manager::mesh_uploader::mesh_uploader(const shared<mesh_source> &Source) :
+    Source(Source), Mesh(mesh::Create())
+{
+    if (Source == nullptr) return;
+    Mesh->FileName = Source->FileName;
+    Mesh->SubMeshes.reserve(Source->SubMeshes.size());
+}
+
+scl::shared<scl::texture_2d> scl::assets_manager::mesh_uploader::GetTexture(const std::string &FileName)
+{
+    if (FileName.empty()) return nullptr;
+
+    auto texture = Textures.find(FileName);
+    if (texture != Textures.end()) return texture->second;
+
+    // Texture could be already loaded by other model (with same usage).
+    texture_usage usage = Source->GetTextureUsage(FileName);
+    shared<texture_2d> uploaded_texture = asset_registry::Get().Find<texture_2d>(FileName, (u64)usage);
+    if (uploaded_texture == nullptr)
     {
-        ai_mat->GetTexture(aiTextureType_SPECULAR, 0, &path);
-        mat->SetSpecularMapTexture(assets_manager::LoadTexture(DirectoryPath + '/' + std::string(path.C_Str())));
+        // Image could be not decoded, if texture was registered on model read, but freed since that.
+        auto texture_image = Source->Images.find(FileName);
+        shared<texture_source> decoded_image = texture_image != Source->Images.end() ? texture_image->second : nullptr;
+        if (decoded_image == nullptr) decoded_image = ReadTextureSource(FileName, usage);
+        if (decoded_image != nullptr) uploaded_texture = CreateTexture(FileName, *decoded_image);
     }
-    if (ai_mat->GetTextureCount(aiTextureType_EMISSIVE) > 0)
+    Textures.emplace(FileName, uploaded_texture);
+    return uploaded_texture;
+}
+
+bool scl::assets_manager::mesh_uploader::Step()
+{
+    if (IsDone()) return true;
+
+    const submesh_source &submesh = Source->SubMeshes[NextSubmeshIndex++];
+    shared<material_phong> mat = material_phong::Create(vec3 { 0.4 }, vec3 { 0 }, 1);
+    if (auto diffuse  = GetTexture(submesh.DiffuseMapFileName))  mat->SetDiffuseMapTexture(diffuse);
+    if (auto specular = GetTexture(submesh.SpecularMapFileName)) mat->SetSpecularMapTexture(specular);
+    if (auto emission = GetTexture(submesh.EmissionMapFileName)) mat->SetEmissionMapTexture(emission);
+    if (auto normal   = GetTexture(submesh.NormalMapFileName))   mat->SetNormalMapTexture(normal);
+    Mesh->AddSubmesh(submesh.GetVertices(), submesh.GetIndices(), mat, submesh.BoundBox);
+    for (const auto &lod : submesh.Lods)
+        Mesh->AddSubmeshLod(lod.GetIndices(), lod.Error);
+    if (!submesh.GetMeshlets().empty())
+        Mesh->AddSubmeshMeshlets(submesh.GetMeshlets());
+
+    if (IsDone())
     {
-        ai_mat->GetTexture(aiTextureType_EMISSIVE, 0, &path);
-        mat->SetEmissionMapTexture(assets_manager::LoadTexture(DirectoryPath + '/' + std::string(path.C_Str())));
+        // All textures are on GPU now, so CPU-side images are not needed anymore.
+        Source->Images.clear();
+        SCL_CORE_INFO("Mesh with {} sub-mesh(es) created.", Mesh->SubMeshes.size());
+        return true;
     }
-    if (ai_mat->GetTextureCount(aiTextureType_NORMALS) > 0)
+    return false;
+}
+
+namespace scl::assets_manager
+{
+    /*! Importer file system, recording all opened files (to track files, model depends on). */
+    class recording_io_system : public Assimp::DefaultIOSystem
     {
-        ai_mat->GetTexture(aiTextureType_NORMALS, 0, &path);
-        mat->SetNormalMapTexture(assets_manager::LoadTexture(DirectoryPath + '/' + std::string(path.C_Str())));
-    }
+    public:
+        std::set<std::string> OpenedFileNames {}; /*! Names of files, opened by importer. */
 
-    return mat;
+        Assimp::IOStream *Open(const char *FileName, const char *Mode = "rb") override
+        {
+            OpenedFileNames.insert(FileName);
+            return Assimp::DefaultIOSystem::Open(FileName, Mode);
+        }
+    };
 }
 
-scl::assets_manager::mesh_loader_phong::mesh_loader_phong(const aiScene *Scene,
-                                                          const std::string &DirectoryPath,
-                                                          std::vector<submesh_props<vertex>> &OutSubmeshes) :
-    Scene(Scene), DirectoryPath(DirectoryPath), OutSubmeshes(OutSubmeshes) {}
-
-scl::shared<scl::mesh> scl::assets_manager::LoadMeshes(const std::filesystem::path &ModelFilePath)
+scl::shared<scl::assets_manager::mesh_source> scl::assets_manager::ReadMeshesTopology(const std::filesystem::path &ModelFilePath)
 {
-    SCL_CORE_INFO("Mesh creation from file \"{}\" started (this may take time).", ModelFilePath.string());
+    if (shared<mesh_source> cooked_mesh_source = ReadCookedMeshes(ModelFilePath))
+        return cooked_mesh_source;
+
+    SCL_CORE_INFO("Mesh reading from file \"{}\" started (this may take time).", ModelFilePath.string());
 
     u32 flags = aiProcess_Triangulate
         | aiProcess_OptimizeMeshes
         | aiProcess_GenNormals
         | aiProcess_CalcTangentSpace;
     Assimp::Importer importer {};
+    recording_io_system *io_system = new recording_io_system(); // Importer owns its file system.
+    importer.SetIOHandler(io_system);
     const aiScene *scene = importer.ReadFile(ModelFilePath.string(), flags);
-    SCL_CORE_ASSERT(scene && (!scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) && scene->mRootNode,
-                    "Error while loading model: {}", importer.GetErrorString());
+    if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || !scene->mRootNode)
+    {
+        SCL_CORE_ERROR("Error while loading model: {}", importer.GetErrorString());
+        return nullptr;
+    }
 
-    std::vector<submesh_props<vertex>> out_submeshes;
-    mesh_loader_phong mesh_loader(scene, ModelFilePath.parent_path().string(), out_submeshes);
+    shared<mesh_source> out_mesh_source = CreateShared<mesh_source>();
+    out_mesh_source->FileName = ModelFilePath.string();
+    out_mesh_source->SubMeshes.reserve(scene->mNumMeshes);
+
+    // Files, read besides model itself, are hashed into cooked file, so their changes outdate it too.
+    std::error_code error {};
+    std::filesystem::path model_path = std::filesystem::weakly_canonical(ModelFilePath, error);
+    for (const std::string &file_name : io_system->OpenedFileNames)
+        if (std::filesystem::weakly_canonical(file_name, error) != model_path)
+            out_mesh_source->DependencyFileNames.push_back(file_name);
+
+    mesh_loader_phong mesh_loader(scene, ModelFilePath.parent_path().string(), *out_mesh_source);
     mesh_loader.ProcessNode(scene->mRootNode);
 
-    auto loaded_mesh = mesh::Create(out_submeshes);
-    loaded_mesh->FileName = ModelFilePath.string();
-    return loaded_mesh;
+    const topology::mesh_optimization_report &report = mesh_loader.GetOptimizationReport();
+    SCL_CORE_INFO("Mesh optimized: {} -> {} vertices, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}.",
+                  report.VerticesBefore, report.VerticesAfter,
+                  report.Before.GetACMR(), report.After.GetACMR(), report.Before.GetATVR(), report.After.GetATVR());
+    for (size_t i = 0; i < mesh_loader.GetLodsTrianglesCounts().size(); i++)
+        SCL_CORE_INFO("Mesh level of detail {}: {} of {} triangles, max error {}.", i + 1,
+                      mesh_loader.GetLodsTrianglesCounts()[i], report.After.TrianglesCount, mesh_loader.GetLodsMaxErrors()[i]);
+    if (mesh_loader.GetMeshletsCount() != 0)
+        SCL_CORE_INFO("Mesh split to {} meshlets.", mesh_loader.GetMeshletsCount());
+
+    // Next reads of same model will map cooked file instead of importing it again.
+    CookMeshes(ModelFilePath, *out_mesh_source);
+    return out_mesh_source;
+}
+
+scl::shared<scl::assets_manager::mesh_source> scl::assets_manager::ReadMeshes(const std::filesystem::path &ModelFilePath)
+{
+    shared<mesh_source> out_mesh_source = ReadMeshesTopology(ModelFilePath);
+    if (out_mesh_source == nullptr) return nullptr;
+
+    // All model texture images (except already loaded ones) are decoded in parallel.
+    std::vector<std::pair<shared<texture_source> *, std::future<shared<texture_source>>>> texture_reads {};
+    for (auto &[file_name, texture_image] : out_mesh_source->Images)
+    {
+        texture_usage usage = out_mesh_source->GetTextureUsage(file_name);
+        if (!asset_registry::Get().Contains<texture_2d>(file_name, (u64)usage))
+            texture_reads.emplace_back(&texture_image, thread_pool::Get().Submit([file_name, usage]() { return ReadTextureSource(file_name, usage); }));
+    }
+    for (auto &[texture_image, texture_read] : texture_reads)
+        *texture_image = texture_read.get();
+    return out_mesh_source;
+}
+
+scl::shared<scl::mesh> scl::assets_manager::LoadMeshes(const std::filesystem::path &ModelFilePath)
+{
+    if (shared<mesh> loaded_mesh = asset_registry::Get().Find<mesh>(ModelFilePath))
+        return loaded_mesh;
+
+    shared<mesh_source> source = ReadMeshes(ModelFilePath);
+    if (source == nullptr) return nullptr;
+
+    mesh_uploader uploader(source);
+    while (!uploader.Step());
+    asset_registry::Get().Add(ModelFilePath, uploader.GetMesh(), source->GetTopologyBytes());
+    return uploader.GetMesh();
 }
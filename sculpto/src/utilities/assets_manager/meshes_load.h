@@ -1,7 +1,7 @@
 /*!****************************************************************//*!*
  * \file   models_load.h
  * \brief  Assets manager model load functions defintion modulule.
- * 
+ *
  * \author Sabitov Kirill
  * \date   09 July 2022
  *********************************************************************/
@@ -9,6 +9,12 @@
 #pragma once
 
 #include "base.h"
+#include "core/resources/topology/trimesh.h"
+#include "core/resources/topology/mesh_optimizer.h"
+#include "core/resources/topology/mesh_simplifier.h"
+#include "core/resources/topology/meshlets.h"
+#include "mapped_file.h"
+#include "textures_load.h"
 
 /*! Classes definition. */
 struct aiScene;
@@ -18,32 +24,176 @@ namespace scl {
     template <typename Tvertex> struct submesh_props;
     class mesh;
     struct vertex;
+    class image;
+    class texture_2d;
     class material_phong;
 }
 
 namespace scl::assets_manager
 {
+    /*! Sub-mesh level of detail data, loaded to CPU memory (not uploaded to GPU yet) structure. */
+    struct submesh_lod_source
+    {
+        std::vector<u32> Indices {};            /*! Level of detail triangles vertices indices. */
+        std::span<const u32> CookedIndices {};  /*! Level of detail indices in cooked mesh file (empty if level was not read from cooked file). */
+        float Error {};                         /*! Level of detail maximum geometric deviation from full detail sub-mesh. */
+
+        /*! Level of detail indices (cooked or generated ones) getter function. */
+        std::span<const u32> GetIndices() const { return CookedIndices.empty() ? std::span<const u32>(Indices) : CookedIndices; }
+    };
+
+    /*! Phong lighting model sub-mesh data, loaded to CPU memory (not uploaded to GPU yet) structure. */
+    struct submesh_source
+    {
+        topology::trimesh Topology {};       /*! Submesh topology, containing its vertices and indices. */
+        std::string DiffuseMapFileName {};   /*! Material diffuse map texture file name (empty if no texture). */
+        std::string SpecularMapFileName {};  /*! Material specular map texture file name (empty if no texture). */
+        std::string EmissionMapFileName {};  /*! Material emission map texture file name (empty if no texture). */
+        std::string NormalMapFileName {};    /*! Material normal map texture file name (empty if no texture). */
+        std::span<const vertex> CookedVertices {};  /*! Sub-mesh vertices in cooked mesh file (empty if sub-mesh was not read from cooked file). */
+        std::span<const u32> CookedIndices {};      /*! Sub-mesh indices in cooked mesh file (empty if sub-mesh was not read from cooked file). */
+        bound_box BoundBox {};                      /*! Sub-mesh vertices bound box. */
+        std::vector<submesh_lod_source> Lods {};    /*! Sub-mesh levels of detail (from most to least detailed). */
+        std::vector<topology::meshlet> Meshlets {};             /*! Sub-mesh triangles clusters (empty if sub-mesh is not clustered). */
+        std::span<const topology::meshlet> CookedMeshlets {};   /*! Sub-mesh triangles clusters in cooked mesh file (empty if sub-mesh was not read from cooked file). */
+
+        /*! Sub-mesh vertices (cooked or topology ones) getter function. */
+        std::span<const vertex> GetVertices() const { return CookedVertices.empty() ? std::span<const vertex>(Topology.Vertices) : CookedVertices; }
+        /*! Sub-mesh indices (cooked or topology ones) getter function. */
+        std::span<const u32> GetIndices() const { return CookedIndices.empty() ? std::span<const u32>(Topology.Indices) : CookedIndices; }
+        /*! Sub-mesh triangles clusters (cooked or generated ones) getter function. */
+        std::span<const topology::meshlet> GetMeshlets() const { return CookedMeshlets.empty() ? std::span<const topology::meshlet>(Meshlets) : CookedMeshlets; }
+    };
+
+    /*! Phong lighting model mesh data, loaded to CPU memory (not uploaded to GPU yet) structure. */
+    struct mesh_source
+    {
+        std::string FileName {};                                      /*! File name file, from which model was loaded. */
+        std::vector<submesh_source> SubMeshes {};                     /*! Mesh sub-meshes data list. */
+        std::unordered_map<std::string, shared<texture_source>> Images {}; /*! Read sub-meshes materials textures by file name (nullptr if not read yet, failed or already loaded). */
+        std::set<std::string> NormalMaps {};                          /*! File names of sub-meshes materials textures, used as normal maps. */
+        std::vector<std::string> DependencyFileNames {};              /*! Files, read on model import besides model file (e.g. glTF buffers, OBJ materials). */
+        shared<mapped_file> CookedFile {};                            /*! Cooked mesh file, sub-meshes vertices and indices point to (nullptr if mesh was not read from cooked file). */
+
+        /*!*
+         * Sub-meshes topologies CPU memory size getter function.
+         *
+         * \param None.
+         * \return topologies size in bytes.
+         */
+        size_t GetTopologyBytes() const;
+
+        /*!*
+         * Sub-meshes material texture usage getter function.
+         *
+         * \param FileName - texture image file name.
+         * \return texture usage.
+         */
+        texture_usage GetTextureUsage(const std::string &FileName) const
+        {
+            return NormalMaps.contains(FileName) ? texture_usage::NORMAL_MAP : texture_usage::COLOR;
+        }
+    };
+
     /*! Mesh for phong lighting model loader class. */
     class mesh_loader_phong
     {
     private:
         const aiScene *Scene;
         std::mutex OutSubmeshesPushMutex;
-        std::vector<submesh_props<vertex>> &OutSubmeshes;
+        mesh_source &OutMeshSource;
         std::string DirectoryPath;
+        topology::mesh_optimization_report OptimizationReport {};
+        std::vector<size_t> LodsTrianglesCounts {};
+        std::vector<float> LodsMaxErrors {};
+        size_t MeshletsCount {};
 
-        void GenerateSubmesh(aiMesh *Mesh, submesh_props<vertex> &OutSubmeshProps);
-        shared<material_phong> GenerateSubmeshMaterial(aiMesh *Mesh);
+        void GenerateSubmesh(aiMesh *Mesh, submesh_source &OutSubmeshSource);
+        void GenerateSubmeshMaterial(aiMesh *Mesh, submesh_source &OutSubmeshSource);
+        std::string GenerateTexture(aiMesh *Mesh, int TextureType);
 
     public:
-        mesh_loader_phong(const aiScene *Scene, const std::string &DirectoryPath, std::vector<submesh_props<vertex>> &OutSubmeshes);
+        /*! All processed sub-meshes optimization report getter function. */
+        const topology::mesh_optimization_report &GetOptimizationReport() const { return OptimizationReport; }
+        /*! All processed sub-meshes triangles count of each level of detail (full detail is not counted) getter function. */
+        const std::vector<size_t> &GetLodsTrianglesCounts() const { return LodsTrianglesCounts; }
+        /*! All processed sub-meshes maximum error of each level of detail getter function. */
+        const std::vector<float> &GetLodsMaxErrors() const { return LodsMaxErrors; }
+        /*! All processed sub-meshes meshlets count getter function. */
+        size_t GetMeshletsCount() const { return MeshletsCount; }
+
+        mesh_loader_phong(const aiScene *Scene, const std::string &DirectoryPath, mesh_source &OutMeshSource);
         void ProcessNode(aiNode *Node);
 
     };
 
+    /*! Mesh source upload to GPU memory class. Performs upload sub-mesh by sub-mesh. */
+    class mesh_uploader
+    {
+    private: /*! Mesh uploader data. */
+        shared<mesh_source> Source {};                                     /*! Uploading mesh CPU-side data. */
+        shared<mesh> Mesh {};                                              /*! Mesh, to which sub-meshes are uploaded. */
+        std::unordered_map<std::string, shared<texture_2d>> Textures {};   /*! Already uploaded textures by file name. */
+        size_t NextSubmeshIndex {};                                        /*! Index of next sub-mesh to upload. */
+
+        /*!*
+         * Upload texture image to GPU or get already uploaded one function.
+         *
+         * \param FileName - texture image file name.
+         * \return texture pointer or nullptr if no texture.
+         */
+        shared<texture_2d> GetTexture(const std::string &FileName);
+
+    public:
+        /*! Uploaded mesh getter function. */
+        const shared<mesh> &GetMesh() const { return Mesh; }
+        /*! Count of sub-meshes, already uploaded to GPU getter function. */
+        size_t GetUploadedCount() const { return NextSubmeshIndex; }
+        /*! Total count of uploading sub-meshes getter function. */
+        size_t GetTotalCount() const { return Source ? Source->SubMeshes.size() : 0; }
+        /*! Is all sub-meshes uploaded flag getter function. */
+        bool IsDone() const { return NextSubmeshIndex >= GetTotalCount(); }
+
+        /*!*
+         * Mesh uploader constructor.
+         *
+         * \param Source - mesh CPU-side data to upload.
+         */
+        mesh_uploader(const shared<mesh_source> &Source);
+
+        /*!*
+         * Upload next sub-mesh to GPU function.
+         * Should be called from the thread, owning render context.
+         *
+         * \param None.
+         * \return wheather all sub-meshes uploaded or not.
+         */
+        bool Step();
+    };
+
+    /*!*
+     * Read model meshes topology and materials from file to CPU memory without decoding texture images function.
+     * Texture images list is filled with nullptr images, so they could be decoded separately (e.g. in parallel).
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param ModelFilePath - model file path.
+     * \return loaded mesh data pointer (nullptr if loading failed).
+     */
+    shared<mesh_source> ReadMeshesTopology(const std::filesystem::path &ModelFilePath);
+
+    /*!*
+     * Read model (all meshes with materials) from file to CPU memory function.
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param ModelFilePath - model file path.
+     * \return loaded mesh data pointer (nullptr if loading failed).
+     */
+    shared<mesh_source> ReadMeshes(const std::filesystem::path &ModelFilePath);
+
     /*!*
      * Load model (all meshes with materials) from file function.
-     * 
+     * Already loaded models are taken from assets registry.
+     *
      * \param ModelFilePath - model file path.
      * \return loaded mesh pointer.
      */
@@ -10,45 +10,72 @@
 #include "shaders_load.h"
 #include "shaders_preprocessor.h"
 #include "files_load.h"
+#include "hot_reload.h"
+#include "async_load.h"
 #include "core/render/primitives/shader.h"
 
-scl::shared<scl::shader_program> scl::assets_manager::LoadShader(const std::filesystem::path &ShaderProgamFilePath)
+namespace scl::assets_manager
+{
+    /*!*
+     * Read shader file and substitute its includes function.
+     *
+     * \param ShaderFilePath - shader file path.
+     * \param IncludedFiles[out] - set to add included files paths to.
+     * \return shader text.
+     */
+    static std::string ReadShaderFile(const std::filesystem::path &ShaderFilePath, std::set<std::string> &IncludedFiles)
+    {
+        std::string shader_text = LoadFile(ShaderFilePath);
+        shader_preprocessor::ProcessIncludes(ShaderFilePath.string(), ShaderFilePath.parent_path().string(), shader_text, &IncludedFiles);
+        return shader_text;
+    }
+}
+
+scl::shared<scl::shader_program> scl::assets_manager::LoadShader(const std::filesystem::path &ShaderProgamFilePath,
+                                                                 const std::vector<std::string> &Defines)
 {
     SCL_CORE_INFO("Shader creation from file \"{}\" started.", ShaderProgamFilePath.string());
 
-    std::string shader_text = LoadFile(ShaderProgamFilePath);
-    assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgamFilePath.string(), ShaderProgamFilePath.parent_path().string(), shader_text);
+    std::set<std::string> included_files {};
+    std::string shader_text = ReadShaderFile(ShaderProgamFilePath, included_files);
+    assets_manager::shader_preprocessor::AddDefines(Defines, shader_text);
 
     std::vector<shader_props> Out;
     assets_manager::shader_preprocessor::SeparateShaders(ShaderProgamFilePath.string(), shader_text, Out);
 
-    auto shader = shader_program::Create(Out, ShaderProgamFilePath.string());
+    // Variants of same shader program are named differently, so they have different program binary cache entries.
+    std::string debug_name = ShaderProgamFilePath.string();
+    if (!Defines.empty())
+    {
+        debug_name += " [";
+        for (size_t i = 0; i < Defines.size(); i++)
+            debug_name += (i == 0 ? "" : " ") + Defines[i];
+        debug_name += "]";
+    }
+
+    auto shader = shader_program::Create(Out, debug_name);
     shader->SingleSourceFileName = ShaderProgamFilePath.string();
+    shader->Defines = Defines;
+    shader->IncludedFileNames = std::move(included_files);
+    WatchShader(shader);
     return shader;
 }
 
 scl::shared<scl::shader_program> scl::assets_manager::LoadShader(const std::filesystem::path &VertexShaderFilePath,
                                                                  const std::filesystem::path &PixelShaderFilePath)
 {
-    std::stringstream file_buffer;
-    std::string shader_text;
-    std::vector<shader_props> shaders;
-
     SCL_CORE_INFO("Shader creation from files \"{}\", \"{}\" started.", VertexShaderFilePath.string(), PixelShaderFilePath.string());
 
-    // Vertex shader
-    shader_text = LoadFile(VertexShaderFilePath);
-    assets_manager::shader_preprocessor::ProcessIncludes(VertexShaderFilePath.string(), VertexShaderFilePath.parent_path().string(), shader_text);
-    shaders.push_back({ shader_type::VERTEX, shader_text });
-
-    // Fragment shader
-    shader_text = LoadFile(PixelShaderFilePath);
-    assets_manager::shader_preprocessor::ProcessIncludes(PixelShaderFilePath.string(), PixelShaderFilePath.parent_path().string(), shader_text);
-    shaders.push_back({ shader_type::PIXEL, shader_text });
+    std::set<std::string> included_files {};
+    std::vector<shader_props> shaders;
+    shaders.push_back({ shader_type::VERTEX, ReadShaderFile(VertexShaderFilePath, included_files) });
+    shaders.push_back({ shader_type::PIXEL, ReadShaderFile(PixelShaderFilePath, included_files) });
 
     auto shader = shader_program::Create(shaders, VertexShaderFilePath.string());
     shader->VertexShadersourceFileName = VertexShaderFilePath.string();
     shader->PixelShadersourceFileName = PixelShaderFilePath.string();
+    shader->IncludedFileNames = std::move(included_files);
+    WatchShader(shader);
     return shader;
 }
 
@@ -56,92 +83,63 @@ scl::shared<scl::shader_program> scl::assets_manager::LoadShader(const std::file
                                                                  const std::filesystem::path &GeomShaderFilePath,
                                                                  const std::filesystem::path &PixelShaderFilePath)
 {
-    std::stringstream file_buffer;
-    std::string shader_text;
-    std::vector<shader_props> shaders;
-
     SCL_CORE_INFO("Shader creation from files \"{}\", \"{}\", \"{}\" started.", VertexShaderFilePath.string(), GeomShaderFilePath.string(), PixelShaderFilePath.string());
 
-    // Vertex shader
-    shader_text = LoadFile(VertexShaderFilePath);
-    assets_manager::shader_preprocessor::ProcessIncludes(VertexShaderFilePath.string(), VertexShaderFilePath.parent_path().string(), shader_text);
-    shaders.push_back({ shader_type::VERTEX, shader_text });
-
-    // Geometry shader
-    shader_text = LoadFile(GeomShaderFilePath);
-    assets_manager::shader_preprocessor::ProcessIncludes(GeomShaderFilePath.string(), GeomShaderFilePath.parent_path().string(), shader_text);
-    shaders.push_back({ shader_type::GEOMETRY, shader_text });
-
-    // Fragment shader
-    shader_text = LoadFile(PixelShaderFilePath);
-    assets_manager::shader_preprocessor::ProcessIncludes(PixelShaderFilePath.string(), PixelShaderFilePath.parent_path().string(), shader_text);
-    shaders.push_back({ shader_type::PIXEL, shader_text });
+    std::set<std::string> included_files {};
+    std::vector<shader_props> shaders;
+    shaders.push_back({ shader_type::VERTEX, ReadShaderFile(VertexShaderFilePath, included_files) });
+    shaders.push_back({ shader_type::GEOMETRY, ReadShaderFile(GeomShaderFilePath, included_files) });
+    shaders.push_back({ shader_type::PIXEL, ReadShaderFile(PixelShaderFilePath, included_files) });
 
     auto shader = shader_program::Create(shaders, VertexShaderFilePath.string());
     shader->VertexShadersourceFileName = VertexShaderFilePath.string();
     shader->GeometryShadersourceFileName = GeomShaderFilePath.string();
     shader->PixelShadersourceFileName = PixelShaderFilePath.string();
+    shader->IncludedFileNames = std::move(included_files);
+    WatchShader(shader);
     return shader;
 }
 
 void scl::assets_manager::UpdateShader(shared<shader_program> ShaderProgram)
 {
-    std::stringstream file_buffer;
-    std::string shader_text;
-    std::vector<shader_props> shaders;
-
-    if (ShaderProgram->SingleSourceFileName != "") {
-        SCL_CORE_INFO("Shader updation from file \"{}\" started.", ShaderProgram->SingleSourceFileName);
-        shader_text = LoadFile(ShaderProgram->SingleSourceFileName);
-        assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgram->SingleSourceFileName,
-                                                             std::filesystem::path(ShaderProgram->SingleSourceFileName).parent_path().string(),
-                                                             shader_text);
-
-        assets_manager::shader_preprocessor::SeparateShaders(ShaderProgram->SingleSourceFileName, shader_text, shaders);
-        ShaderProgram->Update(shaders);
-    } else if (ShaderProgram->VertexShadersourceFileName != "" && ShaderProgram->PixelShadersourceFileName != "" &&
-               ShaderProgram->GeometryShadersourceFileName == "") {
-        SCL_CORE_INFO("Shader updation from files \"{}\", \"{}\" started.", ShaderProgram->VertexShadersourceFileName, ShaderProgram->PixelShadersourceFileName);
-
-        // Vertex shader
-        shader_text = LoadFile(ShaderProgram->VertexShadersourceFileName);
-        assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgram->VertexShadersourceFileName,
-                                                             std::filesystem::path(ShaderProgram->VertexShadersourceFileName).parent_path().string(),
-                                                             shader_text);
-        shaders.push_back({ shader_type::VERTEX, shader_text });
-
-        // Fragment shader
-        shader_text = LoadFile(ShaderProgram->PixelShadersourceFileName);
-        assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgram->PixelShadersourceFileName,
-                                                             std::filesystem::path(ShaderProgram->PixelShadersourceFileName).parent_path().string(),
-                                                             shader_text);
-        shaders.push_back({ shader_type::PIXEL, shader_text });
-
-        ShaderProgram->Update(shaders);
-    } else {
-        SCL_CORE_INFO("Shader creation from files \"{}\", \"{}\", \"{}\" started.", ShaderProgram->VertexShadersourceFileName, ShaderProgram->GeometryShadersourceFileName, ShaderProgram->PixelShadersourceFileName);
-
-        // Vertex shader
-        shader_text = LoadFile(ShaderProgram->VertexShadersourceFileName);
-        assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgram->VertexShadersourceFileName,
-                                                             std::filesystem::path(ShaderProgram->VertexShadersourceFileName).parent_path().string(),
-                                                             shader_text);
-        shaders.push_back({ shader_type::VERTEX, shader_text });
-
-        // Geometry shader
-        shader_text = LoadFile(ShaderProgram->GeometryShadersourceFileName);
-        assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgram->GeometryShadersourceFileName,
-                                                             std::filesystem::path(ShaderProgram->GeometryShadersourceFileName).parent_path().string(),
-                                                             shader_text);
-        shaders.push_back({ shader_type::GEOMETRY, shader_text });
-
-        // Fragment shader
-        shader_text = LoadFile(ShaderProgram->PixelShadersourceFileName);
-        assets_manager::shader_preprocessor::ProcessIncludes(ShaderProgram->PixelShadersourceFileName,
-                                                             std::filesystem::path(ShaderProgram->PixelShadersourceFileName).parent_path().string(),
-                                                             shader_text);
-        shaders.push_back({ shader_type::PIXEL, shader_text });
-
-        ShaderProgram->Update(shaders);
+    if (ShaderProgram->SingleSourceFileName == "" && ShaderProgram->VertexShadersourceFileName == "")
+    {
+        SCL_CORE_WARN("Shader \"{}\" was not loaded from files and could not be updated.", ShaderProgram->DebugName);
+        return;
     }
+
+    // Files are read and preprocessed in worker thread, program is recompiled in main thread after
+    // and replaces previous version when it is ready, so hot reload does not stall frames.
+    SCL_CORE_INFO("Shader \"{}\" updation started.", ShaderProgram->DebugName);
+    RunAsync([program = weak<shader_program>(ShaderProgram), single_source_file_name = ShaderProgram->SingleSourceFileName,
+              vertex_shader_file_name = ShaderProgram->VertexShadersourceFileName, geometry_shader_file_name = ShaderProgram->GeometryShadersourceFileName,
+              pixel_shader_file_name = ShaderProgram->PixelShadersourceFileName, defines = ShaderProgram->Defines]() -> std::function<void()>
+    {
+        std::set<std::string> included_files {};
+        std::vector<shader_props> shaders;
+
+        if (single_source_file_name != "") {
+            std::string shader_text = ReadShaderFile(single_source_file_name, included_files);
+            assets_manager::shader_preprocessor::AddDefines(defines, shader_text);
+            assets_manager::shader_preprocessor::SeparateShaders(single_source_file_name, shader_text, shaders);
+        } else if (geometry_shader_file_name == "") {
+            shaders.push_back({ shader_type::VERTEX, ReadShaderFile(vertex_shader_file_name, included_files) });
+            shaders.push_back({ shader_type::PIXEL, ReadShaderFile(pixel_shader_file_name, included_files) });
+        } else {
+            shaders.push_back({ shader_type::VERTEX, ReadShaderFile(vertex_shader_file_name, included_files) });
+            shaders.push_back({ shader_type::GEOMETRY, ReadShaderFile(geometry_shader_file_name, included_files) });
+            shaders.push_back({ shader_type::PIXEL, ReadShaderFile(pixel_shader_file_name, included_files) });
+        }
+
+        // Program could be destroyed while its files were read.
+        return [program, shaders = std::move(shaders), included_files = std::move(included_files)]()
+        {
+            shared<shader_program> shader = program.lock();
+            if (shader == nullptr) return;
+
+            shader->Update(shaders);
+            shader->IncludedFileNames = included_files;
+            WatchShader(shader);
+        };
+    });
 }
@@ -19,9 +19,10 @@ namespace scl::assets_manager
      * Load shader from file function.
      * 
      * \param ShaderProgamFilePath - file containing all shaders to compile in program.
+     * \param Defines - names of macros to define in all shaders of program (for compiling shader variants).
      * \return pointer to shader, loaded from file.
      */
-    shared<shader_program> LoadShader(const std::filesystem::path &ShaderProgamFilePath);
+    shared<shader_program> LoadShader(const std::filesystem::path &ShaderProgamFilePath, const std::vector<std::string> &Defines = {});
 
     /*!*
      * Load shader from file function.
@@ -47,6 +48,8 @@ namespace scl::assets_manager
 
     /*!*
      * Update existing shader program function.
+     * Shader files are read in worker thread, program is recompiled during UpdateAsyncLoads calls.
+     * Program keeps working previous version while new one is compiling and if new sources could not be compiled.
      * 
      * \param ShaderProgram - shader program to update.
      * \return None.
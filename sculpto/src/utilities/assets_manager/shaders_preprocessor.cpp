@@ -10,20 +10,102 @@
 #include "shaders_preprocessor.h"
 #include "files_load.h"
 
+namespace scl::assets_manager
+{
+    /*! Cached include file structure. */
+    struct include_file
+    {
+        i64 WriteTime {};   /*! File last write time on reading. */
+        std::string Text {}; /*! File text (without "#pragma once" directive). */
+        bool IsOnce {};     /*! Flag, showing wheather file is marked with "#pragma once" directive. */
+    };
+
+    /*! Parsed include files cache and its lock. */
+    static std::unordered_map<std::string, shared<include_file>> IncludeFilesCache {};
+    static std::mutex IncludeFilesCacheMutex {};
+
+    /*!*
+     * Check if character is space character function.
+     *
+     * \param Character - character to check.
+     * \return wheather character is space or not.
+     */
+    static bool IsSpace(char Character)
+    {
+        return Character == ' ' || Character == '\t' || Character == '\r' || Character == '\n';
+    }
+
+    /*!*
+     * Remove leading and trailing spaces from string function.
+     *
+     * \param Text - string to trim.
+     * \return trimmed string view.
+     */
+    static std::string_view Trim(std::string_view Text)
+    {
+        while (!Text.empty() && IsSpace(Text.front())) Text.remove_prefix(1);
+        while (!Text.empty() && IsSpace(Text.back())) Text.remove_suffix(1);
+        return Text;
+    }
+
+    /*!*
+     * Get include file from cache (reading it if it is not cached or was changed since caching) function.
+     *
+     * \param FilePath - include file path.
+     * \param LexemPragmaOnce - include once directive lexem.
+     * \return include file pointer (nullptr if file could not be read).
+     */
+    static shared<include_file> GetIncludeFile(const std::filesystem::path &FilePath, std::string_view LexemPragmaOnce)
+    {
+        std::error_code error {};
+        std::filesystem::file_time_type write_time = std::filesystem::last_write_time(FilePath, error);
+        if (error) return nullptr;
+
+        std::string key = FilePath.lexically_normal().string();
+        {
+            std::lock_guard lock(IncludeFilesCacheMutex);
+            auto it = IncludeFilesCache.find(key);
+            if (it != IncludeFilesCache.end() && it->second->WriteTime == (i64)write_time.time_since_epoch().count())
+                return it->second;
+        }
+
+        std::ifstream file(FilePath, std::ios::binary);
+        if (!file.is_open()) return nullptr;
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        // "#pragma once" directive line is removed from cached text, so it is parsed only once.
+        shared<include_file> out_include_file = CreateShared<include_file>();
+        out_include_file->WriteTime = (i64)write_time.time_since_epoch().count();
+        out_include_file->Text.reserve(text.size());
+        std::string_view rest = text;
+        while (!rest.empty())
+        {
+            size_t line_end = rest.find('\n');
+            std::string_view line = rest.substr(0, line_end == std::string_view::npos ? rest.size() : line_end + 1);
+            rest.remove_prefix(line.size());
+
+            if (!out_include_file->IsOnce && Trim(line) == LexemPragmaOnce)
+                out_include_file->IsOnce = true;
+            else
+                out_include_file->Text += line;
+        }
+
+        std::lock_guard lock(IncludeFilesCacheMutex);
+        IncludeFilesCache[key] = out_include_file;
+        return out_include_file;
+    }
+}
+
 std::string scl::assets_manager::shader_preprocessor::ReadWord(std::string::const_iterator Begin,
                                                                std::string::const_iterator End,
                                                                int *SpacesCount)
 {
     // skip spaces
-    if (SpacesCount) *SpacesCount = 0;
-    while (Begin != End && ((*Begin) == ' ' || (*Begin) == '\n'))
-    {
-        ++Begin;
-        if (SpacesCount) ++(*SpacesCount);
-    }
+    std::string::const_iterator word_begin = std::find_if_not(Begin, End, IsSpace);
+    if (SpacesCount) *SpacesCount = (int)(word_begin - Begin);
 
     // return sequence of letters from start to neares space or end of string
-    return std::string(Begin, Begin + std::min(std::string(Begin, End).find(' '), std::string(Begin, End).find('\n')));
+    return std::string(word_begin, std::find_if(word_begin, End, IsSpace));
 }
 
 scl::shader_type scl::assets_manager::shader_preprocessor::ShaderTypeFromString(const std::string &ShaderTypeString)
@@ -103,21 +185,111 @@ void scl::assets_manager::shader_preprocessor::SeparateShaders(const std::string
     }
 }
 
+void scl::assets_manager::shader_preprocessor::AppendText(const std::string &ShaderDebugName,
+                                                          const std::filesystem::path &ShaderFolderPath,
+                                                          std::string_view ShaderText, int Depth,
+                                                          std::set<std::string> &IncludedOnce,
+                                                          std::optional<std::set<std::string>> &GlobalIncludedOnce,
+                                                          std::set<std::string> *IncludedFiles,
+                                                          std::string &Out)
+{
+    const std::string_view lexem_include = shader_preprocessor::LexemInclude;
+    const std::string_view lexem_block_start = shader_preprocessor::LexemBlockStart;
+
+    // Text is processed line by line, directives are recognised only at line begining.
+    while (!ShaderText.empty())
+    {
+        size_t line_end = ShaderText.find('\n');
+        std::string_view line = ShaderText.substr(0, line_end == std::string_view::npos ? ShaderText.size() : line_end + 1);
+        ShaderText.remove_prefix(line.size());
+        std::string_view directive = Trim(line);
+
+        // Every shader block gets global block text, so its "#pragma once" files set starts from global block one.
+        if (Depth == 0 && directive.starts_with(lexem_block_start))
+        {
+            if (!GlobalIncludedOnce.has_value()) GlobalIncludedOnce = IncludedOnce;
+            IncludedOnce = *GlobalIncludedOnce;
+        }
+
+        if (!directive.starts_with(lexem_include))
+        {
+            Out += line;
+            continue;
+        }
+
+        // Read include file path from quotes.
+        std::string_view argument = Trim(directive.substr(lexem_include.size()));
+        if (argument.size() < 2 || argument.front() != '"' || argument.back() != '"')
+        {
+            SCL_CORE_ERROR("Error while preprocessing shader \"{}\".\nInvalid include directive \"{}\".", ShaderDebugName, std::string(directive));
+            continue;
+        }
+        std::filesystem::path file_path = ShaderFolderPath / std::filesystem::path(argument.substr(1, argument.size() - 2));
+
+        if (Depth >= shader_preprocessor::MaxIncludeDepth)
+        {
+            SCL_CORE_ERROR("Error while preprocessing shader \"{}\".\nInclude depth limit exceeded on file \"{}\" (recursive include?).",
+                           ShaderDebugName, file_path.string());
+            continue;
+        }
+
+        shared<include_file> file = GetIncludeFile(file_path, shader_preprocessor::LexemPragmaOnce);
+        if (file == nullptr)
+        {
+            SCL_CORE_ERROR("Error while preprocessing shader \"{}\".\nInclude file \"{}\" not found.", ShaderDebugName, file_path.string());
+            continue;
+        }
+        if (IncludedFiles != nullptr) IncludedFiles->insert(file_path.lexically_normal().string());
+        if (file->IsOnce && !IncludedOnce.insert(file_path.lexically_normal().string()).second) continue;
+
+        AppendText(ShaderDebugName, file_path.parent_path(), file->Text, Depth + 1, IncludedOnce, GlobalIncludedOnce, IncludedFiles, Out);
+        if (!Out.empty() && Out.back() != '\n') Out += '\n';
+    }
+}
+
 void scl::assets_manager::shader_preprocessor::ProcessIncludes(const std::string &ShaderDebugName,
                                                                const std::string &ShaderFolderPath,
-                                                               std::string &ShaderText)
+                                                               std::string &ShaderText,
+                                                               std::set<std::string> *IncludedFiles)
 {
-    size_t offset;
-    while ((offset = ShaderText.find(shader_preprocessor::LexemInclude, 0)) != std::string::npos)
-    {
-        ShaderText.erase(offset, strlen(shader_preprocessor::LexemInclude));
+    std::string out {};
+    out.reserve(ShaderText.size() * 2);
+
+    std::set<std::string> included_once {};
+    std::optional<std::set<std::string>> global_included_once {};
+    AppendText(ShaderDebugName, ShaderFolderPath, ShaderText, 0, included_once, global_included_once, IncludedFiles, out);
+    ShaderText = std::move(out);
+}
+
+void scl::assets_manager::shader_preprocessor::AddDefines(const std::vector<std::string> &Defines, std::string &ShaderText)
+{
+    if (Defines.empty()) return;
 
-        int spaces_count = 0;
-        std::string include_path = ReadWord(ShaderText.begin() + offset, ShaderText.end(), &spaces_count);
-        ShaderText.erase(offset, spaces_count + include_path.size());
+    std::string defines_text {};
+    for (const std::string &define : Defines)
+        defines_text += "#define " + define + "\n";
 
-        std::string file_name = std::string(include_path.begin() + 1, include_path.end() - 1);
-        std::filesystem::path file_path = ShaderFolderPath / std::filesystem::path(file_name);
-        ShaderText.insert(offset, LoadFile(file_path));
+    // "#version" directive should be first in shader, so definitions follow it.
+    size_t offset = 0;
+    std::string_view text = ShaderText;
+    while (offset < text.size())
+    {
+        size_t line_end = text.find('\n', offset);
+        std::string_view line = text.substr(offset, line_end == std::string_view::npos ? std::string_view::npos : line_end - offset);
+        if (Trim(line).starts_with(shader_preprocessor::LexemVersion))
+        {
+            ShaderText.insert(line_end == std::string::npos ? ShaderText.size() : line_end + 1,
+                              line_end == std::string::npos ? "\n" + defines_text : defines_text);
+            return;
+        }
+        if (line_end == std::string_view::npos) break;
+        offset = line_end + 1;
     }
+    ShaderText.insert(0, defines_text);
+}
+
+void scl::assets_manager::shader_preprocessor::ClearIncludeFilesCache()
+{
+    std::lock_guard lock(IncludeFilesCacheMutex);
+    IncludeFilesCache.clear();
 }
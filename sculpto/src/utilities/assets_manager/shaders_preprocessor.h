@@ -21,6 +21,11 @@ namespace scl::assets_manager
         static constexpr const char *LexemBlockStart = "#shader-begin";
         static constexpr const char *LexemBlockEnd = "#shader-end";
         static constexpr const char *LexemInclude = "#include";
+        static constexpr const char *LexemPragmaOnce = "#pragma once";
+        static constexpr const char *LexemVersion = "#version";
+
+        /*! Maximal depth of nested includes (deeper includes are considered recursive). */
+        static constexpr int MaxIncludeDepth = 32;
 
         /*!*
          * Read word from string, starting at Begin iterator function.
@@ -40,6 +45,24 @@ namespace scl::assets_manager
          */
         static shader_type ShaderTypeFromString(const std::string &ShaderTypeString);
 
+        /*!*
+         * Append shader text with include directives substituted to output buffer function.
+         *
+         * \param ShaderDebugName - debug name to show if error occures.
+         * \param ShaderFolderPath - path to folder, include paths are relative to (folder of file, containing text).
+         * \param ShaderText - text to process.
+         * \param Depth - current include depth (0 for shader file itself).
+         * \param IncludedOnce[in, out] - already included files, marked with "#pragma once", of current shader block.
+         * \param GlobalIncludedOnce[in, out] - already included files, marked with "#pragma once", of shader global block (set on first block begin).
+         * \param IncludedFiles[out] - all included files paths (could be nullptr).
+         * \param Out - output buffer.
+         * \return None.
+         */
+        static void AppendText(const std::string &ShaderDebugName, const std::filesystem::path &ShaderFolderPath,
+                               std::string_view ShaderText, int Depth,
+                               std::set<std::string> &IncludedOnce, std::optional<std::set<std::string>> &GlobalIncludedOnce,
+                               std::set<std::string> *IncludedFiles, std::string &Out);
+
     public:
         /*!*
          * Separate text to diffrent shader blocks function.
@@ -52,12 +75,35 @@ namespace scl::assets_manager
 
         /*!*
          * Process include directives in shader text.
+         * Text is processed in single pass, nested include paths are relative to including file folder. Included files are cached in memory (and reread only if they were changed),
+         * files, marked with "#pragma once", are included only once per shader block (global block includes are shared by all blocks).
          * 
          * \param ShaderDebugName - debug name to show if error occures.
          * \param ShaderFolderPath - path to folder where shalder is located.
          * \param ShaderText[in, out] - text of shader to process.
+         * \param IncludedFiles[out] - set to add all (directly and indirectly) included files paths to (for dependencies tracking, could be nullptr).
+         * \return None.
+         */
+        static void ProcessIncludes(const std::string &ShaderDebugName, const std::string &ShaderFolderPath, std::string &ShaderText,
+                                    std::set<std::string> *IncludedFiles = nullptr);
+
+        /*!*
+         * Add macros definitions to shader text function.
+         * Definitions are inserted right after "#version" directive (or at text begining if there is no one).
+         *
+         * \param Defines - names of macros to define.
+         * \param ShaderText[in, out] - text of shader to add definitions to.
+         * \return None.
+         */
+        static void AddDefines(const std::vector<std::string> &Defines, std::string &ShaderText);
+
+        /*!*
+         * Clear included files cache function.
+         * Next include of each file reads it from disk again.
+         *
+         * \param None.
          * \return None.
          */
-        static void ProcessIncludes(const std::string &ShaderDebugName, const std::string &ShaderFolderPath, std::string &ShaderText);
+        static void ClearIncludeFilesCache();
     };
 }
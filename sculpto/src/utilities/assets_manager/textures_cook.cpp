@@ -0,0 +1,205 @@
+/*!****************************************************************//*!*
+ * \file   textures_cook.cpp
+ * \brief  Assets manager precompiled (cooked) texture files functions implementation modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "textures_cook.h"
+#include "mapped_file.h"
+#include "files_load.h"
+#include "asset_registry.h"
+
+namespace scl::assets_manager
+{
+    /*! Cooked texture file format constants. */
+    static constexpr char COOKED_TEXTURE_MAGIC[8] = "SCLTEX";
+    static constexpr u32 COOKED_TEXTURE_VERSION = 1;
+    static constexpr u64 COOKED_TEXTURE_ALIGNMENT = 16;
+
+    /*! Cooked texture file header structure. */
+    struct cooked_texture_header
+    {
+        char Magic[8];           /*! File format magic string. */
+        u32 Version;             /*! File format version. */
+        u32 Usage;               /*! Texture usage, file was cooked for. */
+        i64 SourceWriteTime;     /*! Source image file last write time on cooking. */
+        u64 SourceHash;          /*! Source image file content hash on cooking. */
+        u32 Compression;         /*! Mip levels compression type. */
+        u32 ComponentsCount;     /*! Components per pixel count of uncompressed levels. */
+        u32 LevelsCount;         /*! Count of mip levels. */
+        u32 __dummy;
+        u64 LevelsOffset;        /*! Mip levels table offset from file begining. */
+    };
+
+    /*! Cooked texture file mip level table entry structure. */
+    struct cooked_texture_level
+    {
+        u64 DataOffset;          /*! Level data block offset from file begining. */
+        u64 DataSize;            /*! Level data size in bytes. */
+        i32 Width;               /*! Level width in pixels. */
+        i32 Height;              /*! Level height in pixels. */
+    };
+
+    /*!*
+     * Get file last write time as integer function.
+     *
+     * \param FilePath - file path.
+     * \return file last write time (0 if file is not available).
+     */
+    static i64 GetWriteTime(const std::filesystem::path &FilePath)
+    {
+        std::error_code error {};
+        std::filesystem::file_time_type write_time = std::filesystem::last_write_time(FilePath, error);
+        return error ? 0 : (i64)write_time.time_since_epoch().count();
+    }
+
+    /*!*
+     * Align offset up to cooked file blocks alignment function.
+     *
+     * \param Offset - offset to align.
+     * \return aligned offset.
+     */
+    static u64 AlignOffset(u64 Offset)
+    {
+        return (Offset + COOKED_TEXTURE_ALIGNMENT - 1) / COOKED_TEXTURE_ALIGNMENT * COOKED_TEXTURE_ALIGNMENT;
+    }
+}
+
+std::filesystem::path scl::assets_manager::GetCookedTexturePath(const std::filesystem::path &TextureImageFilePath, texture_usage Usage)
+{
+    std::filesystem::path cooked_file_path = TextureImageFilePath;
+    cooked_file_path += Usage == texture_usage::NORMAL_MAP ? ".normal.scltex" : ".color.scltex";
+    return cooked_file_path;
+}
+
+bool scl::assets_manager::CookTexture(const std::filesystem::path &TextureImageFilePath, texture_usage Usage, const texture_source &Source)
+{
+    cooked_texture_header header {};
+    memcpy(header.Magic, COOKED_TEXTURE_MAGIC, sizeof(header.Magic));
+    header.Version = COOKED_TEXTURE_VERSION;
+    header.Usage = (u32)Usage;
+    header.SourceWriteTime = GetWriteTime(TextureImageFilePath);
+    header.SourceHash = asset_registry::Get().GetContentHash(TextureImageFilePath);
+    header.Compression = (u32)Source.Data.Compression;
+    header.ComponentsCount = (u32)Source.Data.ComponentsCount;
+    header.LevelsCount = (u32)Source.Data.Levels.size();
+    header.LevelsOffset = sizeof(cooked_texture_header);
+
+    // Layout mip levels data blocks.
+    std::vector<cooked_texture_level> levels(Source.Data.Levels.size());
+    u64 offset = header.LevelsOffset + levels.size() * sizeof(cooked_texture_level);
+    for (size_t i = 0; i < levels.size(); i++)
+    {
+        const texture_level &level = Source.Data.Levels[i];
+        levels[i].DataOffset = offset = AlignOffset(offset);
+        levels[i].DataSize = level.Data.size();
+        levels[i].Width = level.Width;
+        levels[i].Height = level.Height;
+        offset += level.Data.size();
+    }
+
+    // File is written under temporary name and renamed after, so partially written file is never read.
+    // Temporary name is unique per thread, so same file could be cooked by several pool threads at once.
+    std::filesystem::path cooked_file_path = GetCookedTexturePath(TextureImageFilePath, Usage);
+    std::filesystem::path temporary_file_path = GetTemporaryFilePath(cooked_file_path);
+    {
+        std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            SCL_CORE_WARN("Cooked texture file \"{}\" could not be created.", cooked_file_path.string());
+            return false;
+        }
+
+        auto pad_to = [&](u64 Offset)
+        {
+            static const char zeros[COOKED_TEXTURE_ALIGNMENT] {};
+            u64 position = (u64)file.tellp();
+            if (Offset > position) file.write(zeros, Offset - position);
+        };
+
+        file.write((const char *)&header, sizeof(header));
+        file.write((const char *)levels.data(), levels.size() * sizeof(cooked_texture_level));
+        for (size_t i = 0; i < levels.size(); i++)
+        {
+            pad_to(levels[i].DataOffset);
+            file.write((const char *)Source.Data.Levels[i].Data.data(), Source.Data.Levels[i].Data.size());
+        }
+
+        if (!file.good())
+        {
+            SCL_CORE_WARN("Cooked texture file \"{}\" writing failed.", cooked_file_path.string());
+            file.close();
+            std::filesystem::remove(temporary_file_path);
+            return false;
+        }
+    }
+
+    std::error_code error {};
+    std::filesystem::rename(temporary_file_path, cooked_file_path, error);
+    if (error)
+    {
+        SCL_CORE_WARN("Cooked texture file \"{}\" could not be replaced: {}", cooked_file_path.string(), error.message());
+        std::filesystem::remove(temporary_file_path, error);
+        return false;
+    }
+
+    SCL_CORE_INFO("Texture cooked to file \"{}\" ({} mip levels, {} bytes).", cooked_file_path.string(), levels.size(), offset);
+    return true;
+}
+
+scl::shared<scl::assets_manager::texture_source> scl::assets_manager::ReadCookedTexture(const std::filesystem::path &TextureImageFilePath,
+                                                                                        texture_usage Usage)
+{
+    std::filesystem::path cooked_file_path = GetCookedTexturePath(TextureImageFilePath, Usage);
+    if (!std::filesystem::exists(cooked_file_path)) return nullptr;
+
+    shared<mapped_file> file = mapped_file::Create(cooked_file_path);
+    if (file == nullptr || file->GetSize() < sizeof(cooked_texture_header)) return nullptr;
+
+    // Validate file format and its freshness.
+    const u8 *data = file->GetData();
+    const u64 size = file->GetSize();
+    const cooked_texture_header &header = *(const cooked_texture_header *)data;
+    if (memcmp(header.Magic, COOKED_TEXTURE_MAGIC, sizeof(header.Magic)) != 0 || header.Version != COOKED_TEXTURE_VERSION ||
+        header.Compression > (u32)texture_compression::BC5)
+    {
+        SCL_CORE_WARN("Cooked texture file \"{}\" has unsupported format, it will be recooked.", cooked_file_path.string());
+        return nullptr;
+    }
+    if (header.Usage != (u32)Usage ||
+        (header.SourceWriteTime != GetWriteTime(TextureImageFilePath) &&
+         header.SourceHash != asset_registry::Get().GetContentHash(TextureImageFilePath)))
+    {
+        SCL_CORE_INFO("Cooked texture file \"{}\" is outdated, it will be recooked.", cooked_file_path.string());
+        return nullptr;
+    }
+    if (header.LevelsCount == 0 || header.LevelsOffset + (u64)header.LevelsCount * sizeof(cooked_texture_level) > size)
+    {
+        SCL_CORE_WARN("Cooked texture file \"{}\" is corrupted.", cooked_file_path.string());
+        return nullptr;
+    }
+
+    const cooked_texture_level *levels = (const cooked_texture_level *)(data + header.LevelsOffset);
+    shared<texture_source> out_texture_source = CreateShared<texture_source>();
+    out_texture_source->CookedFile = file;
+    out_texture_source->Usage = Usage;
+    out_texture_source->Data.Compression = (texture_compression)header.Compression;
+    out_texture_source->Data.ComponentsCount = (int)header.ComponentsCount;
+    for (u32 i = 0; i < header.LevelsCount; i++)
+    {
+        if (levels[i].DataOffset + levels[i].DataSize > size || levels[i].Width <= 0 || levels[i].Height <= 0)
+        {
+            SCL_CORE_WARN("Cooked texture file \"{}\" is corrupted.", cooked_file_path.string());
+            return nullptr;
+        }
+        out_texture_source->Data.Levels.push_back({ levels[i].Width, levels[i].Height,
+                                                    { data + levels[i].DataOffset, (size_t)levels[i].DataSize } });
+    }
+
+    SCL_CORE_INFO("Texture read from cooked file \"{}\".", cooked_file_path.string());
+    return out_texture_source;
+}
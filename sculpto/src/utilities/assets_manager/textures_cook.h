@@ -0,0 +1,48 @@
+/*!****************************************************************//*!*
+ * \file   textures_cook.h
+ * \brief  Assets manager precompiled (cooked) texture files functions defintion modulule.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+#include "textures_load.h"
+
+namespace scl::assets_manager
+{
+    /*!*
+     * Get cooked texture file path for texture image file function.
+     * Usage is part of the path, so same image, used as color texture and as normal map, has two cooked files.
+     *
+     * \param TextureImageFilePath - source texture image file path.
+     * \param Usage - texture usage.
+     * \return cooked texture file path (image file path with ".color.scltex" or ".normal.scltex" extension appended).
+     */
+    std::filesystem::path GetCookedTexturePath(const std::filesystem::path &TextureImageFilePath, texture_usage Usage);
+
+    /*!*
+     * Write texture mip levels to cooked texture file function.
+     * Cooked file stores all mip levels (block compressed) in GPU ready layout, so they are uploaded without processing.
+     *
+     * \param TextureImageFilePath - source texture image file path.
+     * \param Usage - texture usage, source was created for.
+     * \param Source - texture data, created from source image.
+     * \return wheather cooked file was written or not.
+     */
+    bool CookTexture(const std::filesystem::path &TextureImageFilePath, texture_usage Usage, const texture_source &Source);
+
+    /*!*
+     * Read texture mip levels from cooked texture file function.
+     * Cooked file is memory mapped and mip levels point directly to mapped memory.
+     * Cooked file is considered outdated if its source image file was changed since cooking or it was cooked for other usage.
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param TextureImageFilePath - source texture image file path.
+     * \param Usage - texture usage.
+     * \return read texture source pointer (nullptr if there is no valid and up to date cooked file).
+     */
+    shared<texture_source> ReadCookedTexture(const std::filesystem::path &TextureImageFilePath, texture_usage Usage);
+}
@@ -8,22 +8,96 @@
 
 #include "sclpch.h"
 #include "textures_load.h"
+#include "textures_cook.h"
+#include "asset_registry.h"
+#include "hot_reload.h"
 #include "core/render/render_context.h"
 #include "core/render/primitives/texture.h"
+#include "utilities/image/image_mips.h"
+#include "utilities/image/image_compress.h"
 
-scl::shared<scl::texture_2d> scl::assets_manager::LoadTexture(const std::filesystem::path &TextureImageFilePath)
+size_t scl::assets_manager::texture_source::GetBytes() const
 {
-    SCL_CORE_INFO("Texture creation from file \"{}\" started.", TextureImageFilePath.string());
+    size_t bytes = 0;
+    for (const auto &level : Data.Levels)
+        bytes += level.Data.size();
+    return bytes;
+}
 
-    image texture_image(TextureImageFilePath.string());
-    if (texture_image.IsEmpty())
+scl::shared<scl::image> scl::assets_manager::ReadTextureImage(const std::filesystem::path &TextureImageFilePath)
+{
+    // OpenGL textures rows go from bottom to top, so image is flipped by decoder.
+    bool is_flip = render_context::GetApi() == render_context_api::OpenGL;
+    shared<image> texture_image = CreateShared<image>(TextureImageFilePath.string(), is_flip);
+    if (texture_image->IsEmpty())
     {
         SCL_CORE_ERROR("Texture \"{}\" not found!", TextureImageFilePath.string());
         return nullptr;
     }
+    return texture_image;
+}
+
+scl::shared<scl::assets_manager::texture_source> scl::assets_manager::CreateTextureSource(const image &TextureImage, texture_usage Usage)
+{
+    std::vector<image_mip> mips = GenerateImageMips(TextureImage, Usage == texture_usage::NORMAL_MAP);
+    if (mips.empty()) return nullptr;
+
+    shared<texture_source> out_texture_source = CreateShared<texture_source>();
+    out_texture_source->Usage = Usage;
+    texture_data &data = out_texture_source->Data;
+    data.ComponentsCount = 4;
+    data.Compression = Usage == texture_usage::NORMAL_MAP ? texture_compression::BC5 :
+                       IsImageOpaque(mips[0]) ? texture_compression::BC1 : texture_compression::BC3;
+
+    // All levels are compressed to single storage, so it is allocated before levels views are taken.
+    std::vector<size_t> offsets(mips.size());
+    size_t size = 0;
+    for (size_t i = 0; i < mips.size(); i++)
+        offsets[i] = size, size += GetCompressedImageSize(mips[i].Width, mips[i].Height, data.Compression);
+    out_texture_source->Storage.resize(size);
+
+    for (size_t i = 0; i < mips.size(); i++)
+    {
+        u8 *level_data = out_texture_source->Storage.data() + offsets[i];
+        CompressImage(mips[i], data.Compression, level_data);
+        data.Levels.push_back({ mips[i].Width, mips[i].Height,
+                                { level_data, GetCompressedImageSize(mips[i].Width, mips[i].Height, data.Compression) } });
+    }
+    return out_texture_source;
+}
 
-    if (render_context::GetApi() == render_context_api::OpenGL)
-        texture_image.FlipHorizontaly();
+scl::shared<scl::assets_manager::texture_source> scl::assets_manager::ReadTextureSource(const std::filesystem::path &TextureImageFilePath,
+                                                                                        texture_usage Usage)
+{
+    if (shared<texture_source> cooked_texture_source = ReadCookedTexture(TextureImageFilePath, Usage))
+        return cooked_texture_source;
+
+    shared<image> texture_image = ReadTextureImage(TextureImageFilePath);
+    if (texture_image == nullptr) return nullptr;
+
+    shared<texture_source> out_texture_source = CreateTextureSource(*texture_image, Usage);
+    if (out_texture_source == nullptr) return nullptr;
+
+    // Next reads of same texture will map cooked file instead of decoding and compressing image again.
+    CookTexture(TextureImageFilePath, Usage, *out_texture_source);
+    return out_texture_source;
+}
+
+scl::shared<scl::texture_2d> scl::assets_manager::CreateTexture(const std::filesystem::path &TextureImageFilePath, const texture_source &TextureSource)
+{
+    shared<texture_2d> texture = texture_2d::Create(TextureSource.Data);
+    asset_registry::Get().Add(TextureImageFilePath, texture, TextureSource.GetBytes(), (u64)TextureSource.Usage);
+    WatchTexture(texture, TextureImageFilePath, TextureSource.Usage);
+    return texture;
+}
+
+scl::shared<scl::texture_2d> scl::assets_manager::LoadTexture(const std::filesystem::path &TextureImageFilePath, texture_usage Usage)
+{
+    if (shared<texture_2d> loaded_texture = asset_registry::Get().Find<texture_2d>(TextureImageFilePath, (u64)Usage))
+        return loaded_texture;
+    SCL_CORE_INFO("Texture creation from file \"{}\" started.", TextureImageFilePath.string());
 
-    return texture_2d::Create(texture_image, texture_type::COLOR);
+    shared<texture_source> read_texture_source = ReadTextureSource(TextureImageFilePath, Usage);
+    if (read_texture_source == nullptr) return nullptr;
+    return CreateTexture(TextureImageFilePath, *read_texture_source);
 }
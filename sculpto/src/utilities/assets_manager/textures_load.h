@@ -9,16 +9,91 @@
 #pragma once
 
 #include "base.h"
-
-namespace scl { class texture_2d; }
+#include "core/render/primitives/texture.h"
+#include "mapped_file.h"
 
 namespace scl::assets_manager
 {
+    /*! Texture usage types (affects mip levels filtering and compression) enum class. */
+    enum class texture_usage
+    {
+        COLOR,        /*! sRGB encoded color texture, compressed to BC1 (opaque) or BC3 (with alpha). */
+        NORMAL_MAP,   /*! Tangent space normal map, compressed to BC5 (only X and Y are stored). */
+    };
+
+    /*! Texture data with all mip levels, loaded to CPU memory (not uploaded to GPU yet) structure. */
+    struct texture_source
+    {
+        texture_data Data {};                 /*! Texture mip levels (point to storage or cooked texture file). */
+        std::vector<u8> Storage {};           /*! Generated mip levels data (empty if texture was read from cooked file). */
+        shared<mapped_file> CookedFile {};    /*! Cooked texture file, mip levels point to (nullptr if texture was not read from cooked file). */
+        texture_usage Usage {};               /*! Texture usage, mip levels were created for. */
+
+        /*! Texture source default constructor. */
+        texture_source() = default;
+
+        /*! Texture source is not copyable, because its levels point to its own storage. */
+        texture_source(const texture_source &Other) = delete;
+        texture_source &operator=(const texture_source &Other) = delete;
+
+        /*!*
+         * Texture mip levels CPU memory size getter function.
+         *
+         * \param None.
+         * \return mip levels size in bytes.
+         */
+        size_t GetBytes() const;
+    };
+
+    /*!*
+     * Read texture image from file to CPU memory function.
+     * Image is flipped according to render API textures orientation.
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param TextureImageFilePath - texture image file path.
+     * \return loaded image pointer (nullptr if loading failed).
+     */
+    shared<image> ReadTextureImage(const std::filesystem::path &TextureImageFilePath);
+
+    /*!*
+     * Create texture mip levels, block compressed according to texture usage, from image function.
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param TextureImage - texture image.
+     * \param Usage - texture usage.
+     * \return created texture source pointer.
+     */
+    shared<texture_source> CreateTextureSource(const image &TextureImage, texture_usage Usage);
+
+    /*!*
+     * Read texture with all mip levels to CPU memory function.
+     * Cooked texture file is used if it is up to date, otherwise image is decoded, processed and cooked.
+     * Performs no render context calls, so could be called from any thread.
+     *
+     * \param TextureImageFilePath - texture image file path.
+     * \param Usage - texture usage.
+     * \return read texture source pointer (nullptr if reading failed).
+     */
+    shared<texture_source> ReadTextureSource(const std::filesystem::path &TextureImageFilePath, texture_usage Usage = texture_usage::COLOR);
+
+    /*!*
+     * Create texture from texture source, read from file, and register it in assets registry function.
+     * Texture image file is watched, so texture is updated on its change (see hot_reload.h).
+     * Should be called from the thread, owning render context.
+     *
+     * \param TextureImageFilePath - texture image file path.
+     * \param TextureSource - texture source, read from file.
+     * \return created texture pointer.
+     */
+    shared<texture_2d> CreateTexture(const std::filesystem::path &TextureImageFilePath, const texture_source &TextureSource);
+
     /*!*
      * Texture load from file function.
+     * Already loaded textures are taken from assets registry.
      * 
      * \param TextureImageFilePath - texture image file path.
+     * \param Usage - texture usage.
      * \return loaded texture pointer.
      */
-    shared<texture_2d> LoadTexture(const std::filesystem::path &TextureImageFilePath);
+    shared<texture_2d> LoadTexture(const std::filesystem::path &TextureImageFilePath, texture_usage Usage = texture_usage::COLOR);
 }
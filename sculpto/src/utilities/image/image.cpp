@@ -0,0 +1,118 @@
+/*!****************************************************************//*!*
+ * \file   image.cpp
+ * \brief  Image container class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include <stb_image.h>
+/*! MSVC compiles SSSE3 intrinsics without architecture flags, so x64 builds check CPU support at runtime. */
+#if defined(__SSSE3__) || defined(__AVX__) || defined(_M_X64)
+#   include <tmmintrin.h>
+#   define SCL_IMAGE_SSSE3
+#   if !defined(__SSSE3__) && !defined(__AVX__)
+#       include <intrin.h>
+#   endif
+#endif /*! __SSSE3__ || __AVX__ || _M_X64 */
+
+#include "image.h"
+
+#ifdef SCL_IMAGE_SSSE3
+namespace scl
+{
+    /*!*
+     * Check if SSSE3 instructions are supported by CPU function.
+     *
+     * \param None.
+     * \return wheather SSSE3 is supported or not.
+     */
+    static bool IsSSSE3Supported()
+    {
+#if defined(__SSSE3__) || defined(__AVX__)
+        return true;
+#else
+        static const bool is_supported = []()
+        {
+            int cpu_info[4] {};
+            __cpuid(cpu_info, 1);
+            return (cpu_info[2] & (1 << 9)) != 0;
+        }();
+        return is_supported;
+#endif /*! __SSSE3__ || __AVX__ */
+    }
+}
+#endif /*! SCL_IMAGE_SSSE3 */
+
+bool scl::image::Load(const std::string &FileName, bool IsFlipVertically)
+{
+    Free();
+
+    // Flip is done by decoder while writing rows, so loaded image needs no additional pass.
+    // Flag is thread local, so images could be decoded from several threads at once.
+    int w, h, c;
+    stbi_set_flip_vertically_on_load_thread(IsFlipVertically);
+    Data = stbi_load(FileName.c_str(), &w, &h, &c, 0);
+    stbi_set_flip_vertically_on_load_thread(false);
+    if (Data == nullptr)
+    {
+        SCL_CORE_ERROR("Error during loading image from file \"{}\": {}!", FileName, stbi_failure_reason());
+        return false;
+    }
+
+    // If image loaded successful, set image data
+    Width = w, Height = h, ComponentsCount = c;
+    return true;
+}
+
+void scl::image::FlipVertically()
+{
+    if (Data == nullptr) return;
+
+    const size_t row_size = (size_t)Width * ComponentsCount;
+    for (size_t i = 0; i < (size_t)Height / 2; i++)
+    {
+        u8 *top = Data + i * row_size, *bottom = Data + (Height - i - 1) * row_size;
+        std::swap_ranges(top, top + row_size, bottom);
+    }
+}
+
+void scl::image::ExpandPixelsToRGBA(const u8 *Source, u8 *Destination, size_t PixelsCount, int ComponentsCount)
+{
+    if (ComponentsCount == 4)
+    {
+        memmove(Destination, Source, PixelsCount * 4);
+        return;
+    }
+
+    // Pixels are expanded from last to first, so destination pixel never overwrites not expanded source pixels.
+    size_t p = PixelsCount;
+#ifdef SCL_IMAGE_SSSE3
+    if (ComponentsCount == 3 && Source != Destination && IsSSSE3Supported())
+    {
+        // 16 bytes are read for 4 source pixels (12 bytes), so last pixels are expanded without SIMD.
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+        size_t simd_pixels_count = PixelsCount >= 6 ? (PixelsCount - 2) / 4 * 4 : 0;
+        for (size_t s = 0; s < simd_pixels_count; s += 4)
+        {
+            __m128i rgb = _mm_loadu_si128((const __m128i *)(Source + s * 3));
+            _mm_storeu_si128((__m128i *)(Destination + s * 4), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+        }
+        Source += simd_pixels_count * 3, Destination += simd_pixels_count * 4, p -= simd_pixels_count;
+    }
+#endif /*! SCL_IMAGE_SSSE3 */
+
+    while (p-- > 0)
+    {
+        const u8 *src = Source + p * ComponentsCount;
+        u8 *dst = Destination + p * 4;
+        u8 r = src[0];
+        u8 g = ComponentsCount >= 3 ? src[1] : r;
+        u8 b = ComponentsCount >= 3 ? src[2] : r;
+        u8 a = ComponentsCount == 2 ? src[1] : 255;
+        dst[0] = r, dst[1] = g, dst[2] = b, dst[3] = a;
+    }
+}
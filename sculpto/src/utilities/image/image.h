@@ -8,13 +8,14 @@
 
 #pragma once
 
-#include <stb_image.h>
-
 #include "base.h"
 
 namespace scl
 {
-    /*! Image container class. */
+    /*!*
+     * Image container class.
+     * Pixels buffer is always allocated with malloc (same allocator stb_image uses for decoded images) and freed with free.
+     */
     class image
     {
     private: /*! Image data. */
@@ -31,6 +32,8 @@ namespace scl
         int GetComponentsCount() const { return ComponentsCount; }
         /*! Image raw data pointer getter function. */
         const u8 *GetRawData() const { return Data; }
+        /*! Image raw data size in bytes getter function. */
+        size_t GetSize() const { return (size_t)Width * Height * ComponentsCount; }
 
         /*!*
          * Check if image container filled with pixels function.
@@ -47,30 +50,41 @@ namespace scl
         /*! Image copy constructor. */
         image(const image &Other)
         {
-            if (Other.Data == nullptr) return;
-
-            Width = Other.Width;
-            Height = Other.Height;
-            ComponentsCount = Other.ComponentsCount;
+            *this = Other;
+        }
 
-            size_t size = (size_t)Width * Height * ComponentsCount;
-            Data = new u8[size];
-            memcpy(Data, Other.Data, size);
+        /*! Image move constructor. */
+        image(image &&Other) noexcept
+        {
+            *this = std::move(Other);
         }
 
         /*! Image copy assigment operator. */
-        image &operator= (const image &Other)
+        image &operator=(const image &Other)
         {
-            if (this == &Other || Other.Data == nullptr) return *this;
-            if (Data != nullptr) delete[] Data;
+            if (this == &Other) return *this;
 
+            Free();
             Width = Other.Width;
             Height = Other.Height;
             ComponentsCount = Other.ComponentsCount;
+            if (Other.Data == nullptr) return *this;
 
-            size_t size = (size_t)Width * Height * ComponentsCount;
-            Data = new u8[size];
-            memcpy(Data, Other.Data, size);
+            Allocate();
+            memcpy(Data, Other.Data, GetSize());
+            return *this;
+        }
+
+        /*! Image move assigment operator. */
+        image &operator=(image &&Other) noexcept
+        {
+            if (this == &Other) return *this;
+
+            Free();
+            std::swap(Width, Other.Width);
+            std::swap(Height, Other.Height);
+            std::swap(ComponentsCount, Other.ComponentsCount);
+            std::swap(Data, Other.Data);
             return *this;
         }
 
@@ -99,19 +113,19 @@ namespace scl
         image(int Width, int Height, int ComponentsCount, void *Data) :
             Width(Width), Height(Height), ComponentsCount(ComponentsCount)
         {
-            size_t size = (size_t)Width * Height * ComponentsCount;
-            this->Data = new u8[size];
-            memcpy(this->Data, Data, size);
+            Allocate();
+            memcpy(this->Data, Data, GetSize());
         }
 
         /*!*
          * Image constructor loading data from file.
          * 
          * \param FileName - image file name.
+         * \param IsFlipVertically - flag, showing wheather image rows should be loaded in bottom to top order.
          */
-        image(const std::string &FileName)
+        image(const std::string &FileName, bool IsFlipVertically = false)
         {
-            this->Load(FileName);
+            this->Load(FileName, IsFlipVertically);
         }
 
         /*! Image default destructor. */
@@ -128,7 +142,8 @@ namespace scl
          */
         void Allocate()
         {
-            Data = new u8[(u64)Width * Height * ComponentsCount];
+            if (Data != nullptr) free(Data);
+            Data = (u8 *)malloc(GetSize());
         }
 
         /*!*
@@ -140,7 +155,7 @@ namespace scl
         void Free()
         {
             Width = Height = ComponentsCount = 0;
-            if (Data != nullptr) stbi_image_free(Data);
+            if (Data != nullptr) free(Data);
             Data = nullptr;
         }
 
@@ -148,46 +163,32 @@ namespace scl
          * Image load from file function.
          * 
          * \param FileName - file name to load image from.
+         * \param IsFlipVertically - flag, showing wheather image rows should be loaded in bottom to top order.
          * \return success flag.
          */
-        bool Load(const std::string &FileName)
-        {
-            // За каждым малоком должен быть free.... (CGSG FOREVER!!!)
-            if (Data != nullptr) delete[] Data;
-
-            // Load image, check if successful
-            int w, h, c;
-            Data = stbi_load(FileName.c_str(), &w, &h, &c, 0);
-            if (Data == nullptr)
-            {
-                SCL_CORE_ERROR("Error during loading image from file \"{}\"!", FileName);
-                Width = Height = ComponentsCount = 0;
-                if (Data) stbi_image_free(Data);
-                return false;
-            }
-
-            // If image loaded successful, set image data
-            Width = w, Height = h, ComponentsCount = c;
-            return true;
-        }
+        bool Load(const std::string &FileName, bool IsFlipVertically = false);
 
         /*!*
-         * Flip image along X axis function.
+         * Flip image along X axis (reverse rows order) function.
+         * Rows are swapped in place, without temporary buffers.
          * 
          * \param None.
          * \return None.
          */
-        void FlipHorizontaly()
-        {
-            u32 row_size = Width * ComponentsCount;
-            u8 *tmp = new u8[row_size];
-            for (u64 i = 0; i < Height / 2; ++i)
-            {
-                std::memmove(tmp, &Data[i * row_size], row_size);
-                std::memmove(&Data[i * row_size], &Data[(Height - i - 1) * row_size], row_size);
-                std::memmove(&Data[(Height - i - 1) * row_size], tmp, row_size);
-            }
-            delete[] tmp;
-        }
+        void FlipVertically();
+
+        /*!*
+         * Expand pixels to 4 components (RGBA) function.
+         * Pixels are processed from last to first, so source and destination could be same buffer.
+         * Missing color components are replicated from gray, missing alpha is set to 255.
+         * Three components pixels are expanded with SSSE3 shuffles (if CPU supports them and buffers are different).
+         *
+         * \param Source - source pixels.
+         * \param Destination - destination pixels buffer (of PixelsCount * 4 bytes).
+         * \param PixelsCount - count of pixels to expand.
+         * \param ComponentsCount - source pixels components count (1 - 4).
+         * \return None.
+         */
+        static void ExpandPixelsToRGBA(const u8 *Source, u8 *Destination, size_t PixelsCount, int ComponentsCount);
     };
 }
@@ -0,0 +1,224 @@
+/*!****************************************************************//*!*
+ * \file   image_compress.cpp
+ * \brief  Image block compression (BC1, BC3, BC5) functions implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "image_compress.h"
+#include "utilities/thread_pool/thread_pool.h"
+
+namespace scl
+{
+    /*!*
+     * Convert 8 bit per component color to 5:6:5 packed color function.
+     *
+     * \param Color - RGB color components.
+     * \return packed color.
+     */
+    static u16 PackColor565(const float Color[3])
+    {
+        int r = math::Clamp((int)(Color[0] * 31 / 255 + 0.5f), 0, 31);
+        int g = math::Clamp((int)(Color[1] * 63 / 255 + 0.5f), 0, 63);
+        int b = math::Clamp((int)(Color[2] * 31 / 255 + 0.5f), 0, 31);
+        return (u16)((r << 11) | (g << 5) | b);
+    }
+
+    /*!*
+     * Convert 5:6:5 packed color to 8 bit per component color function.
+     *
+     * \param Packed - packed color.
+     * \param OutColor - RGB color components.
+     * \return None.
+     */
+    static void UnpackColor565(u16 Packed, int OutColor[3])
+    {
+        int r = (Packed >> 11) & 31, g = (Packed >> 5) & 63, b = Packed & 31;
+        OutColor[0] = (r << 3) | (r >> 2);
+        OutColor[1] = (g << 2) | (g >> 4);
+        OutColor[2] = (b << 3) | (b >> 2);
+    }
+
+    /*!*
+     * Encode 4x4 pixels block colors to BC1 block function.
+     * Endpoints are taken as extreme block colors along colors principal axis.
+     *
+     * \param Pixels - block RGBA pixels (row by row).
+     * \param Out - 8 bytes of encoded block.
+     * \return None.
+     */
+    static void EncodeColorBlock(const u8 Pixels[16][4], u8 *Out)
+    {
+        float mean[3] {};
+        for (int i = 0; i < 16; i++)
+            for (int k = 0; k < 3; k++)
+                mean[k] += Pixels[i][k] / 16.0f;
+
+        float cov[6] {};
+        for (int i = 0; i < 16; i++)
+        {
+            float d[3] = { Pixels[i][0] - mean[0], Pixels[i][1] - mean[1], Pixels[i][2] - mean[2] };
+            cov[0] += d[0] * d[0], cov[1] += d[0] * d[1], cov[2] += d[0] * d[2];
+            cov[3] += d[1] * d[1], cov[4] += d[1] * d[2], cov[5] += d[2] * d[2];
+        }
+
+        // Principal axis is found with power iterations.
+        float axis[3] = { 1, 1, 1 };
+        for (int iteration = 0; iteration < 4; iteration++)
+        {
+            float next[3] = {
+                cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2],
+                cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2],
+                cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2],
+            };
+            float scale = math::Max(math::Max(std::abs(next[0]), std::abs(next[1])), std::abs(next[2]));
+            if (scale == 0) break;
+            for (int k = 0; k < 3; k++) axis[k] = next[k] / scale;
+        }
+
+        float min_projection = FLT_MAX, max_projection = -FLT_MAX;
+        int min_pixel = 0, max_pixel = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            float projection = Pixels[i][0] * axis[0] + Pixels[i][1] * axis[1] + Pixels[i][2] * axis[2];
+            if (projection < min_projection) min_projection = projection, min_pixel = i;
+            if (projection > max_projection) max_projection = projection, max_pixel = i;
+        }
+
+        // Endpoints are inset a bit, so extreme colors are covered by interpolated ones instead of outliers.
+        float max_color[3], min_color[3];
+        for (int k = 0; k < 3; k++)
+        {
+            float inset = (Pixels[max_pixel][k] - Pixels[min_pixel][k]) / 16.0f;
+            max_color[k] = Pixels[max_pixel][k] - inset;
+            min_color[k] = Pixels[min_pixel][k] + inset;
+        }
+        u16 c0 = PackColor565(max_color), c1 = PackColor565(min_color);
+        if (c0 < c1) std::swap(c0, c1);
+
+        // Four colors mode (c0 > c1) palette: c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1.
+        u32 indices = 0;
+        if (c0 != c1)
+        {
+            int palette[4][3];
+            UnpackColor565(c0, palette[0]);
+            UnpackColor565(c1, palette[1]);
+            for (int k = 0; k < 3; k++)
+                palette[2][k] = (2 * palette[0][k] + palette[1][k]) / 3,
+                palette[3][k] = (palette[0][k] + 2 * palette[1][k]) / 3;
+
+            for (int i = 0; i < 16; i++)
+            {
+                int best_index = 0, best_distance = INT_MAX;
+                for (int j = 0; j < 4; j++)
+                {
+                    int dr = Pixels[i][0] - palette[j][0], dg = Pixels[i][1] - palette[j][1], db = Pixels[i][2] - palette[j][2];
+                    int distance = dr * dr + dg * dg + db * db;
+                    if (distance < best_distance) best_distance = distance, best_index = j;
+                }
+                indices |= (u32)best_index << (i * 2);
+            }
+        }
+
+        memcpy(Out + 0, &c0, 2);
+        memcpy(Out + 2, &c1, 2);
+        memcpy(Out + 4, &indices, 4);
+    }
+
+    /*!*
+     * Encode 4x4 pixels block single component to BC4 block (used by BC3 alpha and BC5 channels) function.
+     *
+     * \param Pixels - block RGBA pixels (row by row).
+     * \param Component - index of encoded component.
+     * \param Out - 8 bytes of encoded block.
+     * \return None.
+     */
+    static void EncodeComponentBlock(const u8 Pixels[16][4], int Component, u8 *Out)
+    {
+        int a0 = 0, a1 = 255;
+        for (int i = 0; i < 16; i++)
+            a0 = math::Max(a0, (int)Pixels[i][Component]),
+            a1 = math::Min(a1, (int)Pixels[i][Component]);
+
+        // Eight values mode (a0 > a1) palette: a0, a1 and six values between them.
+        u64 indices = 0;
+        if (a0 != a1)
+        {
+            int palette[8] = { a0, a1 };
+            for (int j = 2; j < 8; j++)
+                palette[j] = ((8 - j) * a0 + (j - 1) * a1) / 7;
+
+            for (int i = 0; i < 16; i++)
+            {
+                int best_index = 0, best_distance = INT_MAX;
+                for (int j = 0; j < 8; j++)
+                {
+                    int distance = std::abs(Pixels[i][Component] - palette[j]);
+                    if (distance < best_distance) best_distance = distance, best_index = j;
+                }
+                indices |= (u64)best_index << (i * 3);
+            }
+        }
+
+        Out[0] = (u8)a0, Out[1] = (u8)a1;
+        for (int b = 0; b < 6; b++)
+            Out[2 + b] = (u8)(indices >> (b * 8));
+    }
+}
+
+size_t scl::GetCompressedImageSize(int Width, int Height, texture_compression Compression)
+{
+    size_t blocks_count = (size_t)((Width + 3) / 4) * ((Height + 3) / 4);
+    switch (Compression)
+    {
+    case scl::texture_compression::NONE: return (size_t)Width * Height * 4;
+    case scl::texture_compression::BC1:  return blocks_count * 8;
+    case scl::texture_compression::BC3:  return blocks_count * 16;
+    case scl::texture_compression::BC5:  return blocks_count * 16;
+    }
+    return 0;
+}
+
+bool scl::IsImageOpaque(const image_mip &Mip)
+{
+    for (size_t i = 3; i < Mip.Pixels.size(); i += 4)
+        if (Mip.Pixels[i] != 255) return false;
+    return true;
+}
+
+void scl::CompressImage(const image_mip &Mip, texture_compression Compression, u8 *OutBlocks)
+{
+    if (Compression == texture_compression::NONE)
+    {
+        memcpy(OutBlocks, Mip.Pixels.data(), Mip.Pixels.size());
+        return;
+    }
+
+    const int blocks_w = (Mip.Width + 3) / 4, blocks_h = (Mip.Height + 3) / 4;
+    const size_t block_size = Compression == texture_compression::BC1 ? 8 : 16;
+    thread_pool::Get().ParallelFor(blocks_h, 16, [&](size_t Begin, size_t End)
+    {
+        u8 pixels[16][4];
+        for (size_t by = Begin; by < End; by++)
+            for (int bx = 0; bx < blocks_w; bx++)
+            {
+                // Pixels outside of image (in partial blocks) replicate image edge.
+                for (int i = 0; i < 16; i++)
+                {
+                    int x = math::Min(bx * 4 + i % 4, Mip.Width - 1), y = math::Min((int)by * 4 + i / 4, Mip.Height - 1);
+                    memcpy(pixels[i], &Mip.Pixels[((size_t)y * Mip.Width + x) * 4], 4);
+                }
+
+                u8 *out = OutBlocks + (by * blocks_w + bx) * block_size;
+                switch (Compression)
+                {
+                case scl::texture_compression::BC1: EncodeColorBlock(pixels, out); break;
+                case scl::texture_compression::BC3: EncodeComponentBlock(pixels, 3, out), EncodeColorBlock(pixels, out + 8); break;
+                case scl::texture_compression::BC5: EncodeComponentBlock(pixels, 0, out), EncodeComponentBlock(pixels, 1, out + 8); break;
+                default: break;
+                }
+            }
+    });
+}
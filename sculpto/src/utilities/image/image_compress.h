@@ -0,0 +1,45 @@
+/*!****************************************************************//*!*
+ * \file   image_compress.h
+ * \brief  Image block compression (BC1, BC3, BC5) functions definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "image_mips.h"
+#include "core/render/primitives/texture.h"
+
+namespace scl
+{
+    /*!*
+     * Get size of block compressed image function.
+     *
+     * \param Width - image width.
+     * \param Height - image height.
+     * \param Compression - image compression type.
+     * \return compressed image size in bytes (4 bytes per pixel for uncompressed image).
+     */
+    size_t GetCompressedImageSize(int Width, int Height, texture_compression Compression);
+
+    /*!*
+     * Check if all image pixels are opaque function.
+     *
+     * \param Mip - image to check.
+     * \return wheather image alpha is 255 for all pixels.
+     */
+    bool IsImageOpaque(const image_mip &Mip);
+
+    /*!*
+     * Compress image to 4x4 pixels blocks function.
+     * BC1 and BC3 encode RGB (and alpha for BC3), BC5 encodes only red and green components.
+     * Blocks rows are compressed in parallel.
+     *
+     * \param Mip - image to compress.
+     * \param Compression - compression type (NONE just copies pixels).
+     * \param OutBlocks - compressed blocks data (of GetCompressedImageSize bytes).
+     * \return None.
+     */
+    void CompressImage(const image_mip &Mip, texture_compression Compression, u8 *OutBlocks);
+}
@@ -0,0 +1,121 @@
+/*!****************************************************************//*!*
+ * \file   image_mips.cpp
+ * \brief  Image mip levels generation functions implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "image_mips.h"
+
+namespace scl
+{
+    /*! Linear to sRGB conversion table size. */
+    static constexpr int LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+
+    /*! sRGB to linear color component conversion table getter function. */
+    static const std::array<float, 256> &GetSrgbToLinearTable()
+    {
+        static const std::array<float, 256> table = []()
+        {
+            std::array<float, 256> result {};
+            for (int i = 0; i < 256; i++)
+            {
+                float c = i / 255.0f;
+                result[i] = c <= 0.04045f ? c / 12.92f : pow((c + 0.055f) / 1.055f, 2.4f);
+            }
+            return result;
+        }();
+        return table;
+    }
+
+    /*! Linear to sRGB color component conversion table getter function. */
+    static const std::array<u8, LINEAR_TO_SRGB_TABLE_SIZE> &GetLinearToSrgbTable()
+    {
+        static const std::array<u8, LINEAR_TO_SRGB_TABLE_SIZE> table = []()
+        {
+            std::array<u8, LINEAR_TO_SRGB_TABLE_SIZE> result {};
+            for (int i = 0; i < LINEAR_TO_SRGB_TABLE_SIZE; i++)
+            {
+                float c = i / (float)(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+                c = c <= 0.0031308f ? c * 12.92f : 1.055f * pow(c, 1 / 2.4f) - 0.055f;
+                result[i] = (u8)math::Clamp((int)(c * 255 + 0.5f), 0, 255);
+            }
+            return result;
+        }();
+        return table;
+    }
+
+    /*!*
+     * Convert float component to 8 bit one function.
+     *
+     * \param Value - component value in range [0; 1].
+     * \return 8 bit component.
+     */
+    static u8 ToUnorm8(float Value)
+    {
+        return (u8)math::Clamp((int)(Value * 255 + 0.5f), 0, 255);
+    }
+}
+
+std::vector<scl::image_mip> scl::GenerateImageMips(const image &Image, bool IsNormalMap)
+{
+    std::vector<image_mip> mips {};
+    if (Image.IsEmpty()) return mips;
+
+    // Source image is expanded to RGBA.
+    image_mip &source = mips.emplace_back();
+    source.Width = Image.GetWidth(), source.Height = Image.GetHeight();
+    source.Pixels.resize((size_t)source.Width * source.Height * 4);
+    image::ExpandPixelsToRGBA(Image.GetRawData(), source.Pixels.data(), (size_t)source.Width * source.Height, Image.GetComponentsCount());
+
+    // Levels are filtered in linear floating point space, without requantizing intermediate levels.
+    const auto &srgb_to_linear = GetSrgbToLinearTable();
+    const auto &linear_to_srgb = GetLinearToSrgbTable();
+    std::vector<float> level((size_t)source.Width * source.Height * 4);
+    for (size_t i = 0; i < source.Pixels.size(); i += 4)
+        for (int k = 0; k < 4; k++)
+            level[i + k] = k == 3 ? source.Pixels[i + k] / 255.0f :
+                           IsNormalMap ? source.Pixels[i + k] / 255.0f * 2 - 1 : srgb_to_linear[source.Pixels[i + k]];
+
+    std::vector<float> next_level {};
+    int w = source.Width, h = source.Height;
+    while (w > 1 || h > 1)
+    {
+        const int next_w = math::Max(w / 2, 1), next_h = math::Max(h / 2, 1);
+        next_level.resize((size_t)next_w * next_h * 4);
+        for (int y = 0; y < next_h; y++)
+        {
+            const float *row0 = &level[(size_t)math::Min(y * 2, h - 1) * w * 4];
+            const float *row1 = &level[(size_t)math::Min(y * 2 + 1, h - 1) * w * 4];
+            float *dst = &next_level[(size_t)y * next_w * 4];
+            for (int x = 0; x < next_w; x++, dst += 4)
+            {
+                const size_t x0 = (size_t)math::Min(x * 2, w - 1) * 4, x1 = (size_t)math::Min(x * 2 + 1, w - 1) * 4;
+                for (int k = 0; k < 4; k++)
+                    dst[k] = (row0[x0 + k] + row0[x1 + k] + row1[x0 + k] + row1[x1 + k]) * 0.25f;
+
+                if (IsNormalMap)
+                {
+                    float length = sqrt(dst[0] * dst[0] + dst[1] * dst[1] + dst[2] * dst[2]);
+                    if (length > 0) dst[0] /= length, dst[1] /= length, dst[2] /= length;
+                }
+            }
+        }
+        std::swap(level, next_level);
+        w = next_w, h = next_h;
+
+        image_mip &mip = mips.emplace_back();
+        mip.Width = w, mip.Height = h;
+        mip.Pixels.resize((size_t)w * h * 4);
+        for (size_t i = 0; i < mip.Pixels.size(); i += 4)
+        {
+            for (int k = 0; k < 3; k++)
+                mip.Pixels[i + k] = IsNormalMap ? ToUnorm8(level[i + k] * 0.5f + 0.5f) :
+                    linear_to_srgb[math::Clamp((int)(level[i + k] * (LINEAR_TO_SRGB_TABLE_SIZE - 1) + 0.5f), 0, LINEAR_TO_SRGB_TABLE_SIZE - 1)];
+            mip.Pixels[i + 3] = ToUnorm8(level[i + 3]);
+        }
+    }
+    return mips;
+}
@@ -0,0 +1,32 @@
+/*!****************************************************************//*!*
+ * \file   image_mips.h
+ * \brief  Image mip levels generation functions definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "image.h"
+
+namespace scl
+{
+    /*! Image mip level (4 components, 8 bits per component pixels) structure. */
+    struct image_mip
+    {
+        int Width {}, Height {};     /*! Level size in pixels. */
+        std::vector<u8> Pixels {};   /*! Level RGBA pixels. */
+    };
+
+    /*!*
+     * Generate full mip chain of image function.
+     * Each level is box filtered from previous one in linear space: color images are treated as sRGB encoded,
+     * normal maps are filtered as vectors and renormalized. Alpha is always filtered linearly.
+     *
+     * \param Image - source image (1, 3 or 4 components).
+     * \param IsNormalMap - wheather image is tangent space normal map or color.
+     * \return mip levels, from source image (converted to RGBA) to 1x1 level.
+     */
+    std::vector<image_mip> GenerateImageMips(const image &Image, bool IsNormalMap);
+}
@@ -1,6 +1,6 @@
 /*!****************************************************************//*!*
  * \file   logger.cpp
- * \brief  
+ * \brief  Sculpto library logger implementation module.
  * 
  * \author Sabitov Kirill
  * \date   23 June 2022
@@ -12,6 +12,16 @@
 scl::logger::logger(const std::string &Name) :
     Name(Name) {}
 
+void scl::logger::Write(const std::string &Color, const std::string &Message) const
+{
+    std::string record = "[" + CurrentTime() + "] {|" + Name + "|} ";
+    if (!Color.empty()) record += Color + Message + console::color_literal_reset() + '\n';
+    else                record += Message + '\n';
+
+    std::lock_guard<std::mutex> lock(OutMutex);
+    Out << record;
+}
+
 void scl::logger::SetStream(std::ostream OutStream)
 {
 }
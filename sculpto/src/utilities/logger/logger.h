@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <mutex>
 
 #include "console_colors.h"
 #include "current_time.h"
@@ -23,6 +24,18 @@ namespace scl
         std::string Name = "";
         /*! Currently using stream. */
         std::ostream &Out = std::cout;
+        /*! Out stream writing mutex (records could be logged from worker threads). */
+        mutable std::mutex OutMutex {};
+
+        /*!*
+         * Write formatted record to current out stream function.
+         * Whole record is written under lock, so records from different threads are not interleaved.
+         *
+         * \param Color - record message color literal (empty for default color).
+         * \param Message - formatted record message.
+         * \return None.
+         */
+        void Write(const std::string &Color, const std::string &Message) const;
 
     public:
         /*!*
@@ -42,10 +55,7 @@ namespace scl
         template <typename... Targs>
         void Info(std::string_view Format, Targs&&... Args) const
         {
-            Out <<
-                "[" << CurrentTime() << "] {|" << Name << "|} " <<
-                std::vformat(Format, std::make_format_args(Args...)) <<
-                '\n';
+            Write({}, std::vformat(Format, std::make_format_args(Args...)));
         }
 
         /*!*
@@ -57,11 +67,7 @@ namespace scl
         template <typename... Targs>
         void Success(std::string_view Format, Targs&&... Args) const
         {
-            Out <<
-                "[" << CurrentTime() << "] {|" << Name << "|} " <<
-                console::color_literal(console::color::GREEN) <<
-                std::vformat(Format, std::make_format_args(Args...)) <<
-                console::color_literal_reset() << '\n';
+            Write(console::color_literal(console::color::GREEN), std::vformat(Format, std::make_format_args(Args...)));
         }
 
         /*!*
@@ -73,11 +79,7 @@ namespace scl
         template <typename... Targs>
         void Warn(std::string_view Format, Targs&&... Args) const
         {
-            Out <<
-                "[" << CurrentTime() << "] {|" << Name << "|} " <<
-                console::color_literal(console::color::YELLOW) <<
-                std::vformat(Format, std::make_format_args(Args...)) <<
-                console::color_literal_reset() << '\n';
+            Write(console::color_literal(console::color::YELLOW), std::vformat(Format, std::make_format_args(Args...)));
         }
 
         /*!*
@@ -89,11 +91,7 @@ namespace scl
         template <typename... Targs>
         void Error(std::string_view Format, Targs&&... Args) const
         {
-            Out <<
-                "[" << CurrentTime() << "] {|" << Name << "|} " <<
-                console::color_literal(console::color::RED) <<
-                std::vformat(Format, std::make_format_args(Args...)) <<
-                console::color_literal_reset() << '\n';
+            Write(console::color_literal(console::color::RED), std::vformat(Format, std::make_format_args(Args...)));
         }
 
         /*!*
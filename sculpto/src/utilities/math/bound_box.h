@@ -0,0 +1,299 @@
+/*!****************************************************************//*!*
+ * \file   bound_box.h
+ * \brief  Math axis aligned bound box, ray and frustum implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   28 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "matr4.h"
+#include "vec4.h"
+
+namespace scl::math
+{
+    /*! Axis aligned bound box class. */
+    template <typename T>
+    class bound_box
+    {
+    public: /*! Bound box data. */
+        vec3<T> Min { std::numeric_limits<T>::max() };     /*! Bound box minimum point. */
+        vec3<T> Max { std::numeric_limits<T>::lowest() };  /*! Bound box maximum point. */
+
+    public:
+        /*! Bound box default constructor. Creates empty (inverted) box. */
+        bound_box() = default;
+
+        /*!*
+         * Bound box constructor by minimum and maximum points.
+         *
+         * \param Min - bound box minimum point.
+         * \param Max - bound box maximum point.
+         */
+        bound_box(const vec3<T> &Min, const vec3<T> &Max) : Min(Min), Max(Max) {}
+
+        /*!*
+         * Check if bound box contains no points function.
+         *
+         * \param None.
+         * \return wheather box is empty or not.
+         */
+        bool IsEmpty() const { return Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z; }
+
+        /*! Bound box center point getter function. */
+        vec3<T> GetCenter() const { return (Min + Max) * (T)0.5; }
+        /*! Bound box size along each axis getter function. */
+        vec3<T> GetSize() const { return Max - Min; }
+        /*! Bound box surface area getter function. */
+        T GetSurfaceArea() const
+        {
+            vec3<T> d = Max - Min;
+            return 2 * (d.X * d.Y + d.Y * d.Z + d.Z * d.X);
+        }
+
+        /*!*
+         * Extend bound box to contain point function.
+         *
+         * \param Point - point to contain.
+         * \return this bound box.
+         */
+        bound_box &Extend(const vec3<T> &Point)
+        {
+            Min = vec3<T>::Min(Min, Point), Max = vec3<T>::Max(Max, Point);
+            return *this;
+        }
+
+        /*!*
+         * Get bound box, containing both boxes function.
+         *
+         * \param A, B - boxes to unite.
+         * \return united box.
+         */
+        static bound_box Union(const bound_box &A, const bound_box &B)
+        {
+            return bound_box(vec3<T>::Min(A.Min, B.Min), vec3<T>::Max(A.Max, B.Max));
+        }
+
+        /*!*
+         * Get bound box, enlarged by margin along each axis function.
+         *
+         * \param Margin - enlarge margin.
+         * \return enlarged box.
+         */
+        bound_box Enlarged(T Margin) const
+        {
+            return bound_box(Min - Margin, Max + Margin);
+        }
+
+        /*!*
+         * Check if bound box fully contains other box function.
+         *
+         * \param Other - box to check.
+         * \return wheather box is contained or not.
+         */
+        bool Contains(const bound_box &Other) const
+        {
+            return Min.X <= Other.Min.X && Min.Y <= Other.Min.Y && Min.Z <= Other.Min.Z &&
+                   Max.X >= Other.Max.X && Max.Y >= Other.Max.Y && Max.Z >= Other.Max.Z;
+        }
+
+        /*!*
+         * Check if bound boxes overlap function.
+         *
+         * \param Other - box to check overlap with.
+         * \return wheather boxes overlap or not.
+         */
+        bool Intersects(const bound_box &Other) const
+        {
+            return Min.X <= Other.Max.X && Max.X >= Other.Min.X &&
+                   Min.Y <= Other.Max.Y && Max.Y >= Other.Min.Y &&
+                   Min.Z <= Other.Max.Z && Max.Z >= Other.Min.Z;
+        }
+
+        /*!*
+         * Check if bound box overlaps sphere function.
+         *
+         * \param Center - sphere center.
+         * \param Radius - sphere radius.
+         * \return wheather box overlaps sphere or not.
+         */
+        bool IntersectsSphere(const vec3<T> &Center, T Radius) const
+        {
+            vec3<T> closest = vec3<T>::Min(vec3<T>::Max(Center, Min), Max);
+            return (closest - Center).Length2() <= Radius * Radius;
+        }
+
+        /*!*
+         * Get bound box of this box transformed by matrix function.
+         *
+         * \param Transform - transformation matrix.
+         * \return transformed box.
+         */
+        bound_box Transformed(const matr4<T> &Transform) const
+        {
+            if (IsEmpty()) return *this;
+
+            // Transform box center and extents instead of all 8 corners.
+            vec3<T> center = Transform.TransformPoint(GetCenter());
+            vec3<T> extent = GetSize() * (T)0.5;
+            vec3<T> new_extent {};
+            for (int i = 0; i < 3; i++)
+                new_extent[i] = std::abs(Transform.A[0][i]) * extent.X +
+                                std::abs(Transform.A[1][i]) * extent.Y +
+                                std::abs(Transform.A[2][i]) * extent.Z;
+            return bound_box(center - new_extent, center + new_extent);
+        }
+    };
+
+    /*! Ray class. */
+    template <typename T>
+    class ray
+    {
+    public: /*! Ray data. */
+        vec3<T> Origin {};     /*! Ray origin point. */
+        vec3<T> Direction {};  /*! Ray direction (not necessary normalized). */
+
+    public:
+        /*! Ray default constructor. */
+        ray() = default;
+
+        /*!*
+         * Ray constructor by origin and direction.
+         *
+         * \param Origin - ray origin point.
+         * \param Direction - ray direction.
+         */
+        ray(const vec3<T> &Origin, const vec3<T> &Direction) : Origin(Origin), Direction(Direction) {}
+
+        /*!*
+         * Ray point at specified distance (in direction lengths) getter function.
+         *
+         * \param Distance - distance along ray.
+         * \return ray point.
+         */
+        vec3<T> GetPoint(T Distance) const { return Origin + Direction * Distance; }
+
+        /*!*
+         * Intersect ray with bound box (slabs method) function.
+         *
+         * \param Box - box to intersect with.
+         * \param MaxDistance - maximal distance along ray to look for intersection.
+         * \param OutDistance - distance to nearest intersection point (0 if ray origin is inside box).
+         * \return wheather ray intersects box or not.
+         */
+        bool Intersect(const bound_box<T> &Box, T MaxDistance, T &OutDistance) const
+        {
+            T t_near = 0, t_far = MaxDistance;
+            for (int i = 0; i < 3; i++)
+            {
+                if (Direction[i] == 0)
+                {
+                    if (Origin[i] < Box.Min[i] || Origin[i] > Box.Max[i]) return false;
+                    continue;
+                }
+
+                T inv_dir = 1 / Direction[i];
+                T t0 = (Box.Min[i] - Origin[i]) * inv_dir;
+                T t1 = (Box.Max[i] - Origin[i]) * inv_dir;
+                if (t0 > t1) std::swap(t0, t1);
+                t_near = t0 > t_near ? t0 : t_near;
+                t_far = t1 < t_far ? t1 : t_far;
+                if (t_near > t_far) return false;
+            }
+            OutDistance = t_near;
+            return true;
+        }
+    };
+
+    /*! View frustum (6 clipping planes) class. */
+    template <typename T>
+    class frustum
+    {
+    public: /*! Frustum data. */
+        vec4<T> Planes[6] {}; /*! Frustum planes (normal, distance) with normals pointing inside frustum. */
+
+    public:
+        /*! Frustum default constructor. */
+        frustum() = default;
+
+        /*!*
+         * Frustum constructor by view projection matrix.
+         * Extracts planes from clip space, assuming row vector matrices and OpenGL depth range [-w;w].
+         *
+         * \param ViewProjection - camera view projection matrix.
+         */
+        frustum(const matr4<T> &ViewProjection)
+        {
+            const auto &a = ViewProjection.A;
+            for (int i = 0; i < 3; i++)
+            {
+                Planes[i * 2 + 0] = vec4<T>(a[0][3] + a[0][i], a[1][3] + a[1][i], a[2][3] + a[2][i], a[3][3] + a[3][i]);
+                Planes[i * 2 + 1] = vec4<T>(a[0][3] - a[0][i], a[1][3] - a[1][i], a[2][3] - a[2][i], a[3][3] - a[3][i]);
+            }
+            for (auto &plane : Planes)
+            {
+                T length = sqrt(plane.X * plane.X + plane.Y * plane.Y + plane.Z * plane.Z);
+                if (length > 0) plane = vec4<T>(plane.X / length, plane.Y / length, plane.Z / length, plane.W / length);
+            }
+        }
+
+        /*! Bound box and frustum test results enum. */
+        enum class test_result
+        {
+            OUTSIDE,    /*! Box is fully outside of frustum. */
+            INTERSECT,  /*! Box is partly inside of frustum. */
+            INSIDE,     /*! Box is fully inside of frustum. */
+        };
+
+        /*!*
+         * Test bound box against frustum function.
+         *
+         * \param Box - box to test.
+         * \return test result.
+         */
+        test_result Test(const bound_box<T> &Box) const
+        {
+            test_result result = test_result::INSIDE;
+            for (const auto &plane : Planes)
+            {
+                // Box corners, farthest along and against plane normal.
+                vec3<T> positive(plane.X >= 0 ? Box.Max.X : Box.Min.X,
+                                 plane.Y >= 0 ? Box.Max.Y : Box.Min.Y,
+                                 plane.Z >= 0 ? Box.Max.Z : Box.Min.Z);
+                vec3<T> negative(plane.X >= 0 ? Box.Min.X : Box.Max.X,
+                                 plane.Y >= 0 ? Box.Min.Y : Box.Max.Y,
+                                 plane.Z >= 0 ? Box.Min.Z : Box.Max.Z);
+
+                if (plane.X * positive.X + plane.Y * positive.Y + plane.Z * positive.Z + plane.W < 0)
+                    return test_result::OUTSIDE;
+                if (plane.X * negative.X + plane.Y * negative.Y + plane.Z * negative.Z + plane.W < 0)
+                    result = test_result::INTERSECT;
+            }
+            return result;
+        }
+
+        /*!*
+         * Check if bound box is at least partly inside frustum function.
+         *
+         * \param Box - box to check.
+         * \return wheather box is visible or not.
+         */
+        bool Intersects(const bound_box<T> &Box) const { return Test(Box) != test_result::OUTSIDE; }
+
+        /*!*
+         * Check if sphere is at least partly inside frustum function.
+         *
+         * \param Center - sphere center.
+         * \param Radius - sphere radius.
+         * \return wheather sphere is visible or not.
+         */
+        bool Intersects(const vec3<T> &Center, T Radius) const
+        {
+            for (const auto &plane : Planes)
+                if (plane.X * Center.X + plane.Y * Center.Y + plane.Z * Center.Z + plane.W < -Radius)
+                    return false;
+            return true;
+        }
+    };
+}
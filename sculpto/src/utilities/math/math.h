@@ -13,3 +13,4 @@
 #include "vec4.h"
 #include "matr3.h"
 #include "matr4.h"
+#include "bound_box.h"
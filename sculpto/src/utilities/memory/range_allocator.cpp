@@ -0,0 +1,63 @@
+/*!****************************************************************//*!*
+ * \file   range_allocator.cpp
+ * \brief  Ranges (of buffer elements) allocator class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+#include "range_allocator.h"
+
+scl::range_allocator::range_allocator(u32 Capacity) :
+    Capacity(Capacity), FreeSize(Capacity)
+{
+    if (Capacity > 0) FreeRanges.emplace(0, Capacity);
+}
+
+bool scl::range_allocator::Allocate(u32 Size, u32 &OutOffset)
+{
+    if (Size == 0 || Size > FreeSize) return false;
+
+    for (auto range = FreeRanges.begin(); range != FreeRanges.end(); ++range)
+    {
+        if (range->second < Size) continue;
+
+        // Range is allocated from free range begining, rest of free range stays free.
+        OutOffset = range->first;
+        u32 rest_size = range->second - Size;
+        FreeRanges.erase(range);
+        if (rest_size > 0) FreeRanges.emplace(OutOffset + Size, rest_size);
+        FreeSize -= Size;
+        return true;
+    }
+    return false;
+}
+
+void scl::range_allocator::Free(u32 Offset, u32 Size)
+{
+    if (Size == 0) return;
+    SCL_CORE_ASSERT(Offset + Size <= Capacity, "Freed range is out of allocator space.");
+
+    FreeSize += Size;
+    auto next = FreeRanges.lower_bound(Offset);
+    SCL_CORE_ASSERT(next == FreeRanges.end() || Offset + Size <= next->first, "Freed range overlaps free range.");
+
+    // Freed range is merged with previous and next adjacent free ranges.
+    if (next != FreeRanges.begin())
+    {
+        auto previous = std::prev(next);
+        SCL_CORE_ASSERT(previous->first + previous->second <= Offset, "Freed range overlaps free range.");
+        if (previous->first + previous->second == Offset)
+        {
+            Offset = previous->first, Size += previous->second;
+            FreeRanges.erase(previous);
+        }
+    }
+    if (next != FreeRanges.end() && Offset + Size == next->first)
+    {
+        Size += next->second;
+        FreeRanges.erase(next);
+    }
+    FreeRanges.emplace(Offset, Size);
+}
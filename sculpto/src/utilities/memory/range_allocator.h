@@ -0,0 +1,65 @@
+/*!****************************************************************//*!*
+ * \file   range_allocator.h
+ * \brief  Ranges (of buffer elements) allocator class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl
+{
+    /*!*
+     * Ranges allocator class.
+     * Allocates ranges of elements from fixed capacity space (e.g. GPU buffer) by first fit of free ranges.
+     * Freed ranges are merged with adjacent free ranges, so space is not fragmented by freeing.
+     * Allocator only tracks offsets and stores no elements, so it could be used without render context.
+     */
+    class range_allocator
+    {
+    private: /*! Ranges allocator data. */
+        std::map<u32, u32> FreeRanges {}; /*! Free ranges sizes by their offsets. */
+        u32 Capacity {};                  /*! Allocator space capacity in elements. */
+        u32 FreeSize {};                  /*! Free elements count. */
+
+    public: /*! Ranges allocator data getter/setter functions. */
+        /*! Allocator space capacity getter function. */
+        u32 GetCapacity() const { return Capacity; }
+        /*! Free elements count getter function. */
+        u32 GetFreeSize() const { return FreeSize; }
+        /*! Free ranges count getter function. */
+        size_t GetFreeRangesCount() const { return FreeRanges.size(); }
+
+    public:
+        /*! Ranges allocator default constructor (allocator without space). */
+        range_allocator() = default;
+
+        /*!*
+         * Ranges allocator constructor.
+         *
+         * \param Capacity - allocator space capacity in elements.
+         */
+        range_allocator(u32 Capacity);
+
+        /*!*
+         * Allocate range function.
+         *
+         * \param Size - range size in elements.
+         * \param OutOffset - allocated range offset.
+         * \return wheather range was allocated or not (there is no free range of such size).
+         */
+        bool Allocate(u32 Size, u32 &OutOffset);
+
+        /*!*
+         * Free allocated range function.
+         *
+         * \param Offset - range offset.
+         * \param Size - range size in elements.
+         * \return None.
+         */
+        void Free(u32 Offset, u32 Size);
+    };
+}
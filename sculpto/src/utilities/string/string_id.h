@@ -66,7 +66,7 @@ namespace scl
     constexpr string_id crc32_impl(const char *p, size_t len, string_id crc) {
         return
             len ?
-            crc32_impl(p + 1, len - 1, (crc >> 8) ^ crc_table[(crc & 0xFF) ^ *p]) :
+            crc32_impl(p + 1, len - 1, (crc >> 8) ^ crc_table[(crc & 0xFF) ^ (unsigned char)*p]) :
             crc;
     }
 
@@ -0,0 +1,52 @@
+/*!****************************************************************//*!*
+ * \file   thread_pool.cpp
+ * \brief  Worker threads pool class implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#include "sclpch.h"
+
+#include "thread_pool.h"
+
+scl::thread_pool::thread_pool(size_t WorkersCount)
+{
+    Workers.reserve(WorkersCount);
+    for (size_t i = 0; i < WorkersCount; i++)
+        Workers.emplace_back(&thread_pool::WorkerLoop, this);
+}
+
+scl::thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(TasksMutex);
+        IsStopping = true;
+    }
+    TasksCondition.notify_all();
+    for (auto &worker : Workers)
+        worker.join();
+}
+
+void scl::thread_pool::WorkerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task {};
+        {
+            std::unique_lock<std::mutex> lock(TasksMutex);
+            TasksCondition.wait(lock, [this]() { return IsStopping || !Tasks.empty(); });
+            if (Tasks.empty()) return;
+
+            task = std::move(Tasks.front());
+            Tasks.pop();
+        }
+        task();
+    }
+}
+
+scl::thread_pool &scl::thread_pool::Get()
+{
+    static thread_pool global_pool(math::Max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+    return global_pool;
+}
@@ -0,0 +1,131 @@
+/*!****************************************************************//*!*
+ * \file   thread_pool.h
+ * \brief  Worker threads pool class definition module.
+ *
+ * \author Sabitov Kirill
+ * \date   30 July 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "base.h"
+
+namespace scl
+{
+    /*!*
+     * Worker threads pool class.
+     * Tasks are executed in order of submission by fixed count of worker threads.
+     * Tasks should not wait for other tasks of same pool, because it could lead to deadlock.
+     */
+    class thread_pool
+    {
+    private: /*! Thread pool data. */
+        std::vector<std::thread> Workers {};             /*! Worker threads. */
+        std::queue<std::function<void()>> Tasks {};      /*! Waiting for execution tasks queue. */
+        std::mutex TasksMutex {};                        /*! Tasks queue access mutex. */
+        std::condition_variable TasksCondition {};       /*! Tasks queue change (or pool stop) notification. */
+        bool IsStopping {};                              /*! Pool stop flag. */
+
+    private: /*! Thread pool methods. */
+        /*!*
+         * Worker thread main function.
+         *
+         * \param None.
+         * \return None.
+         */
+        void WorkerLoop();
+
+    public:
+        /*! Count of pool worker threads getter function. */
+        size_t GetWorkersCount() const { return Workers.size(); }
+
+        /*!*
+         * Thread pool constructor.
+         *
+         * \param WorkersCount - count of worker threads.
+         */
+        thread_pool(size_t WorkersCount);
+
+        /*! Thread pool destructor. Finishes all submited tasks. */
+        ~thread_pool();
+
+        /*!*
+         * Submit task for execution function.
+         *
+         * \param Task - function to execute in worker thread.
+         * \return task result future.
+         */
+        template <typename Tfunc>
+        auto Submit(Tfunc &&Task) -> std::future<std::invoke_result_t<Tfunc>>
+        {
+            using result_type = std::invoke_result_t<Tfunc>;
+
+            // Packaged task is not copyable, so it is stored in shared pointer to fit std::function.
+            auto packaged_task = CreateShared<std::packaged_task<result_type()>>(std::forward<Tfunc>(Task));
+            std::future<result_type> result = packaged_task->get_future();
+            {
+                std::lock_guard<std::mutex> lock(TasksMutex);
+                Tasks.emplace([packaged_task]() { (*packaged_task)(); });
+            }
+            TasksCondition.notify_one();
+            return result;
+        }
+
+        /*!*
+         * Split indices range to chunks and process them in parallel function.
+         * Calling thread processes chunks too and waits (without spinning) only for chunks, already taken by workers,
+         * so function could be called from pool tasks (even if all workers are busy).
+         * Range is processed in calling thread if pool has less than two workers (single worker gives no speed up,
+         * but adds submission and wake up latency).
+         *
+         * \param Count - count of indices to process.
+         * \param ChunkSize - count of indices in single chunk.
+         * \param Func - function, called for each chunk with its first and after last indices.
+         * \return None.
+         */
+        template <typename Tfunc>
+        void ParallelFor(size_t Count, size_t ChunkSize, const Tfunc &Func)
+        {
+            const size_t chunks_count = (Count + ChunkSize - 1) / ChunkSize;
+            if (chunks_count <= 1 || Workers.size() <= 1)
+            {
+                if (Count > 0) Func(0, Count);
+                return;
+            }
+
+            // Counters are shared with workers, which could start after all chunks are done (and never touch function).
+            struct chunks_counters
+            {
+                std::atomic<size_t> Next {};  /*! Next chunk to process index. */
+                std::atomic<size_t> Done {};  /*! Count of processed chunks. */
+            };
+            shared<chunks_counters> counters = CreateShared<chunks_counters>();
+            auto process_chunks = [counters, func = &Func, Count, ChunkSize, chunks_count]()
+            {
+                for (size_t chunk; (chunk = counters->Next++) < chunks_count;)
+                {
+                    (*func)(chunk * ChunkSize, math::Min(Count, (chunk + 1) * ChunkSize));
+                    if (++counters->Done == chunks_count)
+                        counters->Done.notify_all();
+                }
+            };
+
+            for (size_t i = 0; i < math::Min(Workers.size(), chunks_count - 1); i++)
+                Submit(process_chunks);
+            process_chunks();
+
+            // Sleep until last chunk is done (workers notify only on last chunk completion).
+            for (size_t done; (done = counters->Done) < chunks_count;)
+                counters->Done.wait(done);
+        }
+
+        /*!*
+         * Global shared thread pool getter function.
+         * Pool has one worker less than hardware threads count (main thread is not counted).
+         *
+         * \param None.
+         * \return global thread pool.
+         */
+        static thread_pool &Get();
+    };
+}
@@ -0,0 +1,50 @@
+project "sculpto-tests"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "off"
+
+    targetdir ("%{wks.location}/bin/" .. outputdir .. "%{prj.name}")
+    objdir ("%{wks.location}/bin-int/" .. outputdir .. "%{prj.name}")
+    debugdir "%{wks.location}"
+
+    files
+    {
+        "src/**.h",
+        "src/**.cpp",
+    }
+
+    includedirs
+    {
+        "src",
+        "%{wks.location}/sculpto/src",
+        "%{wks.location}/sculpto/external",
+        "%{IncludeDir.entt}",
+        "%{IncludeDir.json}",
+        "%{IncludeDir.stb_image}",
+        "%{IncludeDir.imgui}",
+        "%{IncludeDir.rccpp}",
+    }
+
+    links
+    {
+        "sculpto",
+    }
+
+    filter "system:windows"
+        systemversion "latest"
+        characterset ("MBCS")
+
+    filter "configurations:Debug"
+        defines { "SCL_DEBUG", "SCL_DEBUG_MEMORY_ENABLED", "SCL_ASSERTION_ENABLED" }
+        symbols "On"
+
+    filter "configurations:Release"
+        defines "SCL_RELEASE"
+        optimize "On"
+        runtime "Release"
+
+    filter "configurations:Dist"
+        defines "SCL_DIST"
+        optimize "On"
+        runtime "Release"
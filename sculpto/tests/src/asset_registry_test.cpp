@@ -0,0 +1,39 @@
+/*!****************************************************************//*!*
+ * \file   asset_registry_test.cpp
+ * \brief  Loaded assets registry tests module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+SCL_TEST(AssetRegistryVariants)
+{
+    std::filesystem::path folder = std::filesystem::temp_directory_path() / "sculpto_tests_assets";
+    std::filesystem::create_directories(folder);
+    std::filesystem::path file_path = folder / "image.png", copy_path = folder / "image_copy.png";
+    std::ofstream(file_path, std::ios::binary) << "image content";
+    std::ofstream(copy_path, std::ios::binary) << "image content";
+
+    // Same file, loaded as color texture and as normal map, gives two different assets.
+    scl::assets_manager::asset_registry registry {};
+    scl::shared<int> color = scl::CreateShared<int>(1), normal_map = scl::CreateShared<int>(2);
+    registry.Add(file_path, color, sizeof(int), (scl::u64)scl::assets_manager::texture_usage::COLOR);
+    SCL_CHECK(!registry.Contains<int>(file_path, (scl::u64)scl::assets_manager::texture_usage::NORMAL_MAP));
+    registry.Add(file_path, normal_map, sizeof(int), (scl::u64)scl::assets_manager::texture_usage::NORMAL_MAP);
+
+    SCL_CHECK(registry.Find<int>(file_path, (scl::u64)scl::assets_manager::texture_usage::COLOR) == color);
+    SCL_CHECK(registry.Find<int>(file_path, (scl::u64)scl::assets_manager::texture_usage::NORMAL_MAP) == normal_map);
+    SCL_CHECK(registry.Find<int>(copy_path, (scl::u64)scl::assets_manager::texture_usage::NORMAL_MAP) == normal_map);
+    SCL_CHECK(registry.Find<float>(file_path) == nullptr);
+    SCL_CHECK(registry.GetStats<int>().ResidentCount == 2);
+
+    // Freed assets are not found and their entries are collected.
+    normal_map.reset();
+    SCL_CHECK(!registry.Contains<int>(file_path, (scl::u64)scl::assets_manager::texture_usage::NORMAL_MAP));
+    registry.CollectGarbage();
+    SCL_CHECK(registry.GetStats<int>().ResidentCount == 1);
+
+    std::filesystem::remove_all(folder);
+}
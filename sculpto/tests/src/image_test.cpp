@@ -0,0 +1,103 @@
+/*!****************************************************************//*!*
+ * \file   image_test.cpp
+ * \brief  Image pixels processing tests and benchmarks module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+/*! Reference (per component) pixels expansion to RGBA. */
+static void ExpandPixelsToRGBAReference(const scl::u8 *Source, scl::u8 *Destination, size_t PixelsCount, int ComponentsCount)
+{
+    for (size_t p = 0; p < PixelsCount; p++)
+    {
+        const scl::u8 *src = Source + p * ComponentsCount;
+        scl::u8 *dst = Destination + p * 4;
+        dst[0] = src[0];
+        dst[1] = ComponentsCount >= 3 ? src[1] : src[0];
+        dst[2] = ComponentsCount >= 3 ? src[2] : src[0];
+        dst[3] = ComponentsCount == 2 ? src[1] : ComponentsCount == 4 ? src[3] : 255;
+    }
+}
+
+SCL_TEST(ImageExpandPixelsToRGBA)
+{
+    bool is_equal = true, is_in_place_equal = true;
+    for (int components_count = 1; components_count <= 4; components_count++)
+        for (size_t pixels_count = 0; pixels_count < 40; pixels_count++)
+        {
+            std::vector<scl::u8> source(pixels_count * components_count);
+            for (size_t i = 0; i < source.size(); i++)
+                source[i] = (scl::u8)(i * 7 + 3);
+
+            std::vector<scl::u8> expected(pixels_count * 4), expanded(pixels_count * 4);
+            ExpandPixelsToRGBAReference(source.data(), expected.data(), pixels_count, components_count);
+            scl::image::ExpandPixelsToRGBA(source.data(), expanded.data(), pixels_count, components_count);
+            is_equal &= expanded == expected;
+
+            // In place expansion of buffer, already large enough for RGBA pixels.
+            std::vector<scl::u8> in_place(pixels_count * 4);
+            std::copy(source.begin(), source.end(), in_place.begin());
+            scl::image::ExpandPixelsToRGBA(in_place.data(), in_place.data(), pixels_count, components_count);
+            is_in_place_equal &= in_place == expected;
+        }
+    SCL_CHECK(is_equal);
+    SCL_CHECK(is_in_place_equal);
+}
+
+SCL_BENCHMARK(ImageExpandPixelsToRGBABenchmark)
+{
+    const size_t pixels_count = 2048 * 2048;
+    std::vector<scl::u8> source(pixels_count * 3), destination(pixels_count * 4);
+    for (size_t i = 0; i < source.size(); i++)
+        source[i] = (scl::u8)i;
+
+    double reference_time = scl::test::MeasureTime(16, [&]()
+    {
+        ExpandPixelsToRGBAReference(source.data(), destination.data(), pixels_count, 3);
+    });
+    double time = scl::test::MeasureTime(16, [&]()
+    {
+        scl::image::ExpandPixelsToRGBA(source.data(), destination.data(), pixels_count, 3);
+    });
+
+    SCL_INFO("RGB to RGBA expansion of {} pixels: reference {:.3f} ms, ExpandPixelsToRGBA {:.3f} ms.", pixels_count, reference_time, time);
+}
+
+SCL_BENCHMARK(ImageDecodeBenchmark)
+{
+    // Benchmark is run from workspace folder.
+    std::filesystem::path images_folder = "samples/editor/assets/images";
+    if (!std::filesystem::exists(images_folder))
+    {
+        SCL_WARN("Images folder \"{}\" not found, benchmark is run from workspace folder.", images_folder.string());
+        return;
+    }
+
+    std::vector<std::filesystem::path> image_files {};
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(images_folder))
+    {
+        std::string extension = entry.path().extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](char C) { return (char)std::tolower(C); });
+        if (extension == ".jpg" || extension == ".jpeg" || extension == ".png")
+            image_files.push_back(entry.path());
+    }
+
+    // Images are decoded flipped, as OpenGL textures are.
+    std::vector<size_t> images_sizes(image_files.size());
+    auto decode = [&](size_t Begin, size_t End)
+    {
+        for (size_t i = Begin; i < End; i++)
+            images_sizes[i] = scl::image(image_files[i].string(), true).GetSize();
+    };
+    double sequential_time = scl::test::MeasureTime(4, [&]() { decode(0, image_files.size()); });
+    double parallel_time = scl::test::MeasureTime(4, [&]() { scl::thread_pool::Get().ParallelFor(image_files.size(), 1, decode); });
+
+    size_t pixels_size = 0;
+    for (size_t image_size : images_sizes)
+        pixels_size += image_size;
+    SCL_INFO("Textures decoding ({} files, {} bytes of pixels): sequential {:.3f} ms, parallel ({} workers) {:.3f} ms.",
+             image_files.size(), pixels_size, sequential_time, scl::thread_pool::Get().GetWorkersCount(), parallel_time);
+}
@@ -0,0 +1,148 @@
+/*!****************************************************************//*!*
+ * \file   indirect_draw_list_test.cpp
+ * \brief  Indirect (multi draw indirect) draw commands list tests module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+/*! Check, that batches cover all built commands continuously and in order. */
+static bool IsBatchesContinuous(const scl::indirect_draw_list &List)
+{
+    scl::u32 next_draw = 0;
+    for (const auto &batch : List.GetBatches())
+    {
+        if (batch.FirstDraw != next_draw || batch.DrawsCount == 0) return false;
+        next_draw += batch.DrawsCount;
+    }
+    return next_draw == List.GetCommands().size();
+}
+
+SCL_TEST(IndirectDrawListCommands)
+{
+    scl::indirect_draw_list list {};
+    list.Add(3, 7, { 120, 36 }, 500, scl::matr4::Translate({ 1, 2, 3 }));
+    list.Add(3, 7, { 0, 0 }, 0, scl::matr4::Identity());
+    list.Build();
+
+    // Draws of empty ranges are skipped.
+    SCL_CHECK(list.GetDrawsCount() == 1);
+    SCL_CHECK(list.GetCommands().size() == 1);
+    SCL_CHECK(list.GetDrawData().size() == 1);
+
+    const scl::draw_indirect_command &command = list.GetCommands()[0];
+    SCL_CHECK(command.Count == 36);
+    SCL_CHECK(command.InstanceCount == 1);
+    SCL_CHECK(command.FirstIndex == 120);
+    SCL_CHECK(command.BaseVertex == 500);
+    SCL_CHECK(command.BaseInstance == 0);
+
+    const scl::indirect_draw_data &data = list.GetDrawData()[0];
+    SCL_CHECK(data.MaterialIndex == 7);
+    SCL_CHECK(data.World.A[3][0] == 1 && data.World.A[3][1] == 2 && data.World.A[3][2] == 3);
+
+    SCL_CHECK(list.GetBatches().size() == 1);
+    SCL_CHECK(list.GetBatches()[0].Page == 3 && list.GetBatches()[0].MaterialIndex == 7);
+
+    list.Clear();
+    SCL_CHECK(list.GetDrawsCount() == 0 && list.GetCommands().empty() && list.GetBatches().empty());
+}
+
+SCL_TEST(IndirectDrawListBatching)
+{
+    // Draws of two pages and two materials, added interleaved (first index identifies draw).
+    scl::indirect_draw_list list {};
+    const scl::u32 pages[] = { 1, 0, 1, 0, 1, 0 }, materials[] = { 1, 1, 0, 0, 1, 1 };
+    for (scl::u32 i = 0; i < 6; i++)
+        list.Add(pages[i], materials[i], { i * 10, 3 }, 0, scl::matr4::Identity());
+    list.Build();
+
+    // Batches are sorted by page, then by material, draws order is kept inside of batch.
+    const std::vector<scl::indirect_draw_batch> &batches = list.GetBatches();
+    SCL_CHECK(batches.size() == 4);
+    SCL_CHECK(IsBatchesContinuous(list));
+    const scl::u32 expected_batches[][2] = { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } };
+    bool is_sorted = batches.size() == 4;
+    for (size_t i = 0; i < batches.size() && is_sorted; i++)
+        is_sorted &= batches[i].Page == expected_batches[i][0] && batches[i].MaterialIndex == expected_batches[i][1];
+    SCL_CHECK(is_sorted);
+
+    std::vector<scl::u32> first_indices {};
+    for (const auto &command : list.GetCommands())
+        first_indices.push_back(command.FirstIndex);
+    SCL_CHECK(first_indices == std::vector<scl::u32>({ 30, 10, 50, 20, 0, 40 }));
+
+    // Base instance indexes draw data of command.
+    bool is_draw_data_matching = true;
+    for (scl::u32 i = 0; i < (scl::u32)list.GetCommands().size(); i++)
+        is_draw_data_matching &= list.GetCommands()[i].BaseInstance == i &&
+                                 list.GetDrawData()[i].MaterialIndex == materials[list.GetCommands()[i].FirstIndex / 10];
+    SCL_CHECK(is_draw_data_matching);
+}
+
+SCL_TEST(IndirectDrawListNotSplitByMaterial)
+{
+    scl::indirect_draw_list list {};
+    const scl::u32 pages[] = { 1, 0, 1, 0, 1, 0 }, materials[] = { 1, 1, 0, 0, 1, 1 };
+    for (scl::u32 i = 0; i < 6; i++)
+        list.Add(pages[i], materials[i], { i * 10, 3 }, 0, scl::matr4::Identity());
+    list.Build(false);
+
+    // Batches are split by pages only, draws keep addition order inside of page and their own materials in draw data.
+    const std::vector<scl::indirect_draw_batch> &batches = list.GetBatches();
+    SCL_CHECK(batches.size() == 2);
+    SCL_CHECK(IsBatchesContinuous(list));
+    SCL_CHECK(batches.size() == 2 && batches[0].Page == 0 && batches[1].Page == 1);
+    SCL_CHECK(batches.size() == 2 && batches[0].MaterialIndex == 1 && batches[1].MaterialIndex == 1);
+
+    std::vector<scl::u32> first_indices {}, material_indices {};
+    for (scl::u32 i = 0; i < (scl::u32)list.GetCommands().size(); i++)
+    {
+        first_indices.push_back(list.GetCommands()[i].FirstIndex);
+        material_indices.push_back(list.GetDrawData()[i].MaterialIndex);
+    }
+    SCL_CHECK(first_indices == std::vector<scl::u32>({ 10, 30, 50, 0, 20, 40 }));
+    SCL_CHECK(material_indices == std::vector<scl::u32>({ 1, 0, 1, 1, 0, 1 }));
+
+    // Same list could be rebuilt split by material.
+    list.Build(true);
+    SCL_CHECK(list.GetBatches().size() == 4);
+    SCL_CHECK(IsBatchesContinuous(list));
+}
+
+SCL_TEST(IndirectDrawListMaterialsStorageBatching)
+{
+    // Materials storage draws: many materials per page, shader selects material by draw data, so each page is drawn by single call.
+    const scl::u32 pages_count = 3, materials_count = 16, draws_count = 96;
+    scl::indirect_draw_list list {};
+    std::vector<scl::u32> draws_per_page(pages_count);
+    for (scl::u32 i = 0; i < draws_count; i++)
+    {
+        scl::u32 page = (i * 7) % pages_count, material_index = (i * 5) % materials_count;
+        list.Add(page, material_index, { i * 3, 3 }, (scl::i32)page * 1000, scl::matr4::Identity());
+        draws_per_page[page]++;
+    }
+    list.Build(false);
+
+    const std::vector<scl::indirect_draw_batch> &batches = list.GetBatches();
+    SCL_CHECK(batches.size() == pages_count);
+    SCL_CHECK(IsBatchesContinuous(list));
+
+    bool is_batches_matching = batches.size() == pages_count, is_draws_matching = true;
+    for (scl::u32 b = 0; b < batches.size() && is_batches_matching; b++)
+    {
+        is_batches_matching &= batches[b].Page == b && batches[b].DrawsCount == draws_per_page[b];
+        for (scl::u32 d = batches[b].FirstDraw; d < batches[b].FirstDraw + batches[b].DrawsCount; d++)
+        {
+            // Draw is identified by its first index, so its material and page could be checked.
+            const scl::draw_indirect_command &command = list.GetCommands()[d];
+            scl::u32 i = command.FirstIndex / 3;
+            is_draws_matching &= (i * 7) % pages_count == b && command.BaseVertex == (scl::i32)b * 1000 &&
+                                 list.GetDrawData()[d].MaterialIndex == (i * 5) % materials_count;
+        }
+    }
+    SCL_CHECK(is_batches_matching);
+    SCL_CHECK(is_draws_matching);
+}
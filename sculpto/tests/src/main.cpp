@@ -0,0 +1,49 @@
+/*!****************************************************************//*!*
+ * \file   main.cpp
+ * \brief  Sculpto library tests and benchmarks runner module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+/*! Count of failed checks of current run (checks could be called from worker threads). */
+static std::atomic<int> FailuresCount {};
+
+std::vector<scl::test::test_case> &scl::test::GetTestCases()
+{
+    static std::vector<test_case> test_cases {};
+    return test_cases;
+}
+
+void scl::test::ReportFailure(const char *File, int Line, const char *Expression)
+{
+    SCL_ERROR("{}({}): check failed: {}", File, Line, Expression);
+    FailuresCount++;
+}
+
+/*!*
+ * Main programm function.
+ * Runs all tests, or all benchmarks if '--benchmark' argument is passed.
+ *
+ * \param argc - application run arguments count.
+ * \param argv - application run arguments array.
+ * \return count of failed checks.
+ */
+int main(int argc, char *argv[])
+{
+    scl::log::Init();
+
+    bool is_benchmark = argc > 1 && std::string(argv[1]) == "--benchmark";
+    for (const scl::test::test_case &test_case : scl::test::GetTestCases())
+    {
+        if (test_case.IsBenchmark != is_benchmark) continue;
+
+        int prev_failures_count = FailuresCount;
+        test_case.Func();
+        if (FailuresCount == prev_failures_count) SCL_SUCCES("{} passed.", test_case.Name);
+        else                                      SCL_ERROR("{} failed.", test_case.Name);
+    }
+    return FailuresCount;
+}
@@ -0,0 +1,132 @@
+/*!****************************************************************//*!*
+ * \file   mesh_optimizer_test.cpp
+ * \brief  Triangles mesh vertex cache, overdraw and vertex fetch optimization tests module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include <numeric>
+
+#include "test_meshes.h"
+
+using scl::test::CreateGrid;
+
+/*! Triangle vertices positions, rotated to start from smallest one (winding is kept). */
+using triangle_positions = std::array<std::array<float, 3>, 3>;
+
+/*! Get sorted list of mesh triangles (by vertices positions) to compare meshes independently of vertices and triangles order. */
+static std::vector<triangle_positions> GetTriangles(const std::vector<scl::vertex> &Vertices, const std::vector<scl::u32> &Indices)
+{
+    std::vector<triangle_positions> triangles {};
+    for (size_t i = 0; i + 2 < Indices.size(); i += 3)
+    {
+        triangle_positions triangle {};
+        for (int v = 0; v < 3; v++)
+        {
+            const scl::vec3 &position = Vertices[Indices[i + v]].Position;
+            triangle[v] = { position.X, position.Y, position.Z };
+        }
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+/*! Check, that all indices reference existing vertices. */
+static bool IsIndicesValid(const std::vector<scl::u32> &Indices, size_t VerticesCount)
+{
+    return Indices.size() % 3 == 0 && std::all_of(Indices.begin(), Indices.end(), [&](scl::u32 Index) { return Index < VerticesCount; });
+}
+
+/*! Create grid mesh with randomly shuffled triangles (bad vertex cache locality). */
+static scl::topology::trimesh CreateShuffledGrid(int Size)
+{
+    scl::topology::trimesh grid = CreateGrid(Size);
+    std::vector<size_t> order(grid.Indices.size() / 3);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(30));
+
+    std::vector<scl::u32> indices {};
+    for (size_t triangle : order)
+        indices.insert(indices.end(), grid.Indices.begin() + triangle * 3, grid.Indices.begin() + triangle * 3 + 3);
+    grid.Indices = std::move(indices);
+    return grid;
+}
+
+SCL_TEST(MeshOptimizerAnalyzeVertexCache)
+{
+    // Two triangles, sharing edge, transform 4 vertices.
+    scl::topology::vertex_cache_stats quad = scl::topology::AnalyzeVertexCache({ 0, 1, 2, 2, 1, 3 }, 4);
+    SCL_CHECK(quad.TrianglesCount == 2 && quad.VerticesCount == 4 && quad.Misses == 4);
+    SCL_CHECK(quad.GetACMR() == 2.0f && quad.GetATVR() == 1.0f);
+
+    // Vertices, evicted from cache, are transformed again.
+    scl::topology::vertex_cache_stats evicted = scl::topology::AnalyzeVertexCache({ 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 3);
+    SCL_CHECK(evicted.Misses == 9 && evicted.VerticesCount == 6);
+    scl::topology::vertex_cache_stats cached = scl::topology::AnalyzeVertexCache({ 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 16);
+    SCL_CHECK(cached.Misses == 6);
+}
+
+SCL_TEST(MeshOptimizerDeduplicateVertices)
+{
+    // Grid with separate vertices for each triangle corner.
+    const int size = 8;
+    scl::topology::trimesh grid = CreateGrid(size);
+    std::vector<scl::vertex> vertices {};
+    std::vector<scl::u32> indices {};
+    for (scl::u32 index : grid.Indices)
+    {
+        indices.push_back((scl::u32)vertices.size());
+        vertices.push_back(grid.Vertices[index]);
+    }
+    std::vector<triangle_positions> triangles = GetTriangles(vertices, indices);
+
+    scl::topology::DeduplicateVertices(vertices, indices);
+    SCL_CHECK(vertices.size() == (size + 1) * (size + 1));
+    SCL_CHECK(IsIndicesValid(indices, vertices.size()));
+    SCL_CHECK(GetTriangles(vertices, indices) == triangles);
+}
+
+SCL_TEST(MeshOptimizerVertexCacheAndOverdraw)
+{
+    scl::topology::trimesh grid = CreateShuffledGrid(32);
+    std::vector<triangle_positions> triangles = GetTriangles(grid.Vertices, grid.Indices);
+    float source_acmr = scl::topology::AnalyzeVertexCache(grid.Indices, grid.Vertices.size()).GetACMR();
+
+    scl::topology::OptimizeVertexCache(grid.Indices, grid.Vertices.size());
+    float optimized_acmr = scl::topology::AnalyzeVertexCache(grid.Indices, grid.Vertices.size()).GetACMR();
+    SCL_CHECK(optimized_acmr <= source_acmr);
+    SCL_CHECK(optimized_acmr < 1.0f);
+    SCL_CHECK(IsIndicesValid(grid.Indices, grid.Vertices.size()));
+    SCL_CHECK(GetTriangles(grid.Vertices, grid.Indices) == triangles);
+
+    // Overdraw optimization keeps vertex cache efficiency within threshold.
+    scl::topology::OptimizeOverdraw(grid.Indices, grid.Vertices, 1.05f);
+    SCL_CHECK(scl::topology::AnalyzeVertexCache(grid.Indices, grid.Vertices.size()).GetACMR() <= optimized_acmr * 1.05f + 1e-5f);
+    SCL_CHECK(IsIndicesValid(grid.Indices, grid.Vertices.size()));
+    SCL_CHECK(GetTriangles(grid.Vertices, grid.Indices) == triangles);
+}
+
+SCL_TEST(MeshOptimizerVertexFetch)
+{
+    scl::topology::trimesh grid = CreateShuffledGrid(8);
+    grid.Vertices.push_back(scl::vertex { scl::vec3 { 100 }, scl::vec3 { 0 }, scl::vec2 { 0 } }); // Unused vertex.
+    std::vector<triangle_positions> triangles = GetTriangles(grid.Vertices, grid.Indices);
+
+    // Vertices are referenced in first use order and unused ones are removed.
+    scl::topology::OptimizeVertexFetch(grid.Vertices, grid.Indices);
+    SCL_CHECK(grid.Vertices.size() == 9 * 9);
+    SCL_CHECK(IsIndicesValid(grid.Indices, grid.Vertices.size()));
+    scl::u32 next_vertex = 0;
+    bool is_first_use_order = true;
+    for (scl::u32 index : grid.Indices)
+    {
+        is_first_use_order &= index <= next_vertex;
+        if (index == next_vertex) next_vertex++;
+    }
+    SCL_CHECK(is_first_use_order);
+    SCL_CHECK(next_vertex == grid.Vertices.size());
+    SCL_CHECK(GetTriangles(grid.Vertices, grid.Indices) == triangles);
+}
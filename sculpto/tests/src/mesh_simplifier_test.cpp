@@ -0,0 +1,63 @@
+/*!****************************************************************//*!*
+ * \file   mesh_simplifier_test.cpp
+ * \brief  Triangles mesh simplification and levels of detail selection tests module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test_meshes.h"
+
+using scl::test::CreateGrid;
+
+SCL_TEST(MeshSimplifierReducesFlatGrid)
+{
+    std::vector<scl::u32> seam_vertices {};
+    scl::topology::trimesh grid = CreateGrid(16, -1, &seam_vertices);
+    scl::topology::lod_level lod = scl::topology::SimplifyMesh(grid.Vertices, grid.Indices, grid.Indices.size() / 4, 0.01f);
+
+    SCL_CHECK(lod.Indices.size() <= grid.Indices.size() / 2);
+    SCL_CHECK(lod.Indices.size() % 3 == 0);
+    SCL_CHECK(lod.Error <= 0.01f);
+}
+
+SCL_TEST(MeshSimplifierLocksSeamsAndBorders)
+{
+    const int size = 16;
+    std::vector<scl::u32> seam_vertices {};
+    scl::topology::trimesh grid = CreateGrid(size, size / 2, &seam_vertices);
+    scl::topology::lod_level lod = scl::topology::SimplifyMesh(grid.Vertices, grid.Indices, 3, 1.0f);
+    SCL_CHECK(lod.Indices.size() < grid.Indices.size());
+
+    std::vector<bool> is_used(grid.Vertices.size());
+    for (scl::u32 index : lod.Indices)
+        is_used[index] = true;
+
+    // Seam vertices (both copies) and grid border vertices are kept.
+    bool is_seam_kept = true;
+    for (scl::u32 v : seam_vertices)
+        is_seam_kept &= is_used[v];
+    SCL_CHECK(is_seam_kept);
+
+    bool is_border_kept = true;
+    for (scl::u32 v = 0; v < grid.Vertices.size(); v++)
+    {
+        const scl::vec3 &P = grid.Vertices[v].Position;
+        if (P.X == 0 || P.Z == 0 || P.X == size || P.Z == size)
+            is_border_kept &= is_used[v];
+    }
+    SCL_CHECK(is_border_kept);
+}
+
+SCL_TEST(MeshSimplifierNormalsError)
+{
+    // Flat grid, where all neighbour vertices have orthogonal normals: geometric error of any collapse is zero, but shading would change.
+    const scl::vec3 normals[3] = { { 0, 1, 0 }, { 1, 0, 0 }, { 0, 0, 1 } };
+    std::vector<scl::u32> seam_vertices {};
+    scl::topology::trimesh grid = CreateGrid(16, -1, &seam_vertices);
+    for (auto &vertex : grid.Vertices)
+        vertex.Normal = normals[((int)vertex.Position.X + 2 * (int)vertex.Position.Z) % 3];
+
+    scl::topology::lod_level lod = scl::topology::SimplifyMesh(grid.Vertices, grid.Indices, grid.Indices.size() / 4, 0.1f);
+    SCL_CHECK(lod.Indices.size() == grid.Indices.size());
+}
@@ -0,0 +1,125 @@
+/*!****************************************************************//*!*
+ * \file   meshlets_test.cpp
+ * \brief  Triangles mesh clusters (meshlets) building and culling tests and benchmarks module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test_meshes.h"
+
+using scl::test::CreateGrid;
+
+/*! Perspective camera frustum, looking from specified position to specified point. */
+static scl::frustum GetFrustum(const scl::vec3 &Position, const scl::vec3 &At)
+{
+    scl::matr4 view = scl::matr4::View(Position, At, scl::vec3 { 0, 0, 1 });
+    return scl::frustum(view * scl::matr4::Frustum(-0.1f, 0.1f, -0.1f, 0.1f, 0.1f, 1000.0f));
+}
+
+SCL_TEST(MeshletsBounds)
+{
+    scl::topology::trimesh grid = CreateGrid(32);
+    std::vector<scl::topology::meshlet> meshlets = scl::topology::BuildMeshlets(grid.Vertices, grid.Indices);
+    SCL_CHECK(meshlets.size() > 1);
+
+    // Meshlets cover all indices continuously and fit into limits.
+    scl::u32 next_index = 0;
+    bool is_continuous = true, is_in_limits = true, is_in_sphere = true;
+    for (const auto &meshlet : meshlets)
+    {
+        is_continuous &= meshlet.FirstIndex == next_index && meshlet.IndicesCount % 3 == 0;
+        next_index = meshlet.FirstIndex + meshlet.IndicesCount;
+
+        std::set<scl::u32> vertices(grid.Indices.begin() + meshlet.FirstIndex, grid.Indices.begin() + next_index);
+        is_in_limits &= vertices.size() <= scl::topology::MESHLET_MAX_VERTICES &&
+                        meshlet.IndicesCount / 3 <= scl::topology::MESHLET_MAX_TRIANGLES;
+        for (scl::u32 v : vertices)
+            is_in_sphere &= (grid.Vertices[v].Position - meshlet.Center).Length() <= meshlet.Radius + 1e-4f;
+    }
+    SCL_CHECK(is_continuous);
+    SCL_CHECK(next_index == grid.Indices.size());
+    SCL_CHECK(is_in_limits);
+    SCL_CHECK(is_in_sphere);
+
+    // Single triangle meshlet.
+    std::vector<scl::vertex> triangle_vertices {
+        { scl::vec3 { 0, 0, 0 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 2, 0, 0 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 0, 2, 0 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+    };
+    std::vector<scl::topology::meshlet> triangle = scl::topology::BuildMeshlets(triangle_vertices, { 0, 1, 2 });
+    SCL_CHECK(triangle.size() == 1);
+    SCL_CHECK(triangle[0].Center == scl::vec3(1, 1, 0));
+    SCL_CHECK(std::abs(triangle[0].Radius - std::sqrt(2.0f)) < 1e-5f);
+}
+
+SCL_TEST(MeshletsCone)
+{
+    // Flat grid meshlets normals cone is single direction.
+    scl::topology::trimesh grid = CreateGrid(6);
+    std::vector<scl::topology::meshlet> flat = scl::topology::BuildMeshlets(grid.Vertices, grid.Indices);
+    SCL_CHECK(flat.size() == 1);
+    SCL_CHECK((flat[0].ConeAxis - scl::vec3 { 0, 1, 0 }).Length() < 1e-5f);
+    SCL_CHECK(flat[0].ConeCutoff < 1e-3f);
+
+    // Two triangles with normals at 90 degrees: cone axis is between them, half angle is 45 degrees.
+    std::vector<scl::vertex> vertices {
+        { scl::vec3 { 0, 0, 0 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 1, 0, 0 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 0, 0, 1 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 0, 1, 0 }, scl::vec3 { 0 }, scl::vec2 { 0 } },
+    };
+    std::vector<scl::topology::meshlet> bent = scl::topology::BuildMeshlets(vertices, { 0, 2, 1, 0, 1, 3 });
+    SCL_CHECK(bent.size() == 1);
+    SCL_CHECK((bent[0].ConeAxis - scl::vec3 { 0, 1, 1 }.Normalized()).Length() < 1e-5f);
+    SCL_CHECK(std::abs(bent[0].ConeCutoff - std::sqrt(0.5f)) < 1e-5f);
+
+    // Opposite triangles could not be back face culled.
+    std::vector<scl::topology::meshlet> opposite = scl::topology::BuildMeshlets(vertices, { 0, 2, 1, 0, 1, 2 });
+    SCL_CHECK(opposite[0].ConeCutoff == 1);
+}
+
+SCL_TEST(MeshletsCulling)
+{
+    scl::topology::trimesh grid = CreateGrid(6);
+    scl::topology::meshlet meshlet = scl::topology::BuildMeshlets(grid.Vertices, grid.Indices)[0];
+    const scl::vec3 center { 3, 0, 3 };
+
+    // Frustum test (back face culling disabled).
+    scl::vec3 above { 3, 10, 3 };
+    SCL_CHECK(scl::topology::IsMeshletVisible(meshlet, GetFrustum(above, center), above, false));
+    SCL_CHECK(!scl::topology::IsMeshletVisible(meshlet, GetFrustum(above, above * 2), above, false));
+
+    scl::vec3 aside { 100, 10, 3 };
+    SCL_CHECK(!scl::topology::IsMeshletVisible(meshlet, GetFrustum(aside, aside + scl::vec3 { 1, 0, 0 }), aside, false));
+
+    // Normals cone test: grid faces +Y, so it is visible from above only.
+    scl::vec3 below { 3, -10, 3 };
+    SCL_CHECK(scl::topology::IsMeshletVisible(meshlet, GetFrustum(above, center), above, true));
+    SCL_CHECK(!scl::topology::IsMeshletVisible(meshlet, GetFrustum(below, center), below, true));
+    SCL_CHECK(scl::topology::IsMeshletVisible(meshlet, GetFrustum(below, center), below, false));
+
+    // Camera in grid plane sees grid edge on, meshlet bound sphere is not fully behind.
+    scl::vec3 side { -10, 0, 3 };
+    SCL_CHECK(scl::topology::IsMeshletVisible(meshlet, GetFrustum(side, center), side, true));
+}
+
+SCL_BENCHMARK(MeshletsCullingBenchmark)
+{
+    scl::topology::sphere sphere(scl::vec3 { 0 }, 1, 256);
+    std::vector<scl::topology::meshlet> meshlets = scl::topology::BuildMeshlets(sphere.Vertices, sphere.Indices);
+
+    const scl::vec3 position { 0, 0, -3 };
+    scl::frustum frustum = GetFrustum(position, scl::vec3 { 0 });
+    size_t visible_count = 0;
+    double time = scl::test::MeasureTime(256, [&]()
+    {
+        visible_count = 0;
+        for (const auto &meshlet : meshlets)
+            visible_count += scl::topology::IsMeshletVisible(meshlet, frustum, position, true);
+    });
+
+    SCL_INFO("Meshlets culling: {} triangles sub-mesh, {} meshlets ({} visible), {:.4f} ms per sub-mesh, {:.2f} ns per meshlet.",
+             sphere.Indices.size() / 3, meshlets.size(), visible_count, time, time * 1e6 / meshlets.size());
+}
@@ -0,0 +1,82 @@
+/*!****************************************************************//*!*
+ * \file   range_allocator_test.cpp
+ * \brief  Ranges (of buffer elements) allocator tests module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+#include "utilities/memory/range_allocator.h"
+
+SCL_TEST(RangeAllocatorFirstFit)
+{
+    scl::range_allocator allocator(100);
+    scl::u32 a {}, b {}, c {};
+    SCL_CHECK(allocator.Allocate(10, a) && a == 0);
+    SCL_CHECK(allocator.Allocate(20, b) && b == 10);
+    SCL_CHECK(allocator.Allocate(30, c) && c == 30);
+    SCL_CHECK(allocator.GetFreeSize() == 40);
+
+    // Freed hole is reused by first fitting allocation, larger allocation takes first large enough range.
+    allocator.Free(a, 10);
+    scl::u32 large {}, small {};
+    SCL_CHECK(allocator.Allocate(15, large) && large == 60);
+    SCL_CHECK(allocator.Allocate(5, small) && small == 0);
+
+    // Allocation, larger than any free range, fails, even if total free size is enough.
+    scl::u32 failed = 12345;
+    SCL_CHECK(allocator.GetFreeSize() == 30);
+    SCL_CHECK(!allocator.Allocate(26, failed) && failed == 12345);
+    SCL_CHECK(!allocator.Allocate(0, failed));
+}
+
+SCL_TEST(RangeAllocatorSplit)
+{
+    scl::range_allocator allocator(64);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 1);
+
+    // Allocation from begining of free range leaves its rest free.
+    scl::u32 offset {};
+    SCL_CHECK(allocator.Allocate(24, offset) && offset == 0);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 1);
+    SCL_CHECK(allocator.GetFreeSize() == 40);
+
+    // Exact fit removes free range.
+    SCL_CHECK(allocator.Allocate(40, offset) && offset == 24);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 0);
+    SCL_CHECK(allocator.GetFreeSize() == 0);
+    SCL_CHECK(!allocator.Allocate(1, offset));
+}
+
+SCL_TEST(RangeAllocatorMerge)
+{
+    scl::range_allocator allocator(40);
+    scl::u32 offsets[4] {};
+    for (scl::u32 &offset : offsets)
+        allocator.Allocate(10, offset);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 0);
+
+    // Not adjacent freed ranges stay separate.
+    allocator.Free(offsets[0], 10);
+    allocator.Free(offsets[2], 10);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 2);
+
+    // Range between free neighbours is merged with both of them.
+    allocator.Free(offsets[1], 10);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 1);
+    scl::u32 merged {};
+    SCL_CHECK(allocator.Allocate(30, merged) && merged == 0);
+
+    // Range before free neighbour is merged with it.
+    allocator.Free(offsets[3], 10);
+    allocator.Free(merged + 20, 10);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 1);
+
+    // Freeing all space restores single free range of whole capacity.
+    allocator.Free(merged, 20);
+    SCL_CHECK(allocator.GetFreeRangesCount() == 1);
+    SCL_CHECK(allocator.GetFreeSize() == allocator.GetCapacity());
+    scl::u32 whole {};
+    SCL_CHECK(allocator.Allocate(40, whole) && whole == 0);
+}
@@ -0,0 +1,42 @@
+/*!****************************************************************//*!*
+ * \file   scene_name_index_test.cpp
+ * \brief  Scene objects by name search index tests module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+SCL_TEST(SceneNameIndexFindByPrefix)
+{
+    entt::registry registry {};
+    scl::scene_name_index index {};
+    registry.on_construct<scl::name_component>().connect<&scl::scene_name_index::OnNameConstruct>(index);
+    registry.on_update<scl::name_component>().connect<&scl::scene_name_index::OnNameUpdate>(index);
+    registry.on_destroy<scl::name_component>().connect<&scl::scene_name_index::OnNameDestroy>(index);
+
+    // Objects, named exactly as prefix, are found as well as longer names.
+    const char *names[] = { "Cube 2", "Cube", "Sphere", "Cube 1", "Cub" };
+    std::vector<entt::entity> objects {};
+    for (const char *name : names)
+    {
+        objects.push_back(registry.create());
+        registry.emplace<scl::name_component>(objects.back(), name);
+    }
+    SCL_CHECK(index.GetSize() == 5);
+    SCL_CHECK(index.Find("Cube") == objects[1]);
+
+    std::vector<std::string> found {};
+    index.FindByPrefix("Cube", [&](entt::entity Object, const std::string &Name) { found.push_back(Name); });
+    SCL_CHECK(found == std::vector<std::string>({ "Cube", "Cube 1", "Cube 2" }));
+
+    // Renamed and destroyed objects leave index.
+    registry.patch<scl::name_component>(objects[1], [](scl::name_component &Name) { Name.Name = "Box"; });
+    registry.destroy(objects[3]);
+    found.clear();
+    index.FindByPrefix("Cube", [&](entt::entity Object, const std::string &Name) { found.push_back(Name); });
+    SCL_CHECK(found == std::vector<std::string>({ "Cube 2" }));
+    SCL_CHECK(index.Find("Cube") == entt::null);
+    SCL_CHECK(index.Find("Box") == objects[1]);
+}
@@ -0,0 +1,64 @@
+/*!****************************************************************//*!*
+ * \file   scene_snapshot_test.cpp
+ * \brief  Scene snapshot capture and restore tests and benchmarks module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+/*! Fill scene with specified count of named objects with transforms. */
+static std::vector<scl::scene_object_handle> CreateObjects(scl::scene &Scene, int Count)
+{
+    std::vector<scl::scene_object_handle> objects {};
+    for (int i = 0; i < Count; i++)
+    {
+        scl::scene_object object = Scene.CreateObject("Object " + std::to_string(i));
+        object.AddComponent<scl::transform_component>(scl::vec3 { 1 }, scl::vec3 { 0 }, scl::vec3 { (float)i, 0, 0 });
+        objects.push_back(object);
+    }
+    return objects;
+}
+
+SCL_TEST(SceneSnapshotRestore)
+{
+    scl::scene scene {};
+    std::vector<scl::scene_object_handle> objects = CreateObjects(scene, 100);
+    scl::shared<scl::scene_snapshot> snapshot = scene.Snapshot();
+    SCL_CHECK(snapshot->GetObjectsCount() == 100);
+
+    // Change, remove and add objects after capture.
+    scl::scene_object changed = scene.GetSceneObject(objects[10]);
+    changed.GetComponent<scl::transform_component>().SetPosition(scl::vec3 { -1 });
+    scl::scene_object removed = scene.GetSceneObject(objects[20]);
+    scene.RemoveObject(removed);
+    scene.CreateObject("Added");
+
+    // Same handles point to captured objects, name index is in sync with them.
+    scene.Restore(*snapshot);
+    bool is_restored = true;
+    for (int i = 0; i < (int)objects.size(); i++)
+    {
+        scl::scene_object object = scene.GetSceneObject(objects[i]);
+        is_restored &= object.IsOk() && object.GetComponent<scl::transform_component>().Position.X == (float)i &&
+                       scene.GetNameIndex().Find("Object " + std::to_string(i)) == objects[i];
+    }
+    SCL_CHECK(is_restored);
+    SCL_CHECK(scene.GetNameIndex().Find("Added") == entt::null);
+}
+
+SCL_BENCHMARK(SceneSnapshotBenchmark)
+{
+    const int objects_count = 10000;
+    scl::scene scene {};
+    CreateObjects(scene, objects_count);
+
+    scl::shared<scl::scene_snapshot> snapshot {};
+    double snapshot_time = scl::test::MeasureTime(64, [&]() { snapshot = scene.Snapshot(); });
+    double restore_time = scl::test::MeasureTime(64, [&]() { scene.Restore(*snapshot); });
+
+    // Restore is expected to take less than 1 ms.
+    SCL_INFO("Scene of {} objects (names and transforms): snapshot {:.3f} ms, restore {:.3f} ms.",
+             objects_count, snapshot_time, restore_time);
+}
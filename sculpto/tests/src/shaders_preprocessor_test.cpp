@@ -0,0 +1,104 @@
+/*!****************************************************************//*!*
+ * \file   shaders_preprocessor_test.cpp
+ * \brief  Shaders preprocessor tests and benchmarks module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+#include "utilities/assets_manager/shaders_preprocessor.h"
+#include "utilities/assets_manager/files_load.h"
+
+using scl::assets_manager::shader_preprocessor;
+
+/*! Write text file (creating its folder) function. */
+static void WriteTextFile(const std::filesystem::path &FilePath, const std::string &Text)
+{
+    std::filesystem::create_directories(FilePath.parent_path());
+    std::ofstream(FilePath, std::ios::binary) << Text;
+}
+
+/*! Count of substring occurrences in text function. */
+static size_t CountOccurrences(const std::string &Text, const std::string &Substring)
+{
+    size_t count = 0;
+    for (size_t offset = Text.find(Substring); offset != std::string::npos; offset = Text.find(Substring, offset + 1))
+        count++;
+    return count;
+}
+
+SCL_TEST(ShadersPreprocessorIncludes)
+{
+    std::filesystem::path folder = std::filesystem::temp_directory_path() / "sculpto_tests_shaders";
+    WriteTextFile(folder / "lib" / "once.include.glsl", "#pragma once\nONCE_TEXT\n");
+    WriteTextFile(folder / "lib" / "nested.include.glsl", "#include \"once.include.glsl\"\nNESTED_TEXT\n");
+    WriteTextFile(folder / "lib" / "recursive.include.glsl", "#include \"recursive.include.glsl\"\n");
+    shader_preprocessor::ClearIncludeFilesCache();
+
+    // Once included file, included in global block, is not included in shader blocks again (global block is prepended to them).
+    std::string text =
+        "#version 460\n"
+        "#include \"lib/once.include.glsl\"\n"
+        "#include \"lib/nested.include.glsl\"\n"
+        "#shader-begin vert\n"
+        "#include \"lib/nested.include.glsl\"\n"
+        "#shader-end\n"
+        "#shader-begin frag\n"
+        "#include \"lib/once.include.glsl\"\n"
+        "#include \"lib/nested.include.glsl\"\n"
+        "#shader-end\n";
+    std::set<std::string> included_files {};
+    shader_preprocessor::ProcessIncludes("test", folder.string(), text, &included_files);
+    SCL_CHECK(CountOccurrences(text, "ONCE_TEXT") == 1);
+    SCL_CHECK(CountOccurrences(text, "NESTED_TEXT") == 3);
+    SCL_CHECK(CountOccurrences(text, "#include") == 0);
+    SCL_CHECK(CountOccurrences(text, "#pragma once") == 0);
+    SCL_CHECK(included_files.size() == 2);
+
+    // Recursive and missing includes are skipped.
+    std::string recursive_text = "#include \"lib/recursive.include.glsl\"\n#include \"lib/missing.include.glsl\"\nEND\n";
+    shader_preprocessor::ProcessIncludes("test", folder.string(), recursive_text);
+    SCL_CHECK(recursive_text == "END\n");
+
+    std::filesystem::remove_all(folder);
+}
+
+SCL_BENCHMARK(ShadersPreprocessorBenchmark)
+{
+    // Benchmark is run from workspace folder.
+    std::filesystem::path shaders_folder = "sculpto/assets/shaders";
+    if (!std::filesystem::exists(shaders_folder))
+    {
+        SCL_WARN("Shaders folder \"{}\" not found, benchmark is run from workspace folder.", shaders_folder.string());
+        return;
+    }
+
+    std::vector<std::filesystem::path> shader_files {};
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(shaders_folder))
+        if (entry.path().extension() == ".glsl" && !entry.path().stem().string().ends_with(".include"))
+            shader_files.push_back(entry.path());
+
+    size_t text_size = 0;
+    auto preprocess_all = [&]()
+    {
+        text_size = 0;
+        for (const auto &shader_file : shader_files)
+        {
+            std::string shader_text = scl::assets_manager::LoadFile(shader_file);
+            shader_preprocessor::ProcessIncludes(shader_file.string(), shader_file.parent_path().string(), shader_text);
+
+            std::vector<scl::shader_props> shaders {};
+            shader_preprocessor::SeparateShaders(shader_file.string(), shader_text, shaders);
+            for (const auto &shader : shaders)
+                text_size += shader.Source.size();
+        }
+    };
+
+    double cold_time = scl::test::MeasureTime(32, [&]() { shader_preprocessor::ClearIncludeFilesCache(); preprocess_all(); });
+    preprocess_all();
+    double warm_time = scl::test::MeasureTime(32, preprocess_all);
+
+    SCL_INFO("Engine shaders preprocessing ({} files, {} bytes of shaders): {:.3f} ms without include cache, {:.3f} ms with include cache.",
+             shader_files.size(), text_size, cold_time, warm_time);
+}
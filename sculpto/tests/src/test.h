@@ -0,0 +1,84 @@
+/*!****************************************************************//*!*
+ * \file   test.h
+ * \brief  Sculpto library tests and benchmarks registration module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include <sculpto.h>
+
+namespace scl::test
+{
+    /*! Registered test (or benchmark) structure. */
+    struct test_case
+    {
+        const char *Name;   /*! Test name. */
+        void (*Func)();     /*! Test function. */
+        bool IsBenchmark;   /*! Benchmark flag (benchmarks are run only on request). */
+    };
+
+    /*!*
+     * Registered tests list getter function.
+     *
+     * \param None.
+     * \return registered tests list.
+     */
+    std::vector<test_case> &GetTestCases();
+
+    /*!*
+     * Report failed test check function.
+     *
+     * \param File - failed check source file.
+     * \param Line - failed check source line.
+     * \param Expression - failed check expression text.
+     * \return None.
+     */
+    void ReportFailure(const char *File, int Line, const char *Expression);
+
+    /*! Test registration (on static initialisation) structure. */
+    struct test_registrar
+    {
+        test_registrar(const char *Name, void (*Func)(), bool IsBenchmark)
+        {
+            GetTestCases().push_back({ Name, Func, IsBenchmark });
+        }
+    };
+
+    /*!*
+     * Measure average function execution time function.
+     *
+     * \param Iterations - count of function executions.
+     * \param Func - function to measure.
+     * \return average execution time in milliseconds.
+     */
+    template <typename Tfunc>
+    double MeasureTime(size_t Iterations, const Tfunc &Func)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+            Func();
+        std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+        return duration.count() / Iterations;
+    }
+}
+
+/*! Test definition macro. */
+#define SCL_TEST(Name)                                                                      \
+    static void Name();                                                                     \
+    static scl::test::test_registrar Name##_registrar(#Name, Name, false);                  \
+    static void Name()
+
+/*! Benchmark definition macro (run with '--benchmark' command line argument). */
+#define SCL_BENCHMARK(Name)                                                                 \
+    static void Name();                                                                     \
+    static scl::test::test_registrar Name##_registrar(#Name, Name, true);                   \
+    static void Name()
+
+/*! Test check macro. Failed checks are reported, test continues execution. */
+#define SCL_CHECK(Expression) ((Expression) ? (void)0 : scl::test::ReportFailure(__FILE__, __LINE__, #Expression))
@@ -0,0 +1,46 @@
+/*!****************************************************************//*!*
+ * \file   test_meshes.cpp
+ * \brief  Tests shared meshes (fixtures) creation implementation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test_meshes.h"
+
+scl::topology::trimesh scl::test::CreateGrid(int Size, int SeamColumn, std::vector<u32> *OutSeamVertices)
+{
+    std::vector<vertex> vertices {};
+    std::vector<u32> indices {};
+    for (int z = 0; z <= Size; z++)
+        for (int x = 0; x <= Size; x++)
+        {
+            vec3 position { (float)x, 0, (float)z };
+            vertices.emplace_back(position, vec3 { 0, 1, 0 }, vec2 { (float)x / Size, (float)z / Size });
+            if (x == SeamColumn)
+            {
+                if (OutSeamVertices != nullptr) OutSeamVertices->push_back((u32)vertices.size() - 1);
+                vertices.emplace_back(position, vec3 { 0, 1, 0 }, vec2 { 0, (float)z / Size });
+                if (OutSeamVertices != nullptr) OutSeamVertices->push_back((u32)vertices.size() - 1);
+            }
+        }
+
+    // Grid cell corner vertex index (cells right of seam use duplicated vertices).
+    const u32 row_size = Size + 1 + (SeamColumn >= 0 ? 1 : 0);
+    auto get_vertex = [&](int X, int Z, bool IsRightOfSeam) -> u32
+    {
+        u32 index = Z * row_size + X;
+        if (SeamColumn >= 0 && X > SeamColumn) index++;
+        if (SeamColumn >= 0 && X == SeamColumn && IsRightOfSeam) index++;
+        return index;
+    };
+    for (int z = 0; z < Size; z++)
+        for (int x = 0; x < Size; x++)
+        {
+            bool is_right = x >= SeamColumn;
+            u32 a = get_vertex(x, z, is_right), b = get_vertex(x + 1, z, is_right);
+            u32 c = get_vertex(x, z + 1, is_right), d = get_vertex(x + 1, z + 1, is_right);
+            indices.insert(indices.end(), { a, c, b, b, c, d });
+        }
+    return topology::trimesh(std::move(vertices), std::move(indices));
+}
@@ -0,0 +1,25 @@
+/*!****************************************************************//*!*
+ * \file   test_meshes.h
+ * \brief  Tests shared meshes (fixtures) creation module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#pragma once
+
+#include "test.h"
+
+namespace scl::test
+{
+    /*!*
+     * Create flat grid mesh function.
+     * Grid lies in XZ plane, triangles face +Y. Vertices of column 'SeamColumn' are duplicated (texture seam), if it is not negative.
+     *
+     * \param Size - count of grid cells along each axis.
+     * \param SeamColumn - duplicated vertices column index (or -1).
+     * \param OutSeamVertices - seam vertices indices (could be nullptr).
+     * \return grid mesh.
+     */
+    topology::trimesh CreateGrid(int Size, int SeamColumn = -1, std::vector<u32> *OutSeamVertices = nullptr);
+}
@@ -0,0 +1,80 @@
+/*!****************************************************************//*!*
+ * \file   thread_pool_test.cpp
+ * \brief  Worker threads pool tests and benchmarks module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test.h"
+
+/*! Check, that each index is processed exactly once by ParallelFor of specified pool. */
+static void CheckParallelForCoverage(scl::thread_pool &Pool, size_t Count, size_t ChunkSize)
+{
+    std::vector<std::atomic<int>> visits(Count);
+    Pool.ParallelFor(Count, ChunkSize, [&](size_t Begin, size_t End)
+    {
+        for (size_t i = Begin; i < End; i++)
+            visits[i]++;
+    });
+
+    bool is_all_once = true;
+    for (const auto &visit : visits)
+        is_all_once &= visit == 1;
+    SCL_CHECK(is_all_once);
+}
+
+SCL_TEST(ThreadPoolParallelForCoverage)
+{
+    scl::thread_pool pool(4);
+    CheckParallelForCoverage(pool, 0, 16);
+    CheckParallelForCoverage(pool, 1, 16);
+    CheckParallelForCoverage(pool, 1000, 1);
+    CheckParallelForCoverage(pool, 1000, 7);
+    CheckParallelForCoverage(pool, 100000, 1024);
+}
+
+SCL_TEST(ThreadPoolParallelForSingleWorkerInline)
+{
+    scl::thread_pool pool(1);
+    std::thread::id caller_id = std::this_thread::get_id();
+    bool is_inline = true;
+    pool.ParallelFor(1000, 10, [&](size_t Begin, size_t End)
+    {
+        is_inline &= std::this_thread::get_id() == caller_id;
+    });
+    SCL_CHECK(is_inline);
+    CheckParallelForCoverage(pool, 1000, 10);
+}
+
+SCL_TEST(ThreadPoolParallelForFromTasks)
+{
+    // All workers are busy with tasks, which call ParallelFor themselves.
+    scl::thread_pool pool(2);
+    std::vector<std::future<void>> results {};
+    for (int i = 0; i < 8; i++)
+        results.push_back(pool.Submit([&pool]() { CheckParallelForCoverage(pool, 10000, 100); }));
+    for (auto &result : results)
+        result.get();
+}
+
+SCL_BENCHMARK(ThreadPoolParallelForBenchmark)
+{
+    std::vector<float> values(1 << 22);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = (float)i;
+
+    auto process = [&](size_t Begin, size_t End)
+    {
+        for (size_t i = Begin; i < End; i++)
+            values[i] = std::sqrt(values[i] * values[i] + 1.0f);
+    };
+    double sequential_time = scl::test::MeasureTime(16, [&]() { process(0, values.size()); });
+    double parallel_time = scl::test::MeasureTime(16, [&]() { scl::thread_pool::Get().ParallelFor(values.size(), 1 << 14, process); });
+
+    // Small ranges show fixed submission and wake up cost.
+    double small_range_time = scl::test::MeasureTime(1024, [&]() { scl::thread_pool::Get().ParallelFor(1 << 12, 1 << 10, process); });
+
+    SCL_INFO("ParallelFor ({} workers): {} values sequential {:.3f} ms, parallel {:.3f} ms; {} values parallel {:.4f} ms.",
+             scl::thread_pool::Get().GetWorkersCount(), values.size(), sequential_time, parallel_time, 1 << 12, small_range_time);
+}
@@ -0,0 +1,119 @@
+/*!****************************************************************//*!*
+ * \file   trimesh_test.cpp
+ * \brief  Triangles mesh normals and tangent space evaluation tests and benchmarks module.
+ *
+ * \author Sabitov Kirill
+ * \date   01 August 2022
+ *********************************************************************/
+
+#include "test_meshes.h"
+
+using scl::test::CreateGrid;
+
+/*! Check, that vectors are equal with tolerance. */
+static bool IsNear(const scl::vec3 &A, const scl::vec3 &B)
+{
+    return (A - B).Length() < 1e-4f;
+}
+
+/*! Reference per-triangle normals evaluation (renormalized after each triangle), replaced by area weighted one. */
+static void EvaluateNormalsReference(scl::topology::trimesh &Mesh)
+{
+    for (size_t i = 0; i < Mesh.Indices.size(); i += 3)
+    {
+        scl::vec3 A = Mesh.Vertices[Mesh.Indices[i + 1]].Position - Mesh.Vertices[Mesh.Indices[i]].Position;
+        scl::vec3 B = Mesh.Vertices[Mesh.Indices[i + 2]].Position - Mesh.Vertices[Mesh.Indices[i]].Position;
+        scl::vec3 N = A.Cross(B).Normalized();
+
+        for (int j = 0; j < 3; j++)
+        {
+            scl::vertex &V = Mesh.Vertices[Mesh.Indices[i + j]];
+            V.Normal = scl::vec3(V.Normal + N).Normalized();
+        }
+    }
+}
+
+/*! Grid mesh with heights bumps, so its normals vary. */
+static scl::topology::trimesh CreateBumpyGrid(int Size)
+{
+    scl::topology::trimesh grid = CreateGrid(Size);
+    for (scl::vertex &V : grid.Vertices)
+        V.Position.Y = std::sin(V.Position.X * 0.3f) * std::cos(V.Position.Z * 0.2f);
+    return grid;
+}
+
+SCL_TEST(TrimeshNormalsAreaWeighted)
+{
+    // First vertex is shared by big triangle, facing +Y (doubled area 4) and small one, facing +Z (doubled area 1).
+    std::vector<scl::vertex> vertices {
+        { scl::vec3 { 0, 0, 0 }, scl::vec3 { 1, 0, 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 0, 0, 2 }, scl::vec3 { 1, 0, 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 2, 0, 0 }, scl::vec3 { 1, 0, 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 1, 0, 0 }, scl::vec3 { 1, 0, 0 }, scl::vec2 { 0 } },
+        { scl::vec3 { 0, 1, 0 }, scl::vec3 { 1, 0, 0 }, scl::vec2 { 0 } },
+    };
+    scl::topology::trimesh mesh(std::move(vertices), std::vector<scl::u32> { 0, 1, 2, 0, 3, 4 });
+    mesh.EvaluateNormals();
+
+    // Previous normals are not accumulated, shared vertex normal is pulled to the bigger triangle.
+    SCL_CHECK(IsNear(mesh.Vertices[0].Normal, scl::vec3 { 0, 4, 1 }.Normalized()));
+    SCL_CHECK(IsNear(mesh.Vertices[1].Normal, scl::vec3 { 0, 1, 0 }));
+    SCL_CHECK(IsNear(mesh.Vertices[2].Normal, scl::vec3 { 0, 1, 0 }));
+    SCL_CHECK(IsNear(mesh.Vertices[3].Normal, scl::vec3 { 0, 0, 1 }));
+    SCL_CHECK(IsNear(mesh.Vertices[4].Normal, scl::vec3 { 0, 0, 1 }));
+
+    // Result does not depend on triangles order.
+    scl::topology::trimesh reversed(mesh.Vertices, std::vector<scl::u32> { 0, 3, 4, 0, 1, 2 });
+    reversed.EvaluateNormals();
+    SCL_CHECK(IsNear(reversed.Vertices[0].Normal, mesh.Vertices[0].Normal));
+}
+
+SCL_TEST(TrimeshTangentSpaceDegenerateFallback)
+{
+    // First triangle has valid texture coordinates (U along +X, V along +Z).
+    // Second one shares first vertex, but all its texture coordinates are equal.
+    std::vector<scl::vertex> vertices {
+        { scl::vec3 {  0, 0,  0 }, scl::vec3 { 0 }, scl::vec2 { 0, 0 } },
+        { scl::vec3 {  0, 0,  2 }, scl::vec3 { 0 }, scl::vec2 { 0, 1 } },
+        { scl::vec3 {  2, 0,  0 }, scl::vec3 { 0 }, scl::vec2 { 1, 0 } },
+        { scl::vec3 { -2, 0,  0 }, scl::vec3 { 0 }, scl::vec2 { 0, 0 } },
+        { scl::vec3 {  0, 0, -2 }, scl::vec3 { 0 }, scl::vec2 { 0, 0 } },
+    };
+    scl::topology::trimesh mesh(std::move(vertices), std::vector<scl::u32> { 0, 1, 2, 0, 4, 3 });
+    mesh.EvaluateNormals();
+    mesh.EvaluateTangentSpace();
+
+    // Valid triangle vertices (including shared one) keep texture coordinates based basis.
+    for (scl::u32 v : { 0, 1, 2 })
+    {
+        SCL_CHECK(IsNear(mesh.Vertices[v].Tangent, scl::vec3 { 1, 0, 0 }));
+        SCL_CHECK(IsNear(mesh.Vertices[v].Bitangent, scl::vec3 { 0, 0, 1 }));
+    }
+
+    // Vertices of degenerate triangle only get normal based orthonormal basis.
+    for (scl::u32 v : { 3, 4 })
+    {
+        const scl::vertex &V = mesh.Vertices[v];
+        SCL_CHECK(IsNear(V.Normal, scl::vec3 { 0, 1, 0 }));
+        SCL_CHECK(std::abs(V.Tangent.Length() - 1) < 1e-4f && std::abs(V.Bitangent.Length() - 1) < 1e-4f);
+        SCL_CHECK(std::abs(V.Tangent.Dot(V.Normal)) < 1e-4f && std::abs(V.Bitangent.Dot(V.Normal)) < 1e-4f);
+        SCL_CHECK(std::abs(V.Tangent.Dot(V.Bitangent)) < 1e-4f);
+    }
+}
+
+SCL_BENCHMARK(TrimeshNormalsBenchmark)
+{
+    // Mesh of single parallel chunk is processed in calling thread only.
+    scl::topology::trimesh small_grid = CreateBumpyGrid(90);
+    double reference_time = scl::test::MeasureTime(64, [&]() { EvaluateNormalsReference(small_grid); });
+    double single_core_time = scl::test::MeasureTime(64, [&]() { small_grid.EvaluateNormals(); });
+
+    scl::topology::trimesh big_grid = CreateBumpyGrid(1024);
+    double big_reference_time = scl::test::MeasureTime(4, [&]() { EvaluateNormalsReference(big_grid); });
+    double big_parallel_time = scl::test::MeasureTime(4, [&]() { big_grid.EvaluateNormals(); });
+
+    SCL_INFO("Normals of {} triangles: reference {:.3f} ms, single core {:.3f} ms.",
+             small_grid.Indices.size() / 3, reference_time, single_core_time);
+    SCL_INFO("Normals of {} triangles: reference {:.3f} ms, parallel ({} workers) {:.3f} ms.",
+             big_grid.Indices.size() / 3, big_reference_time, scl::thread_pool::Get().GetWorkersCount(), big_parallel_time);
+}